@@ -6,6 +6,7 @@
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
 //  [x] Renderer: Large meshes support (64k+ vertices) with 16-bit indices (Desktop OpenGL only).
+//  [X] Renderer: Signed distance field font atlas (io.Fonts->Flags |= ImFontAtlasFlags_SignedDistanceField).
 
 // About WebGL/ES:
 // - You need to '#define IMGUI_IMPL_OPENGL_ES2' or '#define IMGUI_IMPL_OPENGL_ES3' to use WebGL or OpenGL ES.
@@ -22,6 +23,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2024-01-22: OpenGL: Render text and shapes with a distance-field shader when the atlas is built with ImFontAtlasFlags_SignedDistanceField (through io.Fonts->TexSdfID, Image() of the atlas and mouse cursors still use the regular shader).
 //  2024-01-09: OpenGL: Update GL3W based imgui_impl_opengl3_loader.h to load "libGL.so" and variants, fixing regression on distros missing a symlink.
 //  2023-11-08: OpenGL: Update GL3W based imgui_impl_opengl3_loader.h to load "libGL.so" instead of "libGL.so.1", accommodating for NetBSD systems having only "libGL.so.3" available. (#6983)
 //  2023-10-05: OpenGL: Rename symbols in our internal loader so that LTO compilation with another copy of gl3w is possible. (#6875, #6668, #4445)
@@ -220,9 +222,13 @@ struct ImGui_ImplOpenGL3_Data
     bool            GlProfileIsCompat;
     GLint           GlProfileMask;
     GLuint          FontTexture;
+    ImTextureID     FontTextureSdfID;        // Value of io.Fonts->TexSdfID when atlas was built with ImFontAtlasFlags_SignedDistanceField: refers to FontTexture but isn't a GL texture name.
     GLuint          ShaderHandle;
+    GLuint          ShaderHandleSdf;         // Same as ShaderHandle with a distance-field fragment shader, used for draw commands referencing FontTextureSdfID
     GLint           AttribLocationTex;       // Uniforms location
     GLint           AttribLocationProjMtx;
+    GLint           AttribLocationSdfTex;
+    GLint           AttribLocationSdfProjMtx;
     GLuint          AttribLocationVtxPos;    // Vertex attributes location
     GLuint          AttribLocationVtxUV;
     GLuint          AttribLocationVtxColor;
@@ -443,6 +449,12 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
         { 0.0f,         0.0f,        -1.0f,   0.0f },
         { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
     };
+    if (bd->ShaderHandleSdf)
+    {
+        glUseProgram(bd->ShaderHandleSdf);
+        glUniform1i(bd->AttribLocationSdfTex, 0);
+        glUniformMatrix4fv(bd->AttribLocationSdfProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+    }
     glUseProgram(bd->ShaderHandle);
     glUniform1i(bd->AttribLocationTex, 0);
     glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
@@ -534,6 +546,7 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
 
     // Render command lists
+    GLuint current_program = bd->ShaderHandle;
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
@@ -580,6 +593,7 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
                 else
                     pcmd->UserCallback(cmd_list, pcmd);
+                current_program = bd->ShaderHandle;
             }
             else
             {
@@ -592,8 +606,18 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
                 GL_CALL(glScissor((int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y)));
 
+                // Select the distance-field shader for text and shapes when the atlas was built with ImFontAtlasFlags_SignedDistanceField
+                const bool is_sdf = (bd->FontTextureSdfID != (ImTextureID)0 && pcmd->GetTexID() == bd->FontTextureSdfID);
+                const GLuint texture = is_sdf ? bd->FontTexture : (GLuint)(intptr_t)pcmd->GetTexID();
+                const GLuint program = is_sdf ? bd->ShaderHandleSdf : bd->ShaderHandle;
+                if (program != current_program)
+                {
+                    GL_CALL(glUseProgram(program));
+                    current_program = program;
+                }
+
                 // Bind texture, Draw
-                GL_CALL(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID()));
+                GL_CALL(glBindTexture(GL_TEXTURE_2D, texture));
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
                 if (bd->GlVersion >= 320)
                     GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset));
@@ -682,6 +706,8 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
 
     // Store our identifier
     io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
+    bd->FontTextureSdfID = (io.Fonts->Flags & ImFontAtlasFlags_SignedDistanceField) ? (ImTextureID)(intptr_t)&bd->FontTexture : (ImTextureID)0; // Any unique value which can't be a texture name
+    io.Fonts->TexSdfID = bd->FontTextureSdfID;
 
     // Restore state
     GL_CALL(glBindTexture(GL_TEXTURE_2D, last_texture));
@@ -697,7 +723,9 @@ void ImGui_ImplOpenGL3_DestroyFontsTexture()
     {
         glDeleteTextures(1, &bd->FontTexture);
         io.Fonts->SetTexID(0);
+        io.Fonts->TexSdfID = 0;
         bd->FontTexture = 0;
+        bd->FontTextureSdfID = 0;
     }
 }
 
@@ -856,28 +884,87 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
         "}\n";
 
+    // Distance-field variants for ImFontAtlasFlags_SignedDistanceField: alpha 0.5 is the glyph edge,
+    // and fwidth() gives an anti-aliasing band of one screen pixel regardless of the scale text is rendered at.
+    const GLchar* fragment_shader_sdf_glsl_120 =
+        "#ifdef GL_ES\n"
+        "    #extension GL_OES_standard_derivatives : enable\n"
+        "    precision mediump float;\n"
+        "#endif\n"
+        "uniform sampler2D Texture;\n"
+        "varying vec2 Frag_UV;\n"
+        "varying vec4 Frag_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    float dist = texture2D(Texture, Frag_UV.st).a;\n"
+        "    float alpha = clamp((dist - 0.5) / max(fwidth(dist), 0.0001) + 0.5, 0.0, 1.0);\n"
+        "    gl_FragColor = vec4(Frag_Color.rgb, Frag_Color.a * alpha);\n"
+        "}\n";
+
+    const GLchar* fragment_shader_sdf_glsl_130 =
+        "uniform sampler2D Texture;\n"
+        "in vec2 Frag_UV;\n"
+        "in vec4 Frag_Color;\n"
+        "out vec4 Out_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    float dist = texture(Texture, Frag_UV.st).a;\n"
+        "    float alpha = clamp((dist - 0.5) / max(fwidth(dist), 0.0001) + 0.5, 0.0, 1.0);\n"
+        "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * alpha);\n"
+        "}\n";
+
+    const GLchar* fragment_shader_sdf_glsl_300_es =
+        "precision mediump float;\n"
+        "uniform sampler2D Texture;\n"
+        "in vec2 Frag_UV;\n"
+        "in vec4 Frag_Color;\n"
+        "layout (location = 0) out vec4 Out_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    float dist = texture(Texture, Frag_UV.st).a;\n"
+        "    float alpha = clamp((dist - 0.5) / max(fwidth(dist), 0.0001) + 0.5, 0.0, 1.0);\n"
+        "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * alpha);\n"
+        "}\n";
+
+    const GLchar* fragment_shader_sdf_glsl_410_core =
+        "in vec2 Frag_UV;\n"
+        "in vec4 Frag_Color;\n"
+        "uniform sampler2D Texture;\n"
+        "layout (location = 0) out vec4 Out_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    float dist = texture(Texture, Frag_UV.st).a;\n"
+        "    float alpha = clamp((dist - 0.5) / max(fwidth(dist), 0.0001) + 0.5, 0.0, 1.0);\n"
+        "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * alpha);\n"
+        "}\n";
+
     // Select shaders matching our GLSL versions
     const GLchar* vertex_shader = nullptr;
     const GLchar* fragment_shader = nullptr;
+    const GLchar* fragment_shader_sdf = nullptr;
     if (glsl_version < 130)
     {
         vertex_shader = vertex_shader_glsl_120;
         fragment_shader = fragment_shader_glsl_120;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_120;
     }
     else if (glsl_version >= 410)
     {
         vertex_shader = vertex_shader_glsl_410_core;
         fragment_shader = fragment_shader_glsl_410_core;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_410_core;
     }
     else if (glsl_version == 300)
     {
         vertex_shader = vertex_shader_glsl_300_es;
         fragment_shader = fragment_shader_glsl_300_es;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_300_es;
     }
     else
     {
         vertex_shader = vertex_shader_glsl_130;
         fragment_shader = fragment_shader_glsl_130;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_130;
     }
 
     // Create shaders
@@ -902,7 +989,6 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
 
     glDetachShader(bd->ShaderHandle, vert_handle);
     glDetachShader(bd->ShaderHandle, frag_handle);
-    glDeleteShader(vert_handle);
     glDeleteShader(frag_handle);
 
     bd->AttribLocationTex = glGetUniformLocation(bd->ShaderHandle, "Texture");
@@ -911,6 +997,30 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
     bd->AttribLocationVtxUV = (GLuint)glGetAttribLocation(bd->ShaderHandle, "UV");
     bd->AttribLocationVtxColor = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Color");
 
+    // Link distance-field program, sharing vertex shader and attribute locations so both programs can use the same vertex setup
+    const GLchar* fragment_shader_sdf_with_version[2] = { bd->GlslVersionString, fragment_shader_sdf };
+    GLuint frag_sdf_handle = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(frag_sdf_handle, 2, fragment_shader_sdf_with_version, nullptr);
+    glCompileShader(frag_sdf_handle);
+    CheckShader(frag_sdf_handle, "fragment shader (sdf)");
+
+    bd->ShaderHandleSdf = glCreateProgram();
+    glAttachShader(bd->ShaderHandleSdf, vert_handle);
+    glAttachShader(bd->ShaderHandleSdf, frag_sdf_handle);
+    glBindAttribLocation(bd->ShaderHandleSdf, bd->AttribLocationVtxPos, "Position");
+    glBindAttribLocation(bd->ShaderHandleSdf, bd->AttribLocationVtxUV, "UV");
+    glBindAttribLocation(bd->ShaderHandleSdf, bd->AttribLocationVtxColor, "Color");
+    glLinkProgram(bd->ShaderHandleSdf);
+    CheckProgram(bd->ShaderHandleSdf, "shader program (sdf)");
+
+    glDetachShader(bd->ShaderHandleSdf, vert_handle);
+    glDetachShader(bd->ShaderHandleSdf, frag_sdf_handle);
+    glDeleteShader(vert_handle);
+    glDeleteShader(frag_sdf_handle);
+
+    bd->AttribLocationSdfTex = glGetUniformLocation(bd->ShaderHandleSdf, "Texture");
+    bd->AttribLocationSdfProjMtx = glGetUniformLocation(bd->ShaderHandleSdf, "ProjMtx");
+
     // Create buffers
     glGenBuffers(1, &bd->VboHandle);
     glGenBuffers(1, &bd->ElementsHandle);
@@ -933,6 +1043,7 @@ void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
     if (bd->VboHandle)      { glDeleteBuffers(1, &bd->VboHandle); bd->VboHandle = 0; }
     if (bd->ElementsHandle) { glDeleteBuffers(1, &bd->ElementsHandle); bd->ElementsHandle = 0; }
     if (bd->ShaderHandle)   { glDeleteProgram(bd->ShaderHandle); bd->ShaderHandle = 0; }
+    if (bd->ShaderHandleSdf){ glDeleteProgram(bd->ShaderHandleSdf); bd->ShaderHandleSdf = 0; }
     ImGui_ImplOpenGL3_DestroyFontsTexture();
 }
 
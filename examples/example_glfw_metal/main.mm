@@ -96,7 +96,17 @@ int main(int, char**)
             // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application, or clear/overwrite your copy of the mouse data.
             // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application, or clear/overwrite your copy of the keyboard data.
             // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
-            glfwPollEvents();
+            // Idle: when nothing can change on screen, wait for OS events (or until dear imgui needs a new frame, e.g. for a cursor blink
+            // or a tooltip delay) instead of rendering continuously. See ImGui::GetNextWakeupTime(). Gamepads are polled by the backend.
+            float wait_time = ImGui::GetNextWakeupTime();
+            if ((io.ConfigFlags & ImGuiConfigFlags_NavEnableGamepad) && glfwJoystickPresent(GLFW_JOYSTICK_1))
+                wait_time = 0.0f;
+            if (wait_time == FLT_MAX)
+                glfwWaitEvents();
+            else if (wait_time > 0.0f)
+                glfwWaitEventsTimeout(wait_time);
+            else
+                glfwPollEvents();
 
             int width, height;
             glfwGetFramebufferSize(window, &width, &height);
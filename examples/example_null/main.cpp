@@ -17,6 +17,13 @@ int main(int, char**)
 
     for (int n = 0; n < 20; n++)
     {
+        // Skip frames which would be identical to the previous one.
+        // A real application would block on OS events with ImGui::GetNextWakeupTime() as a timeout (see SDL2/GLFW examples).
+        if (!ImGui::IsFrameNeeded())
+        {
+            printf("Frame %d skipped (nothing to update)\n", n);
+            continue;
+        }
         printf("NewFrame() %d\n", n);
         io.DisplaySize = ImVec2(1920, 1080);
         io.DeltaTime = 1.0f / 60.0f;
@@ -131,6 +131,13 @@ int main(int, char**)
         // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application, or clear/overwrite your copy of the mouse data.
         // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application, or clear/overwrite your copy of the keyboard data.
         // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
+#ifndef __EMSCRIPTEN__
+        // Idle: when nothing can change on screen, wait for the next OS event (or until dear imgui needs a new frame, e.g. for a cursor blink
+        // or a tooltip delay) instead of rendering continuously. See ImGui::GetNextWakeupTime().
+        float wait_time = ImGui::GetNextWakeupTime();
+        if (wait_time > 0.0f)
+            SDL_WaitEventTimeout(nullptr, (wait_time == FLT_MAX) ? -1 : (int)(wait_time * 1000.0f) + 1);
+#endif
         SDL_Event event;
         while (SDL_PollEvent(&event))
         {
@@ -46,8 +46,13 @@
 //#define IMGUI_DISABLE_DEFAULT_MATH_FUNCTIONS              // Don't implement ImFabs/ImSqrt/ImPow/ImFmod/ImCos/ImSin/ImAcos/ImAtan2 so you can implement them yourself.
 //#define IMGUI_DISABLE_FILE_FUNCTIONS                      // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite and ImFileHandle at all (replace them with dummies)
 //#define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS              // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite and ImFileHandle so you can implement them yourself if you don't want to link with fopen/fclose/fread/fwrite. This will also disable the LogToTTY() function.
+//#define IMGUI_ENABLE_ASYNC_INI_SAVING                     // Implement io.ConfigIniSavingAsync: write .ini file from a writer thread. Uses C++11 <thread>, <mutex> and <condition_variable> (may require linking with -pthread). If you implement file functions yourself you'll also need ImFileRename().
+//#define IMGUI_ENABLE_THREADED_INPUT_EVENTS                // Allow calling io.AddXXXEvent() functions from any thread: events go through a lock-free queue which is drained by NewFrame(). Uses C++11 <atomic>.
+//#define IMGUI_ENABLE_PROFILER                             // Record timing zones for the main phases of NewFrame()/Begin()/End()/Render() into a ring buffer of recent frames. Shown in Metrics->Profiler and exportable as Chrome trace_event JSON. Uses C++11 <chrono>.
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
 //#define IMGUI_DISABLE_SSE                                 // Disable use of SSE intrinsics even if available
+//#define IMGUI_DISABLE_ARM_CRC32                           // Disable use of ARMv8 CRC32 instructions for hashing IDs even if available
+//#define IMGUI_STORAGE_USE_HASH_INDEX                      // Make all ImGuiStorage (window state storage, tree nodes open state, ImPool maps) use an open-addressing hash index instead of sorted insertion. Faster for very large storages.
 
 //---- Include imgui_user.h at the end of imgui.h as a convenience
 // May be convenient for some users to only explicitly include vanilla imgui.h and have extra stuff included.
@@ -69,6 +69,8 @@ CODE
 // [SECTION] ImGuiTextFilter
 // [SECTION] ImGuiTextBuffer, ImGuiTextIndex
 // [SECTION] ImGuiListClipper
+// [SECTION] ImGuiGridClipper
+// [SECTION] ImGuiTreeClipper
 // [SECTION] STYLING
 // [SECTION] RENDER HELPERS
 // [SECTION] INITIALIZATION, SHUTDOWN
@@ -86,6 +88,7 @@ CODE
 // [SECTION] LOCALIZATION
 // [SECTION] VIEWPORTS, PLATFORM WINDOWS
 // [SECTION] PLATFORM DEPENDENT HELPERS
+// [SECTION] PROFILER
 // [SECTION] METRICS/DEBUGGER WINDOW
 // [SECTION] DEBUG LOG WINDOW
 // [SECTION] OTHER DEBUG TOOLS (ITEM PICKER, ID STACK TOOL)
@@ -962,6 +965,18 @@ CODE
 // System includes
 #include <stdio.h>      // vsnprintf, sscanf, printf
 #include <stdint.h>     // intptr_t
+#ifdef IMGUI_ENABLE_ASYNC_INI_SAVING
+#include <thread>       // std::thread for io.ConfigIniSavingAsync
+#include <mutex>
+#include <condition_variable>
+#endif
+#ifdef IMGUI_ENABLE_THREADED_INPUT_EVENTS
+#include <atomic>       // std::atomic for ImGuiInputEventRing
+#include <mutex>
+#endif
+#ifdef IMGUI_ENABLE_PROFILER
+#include <chrono>       // std::chrono::steady_clock for ImGuiProfiler
+#endif
 
 // [Windows] On non-Visual Studio compilers, we default to IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS unless explicitly enabled
 #if defined(_WIN32) && !defined(_MSC_VER) && !defined(IMGUI_ENABLE_WIN32_DEFAULT_IME_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS)
@@ -995,6 +1010,17 @@ CODE
 #include <TargetConditionals.h>
 #endif
 
+// Memory mapped files for ImFileMapToMemory()
+#if !defined(IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS) && defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS) && !(defined(WINAPI_FAMILY) && (WINAPI_FAMILY == WINAPI_FAMILY_APP))
+#define IMGUI_FILE_MAPPING_WIN32
+#elif !defined(IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS) && !defined(_WIN32) && (defined(__unix__) || defined(__APPLE__))
+#define IMGUI_FILE_MAPPING_POSIX
+#include <fcntl.h>      // open
+#include <sys/mman.h>   // mmap, munmap
+#include <sys/stat.h>   // fstat
+#include <unistd.h>     // close
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (disable: 4127)             // condition expression is constant
@@ -1050,6 +1076,9 @@ static const float WINDOWS_HOVER_PADDING                    = 4.0f;     // Exten
 static const float WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER = 0.04f;    // Reduce visual noise by only highlighting the border after a certain time.
 static const float WINDOWS_MOUSE_WHEEL_SCROLL_LOCK_TIMER    = 0.70f;    // Lock scrolled window (so it doesn't pick child windows that are scrolling through) for a certain time, unless mouse moved.
 
+// Idle frames (see GetNextWakeupTime())
+static const float WAKEUP_INI_SAVING_POLL_DELAY             = 0.10f;    // Poll rate of the .ini writer thread completion while io.IniSavingInProgress is set.
+
 // Tooltip offset
 static const ImVec2 TOOLTIP_DEFAULT_OFFSET = ImVec2(16, 10);            // Multiplied by g.Style.MouseCursorScale
 
@@ -1070,6 +1099,22 @@ static void*            WindowSettingsHandler_ReadOpen(ImGuiContext* ctx, ImGuiS
 static void             WindowSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line);
 static void             WindowSettingsHandler_ApplyAll(ImGuiContext* ctx, ImGuiSettingsHandler*);
 static void             WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler*, ImGuiTextBuffer* buf);
+static void             WindowSettingsHandler_ReadBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, int version, const void* data, size_t data_size);
+static void             WindowSettingsHandler_WriteBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, ImVector<char>* buf);
+static void             SettingsWriterQueue(ImGuiContext* ctx, const char* ini_filename);
+static void             SettingsWriterUpdate(ImGuiContext* ctx);
+static void             SettingsWriterShutdown(ImGuiContext* ctx);
+
+// Inputs
+static void             AddInputEvent(ImGuiContext* ctx, ImGuiInputEvent* e);
+static void             QueueInputEvent(ImGuiContext* ctx, ImGuiInputEvent* e);
+static ImGuiInputEventRing* InputEventRingCreate();
+static void             InputEventRingDestroy(ImGuiInputEventRing* ring);
+static bool             InputEventRingPop(ImGuiInputEventRing* ring, ImGuiInputEvent* out_e);
+static bool             InputEventRingIsEmpty(ImGuiInputEventRing* ring);
+#ifdef IMGUI_ENABLE_THREADED_INPUT_EVENTS
+static void             InputEventRingPush(ImGuiInputEventRing* ring, const ImGuiInputEvent* e);
+#endif
 
 // Platform Dependents default implementation for IO functions
 static const char*      GetClipboardTextFn_DefaultImpl(void* user_data_ctx);
@@ -1284,6 +1329,8 @@ ImGuiIO::ImGuiIO()
     ConfigMacOSXBehaviors = false;
 #endif
     ConfigInputTrickleEventQueue = true;
+    ConfigInputCoalesceMouseEvents = true;
+    ConfigInputEventsHistorySize = 0;
     ConfigInputTextCursorBlink = true;
     ConfigInputTextEnterKeepActive = false;
     ConfigDragClickToInputText = false;
@@ -1324,13 +1371,13 @@ void ImGuiIO::AddInputCharacter(unsigned int c)
     ImGuiInputEvent e;
     e.Type = ImGuiInputEventType_Text;
     e.Source = ImGuiInputSource_Keyboard;
-    e.EventId = g.InputEventsNextEventId++;
     e.Text.Char = c;
-    g.InputEventsQueue.push_back(e);
+    AddInputEvent(&g, &e);
 }
 
 // UTF16 strings use surrogate pairs to encode codepoints >= 0x10000, so
 // we should save the high surrogate.
+// With IMGUI_ENABLE_THREADED_INPUT_EVENTS, UTF-16 characters need to be submitted by a single thread (the surrogate is stored in ImGuiIO).
 void ImGuiIO::AddInputCharacterUTF16(ImWchar16 c)
 {
     if ((c == 0 && InputQueueSurrogate == 0) || !AppAcceptingEvents)
@@ -1383,6 +1430,11 @@ void ImGuiIO::ClearEventsQueue()
     IM_ASSERT(Ctx != NULL);
     ImGuiContext& g = *Ctx;
     g.InputEventsQueue.clear();
+    if (g.InputEventsRing != NULL)
+    {
+        ImGuiInputEvent e;
+        while (InputEventRingPop(g.InputEventsRing, &e)) {}
+    }
 }
 
 // Clear current keyboard/mouse/gamepad state + current frame text input buffer. Equivalent to releasing all keys/buttons.
@@ -1452,34 +1504,14 @@ void ImGuiIO::AddKeyAnalogEvent(ImGuiKey key, bool down, float analog_value)
     IM_ASSERT(ImGui::IsAliasKey(key) == false); // Backend cannot submit ImGuiKey_MouseXXX values they are automatically inferred from AddMouseXXX() events.
     IM_ASSERT(key != ImGuiMod_Shortcut); // We could easily support the translation here but it seems saner to not accept it (TestEngine perform a translation itself)
 
-    // Verify that backend isn't mixing up using new io.AddKeyEvent() api and old io.KeysDown[] + io.KeyMap[] data.
-#ifndef IMGUI_DISABLE_OBSOLETE_KEYIO
-    IM_ASSERT((BackendUsingLegacyKeyArrays == -1 || BackendUsingLegacyKeyArrays == 0) && "Backend needs to either only use io.AddKeyEvent(), either only fill legacy io.KeysDown[] + io.KeyMap[]. Not both!");
-    if (BackendUsingLegacyKeyArrays == -1)
-        for (int n = ImGuiKey_NamedKey_BEGIN; n < ImGuiKey_NamedKey_END; n++)
-            IM_ASSERT(KeyMap[n] == -1 && "Backend needs to either only use io.AddKeyEvent(), either only fill legacy io.KeysDown[] + io.KeyMap[]. Not both!");
-    BackendUsingLegacyKeyArrays = 0;
-#endif
-    if (ImGui::IsGamepadKey(key))
-        BackendUsingLegacyNavInputArray = false;
-
-    // Filter duplicate (in particular: key mods and gamepad analog values are commonly spammed)
-    const ImGuiInputEvent* latest_event = FindLatestInputEvent(&g, ImGuiInputEventType_Key, (int)key);
-    const ImGuiKeyData* key_data = ImGui::GetKeyData(&g, key);
-    const bool latest_key_down = latest_event ? latest_event->Key.Down : key_data->Down;
-    const float latest_key_analog = latest_event ? latest_event->Key.AnalogValue : key_data->AnalogValue;
-    if (latest_key_down == down && latest_key_analog == analog_value)
-        return;
-
-    // Add event
+    // Add event (duplicates are filtered in QueueInputEvent())
     ImGuiInputEvent e;
     e.Type = ImGuiInputEventType_Key;
     e.Source = ImGui::IsGamepadKey(key) ? ImGuiInputSource_Gamepad : ImGuiInputSource_Keyboard;
-    e.EventId = g.InputEventsNextEventId++;
     e.Key.Key = key;
     e.Key.Down = down;
     e.Key.AnalogValue = analog_value;
-    g.InputEventsQueue.push_back(e);
+    AddInputEvent(&g, &e);
 }
 
 void ImGuiIO::AddKeyEvent(ImGuiKey key, bool down)
@@ -1531,20 +1563,12 @@ void ImGuiIO::AddMousePosEvent(float x, float y)
     // Apply same flooring as UpdateMouseInputs()
     ImVec2 pos((x > -FLT_MAX) ? ImFloor(x) : x, (y > -FLT_MAX) ? ImFloor(y) : y);
 
-    // Filter duplicate
-    const ImGuiInputEvent* latest_event = FindLatestInputEvent(&g, ImGuiInputEventType_MousePos);
-    const ImVec2 latest_pos = latest_event ? ImVec2(latest_event->MousePos.PosX, latest_event->MousePos.PosY) : g.IO.MousePos;
-    if (latest_pos.x == pos.x && latest_pos.y == pos.y)
-        return;
-
     ImGuiInputEvent e;
     e.Type = ImGuiInputEventType_MousePos;
     e.Source = ImGuiInputSource_Mouse;
-    e.EventId = g.InputEventsNextEventId++;
     e.MousePos.PosX = pos.x;
     e.MousePos.PosY = pos.y;
-    e.MousePos.MouseSource = g.InputEventsNextMouseSource;
-    g.InputEventsQueue.push_back(e);
+    AddInputEvent(&g, &e);
 }
 
 void ImGuiIO::AddMouseButtonEvent(int mouse_button, bool down)
@@ -1555,20 +1579,12 @@ void ImGuiIO::AddMouseButtonEvent(int mouse_button, bool down)
     if (!AppAcceptingEvents)
         return;
 
-    // Filter duplicate
-    const ImGuiInputEvent* latest_event = FindLatestInputEvent(&g, ImGuiInputEventType_MouseButton, (int)mouse_button);
-    const bool latest_button_down = latest_event ? latest_event->MouseButton.Down : g.IO.MouseDown[mouse_button];
-    if (latest_button_down == down)
-        return;
-
     ImGuiInputEvent e;
     e.Type = ImGuiInputEventType_MouseButton;
     e.Source = ImGuiInputSource_Mouse;
-    e.EventId = g.InputEventsNextEventId++;
     e.MouseButton.Button = mouse_button;
     e.MouseButton.Down = down;
-    e.MouseButton.MouseSource = g.InputEventsNextMouseSource;
-    g.InputEventsQueue.push_back(e);
+    AddInputEvent(&g, &e);
 }
 
 // Queue a mouse wheel event (some mouse/API may only have a Y component)
@@ -1584,20 +1600,22 @@ void ImGuiIO::AddMouseWheelEvent(float wheel_x, float wheel_y)
     ImGuiInputEvent e;
     e.Type = ImGuiInputEventType_MouseWheel;
     e.Source = ImGuiInputSource_Mouse;
-    e.EventId = g.InputEventsNextEventId++;
     e.MouseWheel.WheelX = wheel_x;
     e.MouseWheel.WheelY = wheel_y;
-    e.MouseWheel.MouseSource = g.InputEventsNextMouseSource;
-    g.InputEventsQueue.push_back(e);
+    AddInputEvent(&g, &e);
 }
 
 // This is not a real event, the data is latched in order to be stored in actual Mouse events.
 // This is so that duplicate events (e.g. Windows sending extraneous WM_MOUSEMOVE) gets filtered and are not leading to actual source changes.
+// It still goes through AddInputEvent() with ImGuiInputEventType_None, so the latch stays ordered with events submitted from other threads.
 void ImGuiIO::AddMouseSourceEvent(ImGuiMouseSource source)
 {
     IM_ASSERT(Ctx != NULL);
     ImGuiContext& g = *Ctx;
-    g.InputEventsNextMouseSource = source;
+    ImGuiInputEvent e;
+    e.Type = ImGuiInputEventType_None;
+    e.MousePos.MouseSource = source;
+    AddInputEvent(&g, &e);
 }
 
 void ImGuiIO::AddFocusEvent(bool focused)
@@ -1605,19 +1623,316 @@ void ImGuiIO::AddFocusEvent(bool focused)
     IM_ASSERT(Ctx != NULL);
     ImGuiContext& g = *Ctx;
 
-    // Filter duplicate
-    const ImGuiInputEvent* latest_event = FindLatestInputEvent(&g, ImGuiInputEventType_Focus);
-    const bool latest_focused = latest_event ? latest_event->AppFocused.Focused : !g.IO.AppFocusLost;
-    if (latest_focused == focused || (ConfigDebugIgnoreFocusLoss && !focused))
-        return;
-
     ImGuiInputEvent e;
     e.Type = ImGuiInputEventType_Focus;
-    e.EventId = g.InputEventsNextEventId++;
     e.AppFocused.Focused = focused;
-    g.InputEventsQueue.push_back(e);
+    AddInputEvent(&g, &e);
+}
+
+// Called by all io.AddXXXEvent() functions.
+// - Default: filter and append to g.InputEventsQueue immediately.
+// - With IMGUI_ENABLE_THREADED_INPUT_EVENTS: push to a lock-free queue so it may be called from any thread.
+//   UpdateInputEvents() then filters and appends them from NewFrame(), before applying the trickling rules.
+static void AddInputEvent(ImGuiContext* ctx, ImGuiInputEvent* e)
+{
+    ImGuiContext& g = *ctx;
+    if (g.IO.GetInputEventTimestampFn != NULL && e->Type != ImGuiInputEventType_None)
+        e->Timestamp = g.IO.GetInputEventTimestampFn(g.IO.InputEventTimestampUserData);
+#ifdef IMGUI_ENABLE_THREADED_INPUT_EVENTS
+    InputEventRingPush(g.InputEventsRing, e);
+#else
+    QueueInputEvent(&g, e);
+#endif
+}
+
+// Filter duplicate, assign EventId and mouse source, then append to g.InputEventsQueue. Always called from the thread calling NewFrame().
+// - Every event is recorded in g.InputEventsHistory[] when io.ConfigInputEventsHistorySize > 0.
+// - Consecutive mouse move/wheel events of the same source are merged with io.ConfigInputCoalesceMouseEvents,
+//   so the queue (and g.InputEventsTrail[]) doesn't grow with device rate. As UpdateInputEvents() never stops
+//   between two consecutive events of those types, this gives the same result as processing them one by one.
+static void QueueInputEvent(ImGuiContext* ctx, ImGuiInputEvent* e)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiIO& io = g.IO;
+    if (e->Type == ImGuiInputEventType_None)
+    {
+        // Latched mouse source (see AddMouseSourceEvent())
+        g.InputEventsNextMouseSource = e->MousePos.MouseSource;
+        return;
+    }
+    if (e->Type == ImGuiInputEventType_MousePos)
+    {
+        const ImGuiInputEvent* latest_event = FindLatestInputEvent(&g, ImGuiInputEventType_MousePos);
+        const ImVec2 latest_pos = latest_event ? ImVec2(latest_event->MousePos.PosX, latest_event->MousePos.PosY) : io.MousePos;
+        if (latest_pos.x == e->MousePos.PosX && latest_pos.y == e->MousePos.PosY)
+            return;
+        e->MousePos.MouseSource = g.InputEventsNextMouseSource;
+    }
+    else if (e->Type == ImGuiInputEventType_MouseButton)
+    {
+        const ImGuiInputEvent* latest_event = FindLatestInputEvent(&g, ImGuiInputEventType_MouseButton, e->MouseButton.Button);
+        const bool latest_button_down = latest_event ? latest_event->MouseButton.Down : io.MouseDown[e->MouseButton.Button];
+        if (latest_button_down == e->MouseButton.Down)
+            return;
+        e->MouseButton.MouseSource = g.InputEventsNextMouseSource;
+    }
+    else if (e->Type == ImGuiInputEventType_MouseWheel)
+    {
+        e->MouseWheel.MouseSource = g.InputEventsNextMouseSource;
+    }
+    else if (e->Type == ImGuiInputEventType_Key)
+    {
+        // Verify that backend isn't mixing up using new io.AddKeyEvent() api and old io.KeysDown[] + io.KeyMap[] data.
+        const ImGuiKey key = e->Key.Key;
+#ifndef IMGUI_DISABLE_OBSOLETE_KEYIO
+        IM_ASSERT((io.BackendUsingLegacyKeyArrays == -1 || io.BackendUsingLegacyKeyArrays == 0) && "Backend needs to either only use io.AddKeyEvent(), either only fill legacy io.KeysDown[] + io.KeyMap[]. Not both!");
+        if (io.BackendUsingLegacyKeyArrays == -1)
+            for (int n = ImGuiKey_NamedKey_BEGIN; n < ImGuiKey_NamedKey_END; n++)
+                IM_ASSERT(io.KeyMap[n] == -1 && "Backend needs to either only use io.AddKeyEvent(), either only fill legacy io.KeysDown[] + io.KeyMap[]. Not both!");
+        io.BackendUsingLegacyKeyArrays = 0;
+#endif
+        if (ImGui::IsGamepadKey(key))
+            io.BackendUsingLegacyNavInputArray = false;
+
+        // Filter duplicate (in particular: key mods and gamepad analog values are commonly spammed)
+        const ImGuiInputEvent* latest_event = FindLatestInputEvent(&g, ImGuiInputEventType_Key, (int)key);
+        const ImGuiKeyData* key_data = ImGui::GetKeyData(&g, key);
+        const bool latest_key_down = latest_event ? latest_event->Key.Down : key_data->Down;
+        const float latest_key_analog = latest_event ? latest_event->Key.AnalogValue : key_data->AnalogValue;
+        if (latest_key_down == e->Key.Down && latest_key_analog == e->Key.AnalogValue)
+            return;
+    }
+    else if (e->Type == ImGuiInputEventType_Focus)
+    {
+        const ImGuiInputEvent* latest_event = FindLatestInputEvent(&g, ImGuiInputEventType_Focus);
+        const bool latest_focused = latest_event ? latest_event->AppFocused.Focused : !io.AppFocusLost;
+        if (latest_focused == e->AppFocused.Focused || (io.ConfigDebugIgnoreFocusLoss && !e->AppFocused.Focused))
+            return;
+    }
+    e->EventId = g.InputEventsNextEventId++;
+
+    // Record in history ring buffer
+    if (io.ConfigInputEventsHistorySize > 0)
+    {
+        if (g.InputEventsHistory.Size != io.ConfigInputEventsHistorySize)
+        {
+            g.InputEventsHistory.resize(io.ConfigInputEventsHistorySize);
+            g.InputEventsHistoryHead = g.InputEventsHistoryCount = 0;
+        }
+        g.InputEventsHistory[g.InputEventsHistoryHead] = *e;
+        g.InputEventsHistoryHead = (g.InputEventsHistoryHead + 1) % g.InputEventsHistory.Size;
+        g.InputEventsHistoryCount = ImMin(g.InputEventsHistoryCount + 1, g.InputEventsHistory.Size);
+    }
+    else if (g.InputEventsHistory.Size > 0)
+    {
+        g.InputEventsHistory.clear();
+        g.InputEventsHistoryHead = g.InputEventsHistoryCount = 0;
+    }
+
+    // Merge with previous event
+    ImGuiInputEvent* prev = g.InputEventsQueue.Size > 0 ? &g.InputEventsQueue.back() : NULL;
+    if (io.ConfigInputCoalesceMouseEvents && prev != NULL && prev->Type == e->Type && !prev->AddedByTestEngine && !e->AddedByTestEngine)
+    {
+        if (e->Type == ImGuiInputEventType_MousePos && prev->MousePos.MouseSource == e->MousePos.MouseSource)
+        {
+            prev->MousePos = e->MousePos;
+            prev->EventId = e->EventId;
+            prev->Timestamp = e->Timestamp;
+            return;
+        }
+        if (e->Type == ImGuiInputEventType_MouseWheel && prev->MouseWheel.MouseSource == e->MouseWheel.MouseSource)
+        {
+            prev->MouseWheel.WheelX += e->MouseWheel.WheelX;
+            prev->MouseWheel.WheelY += e->MouseWheel.WheelY;
+            prev->EventId = e->EventId;
+            prev->Timestamp = e->Timestamp;
+            return;
+        }
+    }
+    g.InputEventsQueue.push_back(*e);
+}
+
+int ImGui::GetInputEventsHistoryCount(ImGuiContext* ctx)
+{
+    ImGuiContext& g = *ctx;
+    return g.InputEventsHistoryCount;
+}
+
+const ImGuiInputEvent* ImGui::GetInputEventsHistory(ImGuiContext* ctx, int n)
+{
+    ImGuiContext& g = *ctx;
+    IM_ASSERT(n >= 0 && n < g.InputEventsHistoryCount);
+    int idx = g.InputEventsHistoryHead - g.InputEventsHistoryCount + n;
+    if (idx < 0)
+        idx += g.InputEventsHistory.Size;
+    return &g.InputEventsHistory[idx];
+}
+
+// Lock-free input events queue for IMGUI_ENABLE_THREADED_INPUT_EVENTS
+// - Bounded multi-producer single-consumer ring buffer. Any thread may push, only NewFrame() pops.
+// - Each slot stores a sequence number: producers claim a position with a CAS on WritePos,
+//   write the event then publish it by storing the sequence. No locks, no allocations after creation.
+// - When the queue is full (e.g. NewFrame() not called for a while) events go to a mutex protected overflow
+//   list instead of being dropped. Producers keep using it until NewFrame() took it, which preserves order.
+
+#ifdef IMGUI_ENABLE_THREADED_INPUT_EVENTS
+
+#ifndef IMGUI_INPUT_EVENTS_RING_SIZE
+#define IMGUI_INPUT_EVENTS_RING_SIZE    4096    // Must be a power of two
+#endif
+
+struct ImGuiInputEventRing
+{
+    struct Slot
+    {
+        std::atomic<ImU32>  Sequence;
+        ImGuiInputEvent     Event;
+    };
+    Slot*                   Slots;
+    ImU32                   Mask;
+    char                    Pad0[64];           // Keep producer and consumer positions on separate cache lines
+    std::atomic<ImU32>      WritePos;           // Written by producer threads
+    std::atomic<bool>       OverflowActive;     // Set when the ring was full, until the consumer took Overflow[]
+    std::atomic<int>        OverflowCount;      // Number of times the ring was full (for Metrics)
+    char                    Pad1[64];
+    ImU32                   ReadPos;            // Only accessed by the consumer (NewFrame)
+    int                     OverflowTaken;      // Next event to return in OverflowTakenEvents[]
+    ImVector<ImGuiInputEvent> OverflowTakenEvents;
+    std::mutex              OverflowMutex;      // Protect Overflow[]
+    ImVector<ImGuiInputEvent> Overflow;
+};
+
+static ImGuiInputEventRing* InputEventRingCreate()
+{
+    IM_STATIC_ASSERT((IMGUI_INPUT_EVENTS_RING_SIZE & (IMGUI_INPUT_EVENTS_RING_SIZE - 1)) == 0);
+    ImGuiInputEventRing* ring = IM_NEW(ImGuiInputEventRing)();
+    ring->Slots = (ImGuiInputEventRing::Slot*)IM_ALLOC(sizeof(ImGuiInputEventRing::Slot) * IMGUI_INPUT_EVENTS_RING_SIZE);
+    for (ImU32 n = 0; n < IMGUI_INPUT_EVENTS_RING_SIZE; n++)
+    {
+        IM_PLACEMENT_NEW(&ring->Slots[n]) ImGuiInputEventRing::Slot();
+        ring->Slots[n].Sequence.store(n, std::memory_order_relaxed);
+    }
+    ring->Mask = IMGUI_INPUT_EVENTS_RING_SIZE - 1;
+    ring->WritePos.store(0, std::memory_order_relaxed);
+    ring->OverflowActive.store(false, std::memory_order_relaxed);
+    ring->ReadPos = 0;
+    ring->OverflowCount.store(0, std::memory_order_relaxed);
+    ring->OverflowTaken = 0;
+    return ring;
+}
+
+static void InputEventRingDestroy(ImGuiInputEventRing* ring)
+{
+    if (ring == NULL)
+        return;
+    for (ImU32 n = 0; n <= ring->Mask; n++)
+        ring->Slots[n].~Slot();
+    IM_FREE(ring->Slots);
+    IM_DELETE(ring);
+}
+
+static void InputEventRingPush(ImGuiInputEventRing* ring, const ImGuiInputEvent* e)
+{
+    // Keep appending to overflow list until the consumer took it, so events stay ordered
+    if (ring->OverflowActive.load(std::memory_order_acquire))
+    {
+        std::lock_guard<std::mutex> lock(ring->OverflowMutex);
+        if (ring->OverflowActive.load(std::memory_order_relaxed))
+        {
+            ring->Overflow.push_back(*e);
+            return;
+        }
+    }
+
+    ImU32 pos = ring->WritePos.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        ImGuiInputEventRing::Slot* slot = &ring->Slots[pos & ring->Mask];
+        const ImU32 seq = slot->Sequence.load(std::memory_order_acquire);
+        const int diff = (int)(seq - pos);
+        if (diff == 0)
+        {
+            // Slot is free: try to claim it (on failure 'pos' is reloaded with the current value)
+            if (ring->WritePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                slot->Event = *e;
+                slot->Sequence.store(pos + 1, std::memory_order_release);
+                return;
+            }
+        }
+        else if (diff < 0)
+        {
+            // Full: consumer hasn't released this slot yet
+            std::lock_guard<std::mutex> lock(ring->OverflowMutex);
+            if (!ring->OverflowActive.load(std::memory_order_relaxed))
+                ring->OverflowCount.fetch_add(1, std::memory_order_relaxed);
+            ring->OverflowActive.store(true, std::memory_order_release);
+            ring->Overflow.push_back(*e);
+            return;
+        }
+        else
+        {
+            // Another producer claimed this position
+            pos = ring->WritePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+// Call until it returns false. Order: ring, then overflow list (which was filled after the ring), then ring again.
+static bool InputEventRingPop(ImGuiInputEventRing* ring, ImGuiInputEvent* out_e)
+{
+    if (ring->OverflowTaken < ring->OverflowTakenEvents.Size)
+    {
+        *out_e = ring->OverflowTakenEvents[ring->OverflowTaken++];
+        return true;
+    }
+
+    ImGuiInputEventRing::Slot* slot = &ring->Slots[ring->ReadPos & ring->Mask];
+    const ImU32 seq = slot->Sequence.load(std::memory_order_acquire);
+    if ((int)(seq - (ring->ReadPos + 1)) >= 0)
+    {
+        *out_e = slot->Event;
+        slot->Sequence.store(ring->ReadPos + ring->Mask + 1, std::memory_order_release);
+        ring->ReadPos++;
+        return true;
+    }
+
+    // Ring is empty (or next producer hasn't finished writing yet): take the whole overflow list.
+    // Overflow events were submitted after every slot claimed so far, so only take them once all claimed slots have been consumed.
+    // If a producer claimed a slot but hasn't finished writing it, return false and try again on next frame.
+    if (!ring->OverflowActive.load(std::memory_order_acquire))
+        return false;
+    if (ring->WritePos.load(std::memory_order_acquire) != ring->ReadPos)
+        return false;
+    {
+        std::lock_guard<std::mutex> lock(ring->OverflowMutex);
+        ring->OverflowTakenEvents.resize(0);
+        ring->OverflowTakenEvents.swap(ring->Overflow);
+        ring->OverflowActive.store(false, std::memory_order_release);
+    }
+    ring->OverflowTaken = 0;
+    return InputEventRingPop(ring, out_e);
+}
+
+// Consumer side peek (does not pop). Producers may be adding events concurrently, so this is only a snapshot.
+static bool InputEventRingIsEmpty(ImGuiInputEventRing* ring)
+{
+    if (ring->OverflowTaken < ring->OverflowTakenEvents.Size)
+        return false;
+    if (ring->WritePos.load(std::memory_order_acquire) != ring->ReadPos)
+        return false;
+    return !ring->OverflowActive.load(std::memory_order_acquire);
 }
 
+#else
+
+static ImGuiInputEventRing* InputEventRingCreate() { return NULL; }
+static void InputEventRingDestroy(ImGuiInputEventRing*) {}
+static bool InputEventRingPop(ImGuiInputEventRing*, ImGuiInputEvent*) { return false; }
+static bool InputEventRingIsEmpty(ImGuiInputEventRing*) { return true; }
+
+#endif // #ifdef IMGUI_ENABLE_THREADED_INPUT_EVENTS
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (Geometry functions)
 //-----------------------------------------------------------------------------
@@ -1957,39 +2272,212 @@ void ImFormatStringToTempBufferV(ImGuiContext* ctx, const char** out_buf, const
     }
 }
 
-// CRC32 needs a 1KB lookup table (not cache friendly)
+// CRC32 needs a 1KB lookup table (not cache friendly), slicing-by-8 needs 8KB but processes 8 bytes per step.
+// - GCrc32LookupTable[0] is the standard byte-wise table, GCrc32LookupTable[n][i] = (table[n-1][i] >> 8) ^ table[0][table[n-1][i] & 0xFF].
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
 // - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
-static const ImU32 GCrc32LookupTable[256] =
-{
-    0x00000000,0x77073096,0xEE0E612C,0x990951BA,0x076DC419,0x706AF48F,0xE963A535,0x9E6495A3,0x0EDB8832,0x79DCB8A4,0xE0D5E91E,0x97D2D988,0x09B64C2B,0x7EB17CBD,0xE7B82D07,0x90BF1D91,
-    0x1DB71064,0x6AB020F2,0xF3B97148,0x84BE41DE,0x1ADAD47D,0x6DDDE4EB,0xF4D4B551,0x83D385C7,0x136C9856,0x646BA8C0,0xFD62F97A,0x8A65C9EC,0x14015C4F,0x63066CD9,0xFA0F3D63,0x8D080DF5,
-    0x3B6E20C8,0x4C69105E,0xD56041E4,0xA2677172,0x3C03E4D1,0x4B04D447,0xD20D85FD,0xA50AB56B,0x35B5A8FA,0x42B2986C,0xDBBBC9D6,0xACBCF940,0x32D86CE3,0x45DF5C75,0xDCD60DCF,0xABD13D59,
-    0x26D930AC,0x51DE003A,0xC8D75180,0xBFD06116,0x21B4F4B5,0x56B3C423,0xCFBA9599,0xB8BDA50F,0x2802B89E,0x5F058808,0xC60CD9B2,0xB10BE924,0x2F6F7C87,0x58684C11,0xC1611DAB,0xB6662D3D,
-    0x76DC4190,0x01DB7106,0x98D220BC,0xEFD5102A,0x71B18589,0x06B6B51F,0x9FBFE4A5,0xE8B8D433,0x7807C9A2,0x0F00F934,0x9609A88E,0xE10E9818,0x7F6A0DBB,0x086D3D2D,0x91646C97,0xE6635C01,
-    0x6B6B51F4,0x1C6C6162,0x856530D8,0xF262004E,0x6C0695ED,0x1B01A57B,0x8208F4C1,0xF50FC457,0x65B0D9C6,0x12B7E950,0x8BBEB8EA,0xFCB9887C,0x62DD1DDF,0x15DA2D49,0x8CD37CF3,0xFBD44C65,
-    0x4DB26158,0x3AB551CE,0xA3BC0074,0xD4BB30E2,0x4ADFA541,0x3DD895D7,0xA4D1C46D,0xD3D6F4FB,0x4369E96A,0x346ED9FC,0xAD678846,0xDA60B8D0,0x44042D73,0x33031DE5,0xAA0A4C5F,0xDD0D7CC9,
-    0x5005713C,0x270241AA,0xBE0B1010,0xC90C2086,0x5768B525,0x206F85B3,0xB966D409,0xCE61E49F,0x5EDEF90E,0x29D9C998,0xB0D09822,0xC7D7A8B4,0x59B33D17,0x2EB40D81,0xB7BD5C3B,0xC0BA6CAD,
-    0xEDB88320,0x9ABFB3B6,0x03B6E20C,0x74B1D29A,0xEAD54739,0x9DD277AF,0x04DB2615,0x73DC1683,0xE3630B12,0x94643B84,0x0D6D6A3E,0x7A6A5AA8,0xE40ECF0B,0x9309FF9D,0x0A00AE27,0x7D079EB1,
-    0xF00F9344,0x8708A3D2,0x1E01F268,0x6906C2FE,0xF762575D,0x806567CB,0x196C3671,0x6E6B06E7,0xFED41B76,0x89D32BE0,0x10DA7A5A,0x67DD4ACC,0xF9B9DF6F,0x8EBEEFF9,0x17B7BE43,0x60B08ED5,
-    0xD6D6A3E8,0xA1D1937E,0x38D8C2C4,0x4FDFF252,0xD1BB67F1,0xA6BC5767,0x3FB506DD,0x48B2364B,0xD80D2BDA,0xAF0A1B4C,0x36034AF6,0x41047A60,0xDF60EFC3,0xA867DF55,0x316E8EEF,0x4669BE79,
-    0xCB61B38C,0xBC66831A,0x256FD2A0,0x5268E236,0xCC0C7795,0xBB0B4703,0x220216B9,0x5505262F,0xC5BA3BBE,0xB2BD0B28,0x2BB45A92,0x5CB36A04,0xC2D7FFA7,0xB5D0CF31,0x2CD99E8B,0x5BDEAE1D,
-    0x9B64C2B0,0xEC63F226,0x756AA39C,0x026D930A,0x9C0906A9,0xEB0E363F,0x72076785,0x05005713,0x95BF4A82,0xE2B87A14,0x7BB12BAE,0x0CB61B38,0x92D28E9B,0xE5D5BE0D,0x7CDCEFB7,0x0BDBDF21,
-    0x86D3D2D4,0xF1D4E242,0x68DDB3F8,0x1FDA836E,0x81BE16CD,0xF6B9265B,0x6FB077E1,0x18B74777,0x88085AE6,0xFF0F6A70,0x66063BCA,0x11010B5C,0x8F659EFF,0xF862AE69,0x616BFFD3,0x166CCF45,
-    0xA00AE278,0xD70DD2EE,0x4E048354,0x3903B3C2,0xA7672661,0xD06016F7,0x4969474D,0x3E6E77DB,0xAED16A4A,0xD9D65ADC,0x40DF0B66,0x37D83BF0,0xA9BCAE53,0xDEBB9EC5,0x47B2CF7F,0x30B5FFE9,
-    0xBDBDF21C,0xCABAC28A,0x53B39330,0x24B4A3A6,0xBAD03605,0xCDD70693,0x54DE5729,0x23D967BF,0xB3667A2E,0xC4614AB8,0x5D681B02,0x2A6F2B94,0xB40BBE37,0xC30C8EA1,0x5A05DF1B,0x2D02EF8D,
+static const ImU32 GCrc32LookupTable[8][256] =
+{
+    {
+        0x00000000,0x77073096,0xEE0E612C,0x990951BA,0x076DC419,0x706AF48F,0xE963A535,0x9E6495A3,0x0EDB8832,0x79DCB8A4,0xE0D5E91E,0x97D2D988,0x09B64C2B,0x7EB17CBD,0xE7B82D07,0x90BF1D91,
+        0x1DB71064,0x6AB020F2,0xF3B97148,0x84BE41DE,0x1ADAD47D,0x6DDDE4EB,0xF4D4B551,0x83D385C7,0x136C9856,0x646BA8C0,0xFD62F97A,0x8A65C9EC,0x14015C4F,0x63066CD9,0xFA0F3D63,0x8D080DF5,
+        0x3B6E20C8,0x4C69105E,0xD56041E4,0xA2677172,0x3C03E4D1,0x4B04D447,0xD20D85FD,0xA50AB56B,0x35B5A8FA,0x42B2986C,0xDBBBC9D6,0xACBCF940,0x32D86CE3,0x45DF5C75,0xDCD60DCF,0xABD13D59,
+        0x26D930AC,0x51DE003A,0xC8D75180,0xBFD06116,0x21B4F4B5,0x56B3C423,0xCFBA9599,0xB8BDA50F,0x2802B89E,0x5F058808,0xC60CD9B2,0xB10BE924,0x2F6F7C87,0x58684C11,0xC1611DAB,0xB6662D3D,
+        0x76DC4190,0x01DB7106,0x98D220BC,0xEFD5102A,0x71B18589,0x06B6B51F,0x9FBFE4A5,0xE8B8D433,0x7807C9A2,0x0F00F934,0x9609A88E,0xE10E9818,0x7F6A0DBB,0x086D3D2D,0x91646C97,0xE6635C01,
+        0x6B6B51F4,0x1C6C6162,0x856530D8,0xF262004E,0x6C0695ED,0x1B01A57B,0x8208F4C1,0xF50FC457,0x65B0D9C6,0x12B7E950,0x8BBEB8EA,0xFCB9887C,0x62DD1DDF,0x15DA2D49,0x8CD37CF3,0xFBD44C65,
+        0x4DB26158,0x3AB551CE,0xA3BC0074,0xD4BB30E2,0x4ADFA541,0x3DD895D7,0xA4D1C46D,0xD3D6F4FB,0x4369E96A,0x346ED9FC,0xAD678846,0xDA60B8D0,0x44042D73,0x33031DE5,0xAA0A4C5F,0xDD0D7CC9,
+        0x5005713C,0x270241AA,0xBE0B1010,0xC90C2086,0x5768B525,0x206F85B3,0xB966D409,0xCE61E49F,0x5EDEF90E,0x29D9C998,0xB0D09822,0xC7D7A8B4,0x59B33D17,0x2EB40D81,0xB7BD5C3B,0xC0BA6CAD,
+        0xEDB88320,0x9ABFB3B6,0x03B6E20C,0x74B1D29A,0xEAD54739,0x9DD277AF,0x04DB2615,0x73DC1683,0xE3630B12,0x94643B84,0x0D6D6A3E,0x7A6A5AA8,0xE40ECF0B,0x9309FF9D,0x0A00AE27,0x7D079EB1,
+        0xF00F9344,0x8708A3D2,0x1E01F268,0x6906C2FE,0xF762575D,0x806567CB,0x196C3671,0x6E6B06E7,0xFED41B76,0x89D32BE0,0x10DA7A5A,0x67DD4ACC,0xF9B9DF6F,0x8EBEEFF9,0x17B7BE43,0x60B08ED5,
+        0xD6D6A3E8,0xA1D1937E,0x38D8C2C4,0x4FDFF252,0xD1BB67F1,0xA6BC5767,0x3FB506DD,0x48B2364B,0xD80D2BDA,0xAF0A1B4C,0x36034AF6,0x41047A60,0xDF60EFC3,0xA867DF55,0x316E8EEF,0x4669BE79,
+        0xCB61B38C,0xBC66831A,0x256FD2A0,0x5268E236,0xCC0C7795,0xBB0B4703,0x220216B9,0x5505262F,0xC5BA3BBE,0xB2BD0B28,0x2BB45A92,0x5CB36A04,0xC2D7FFA7,0xB5D0CF31,0x2CD99E8B,0x5BDEAE1D,
+        0x9B64C2B0,0xEC63F226,0x756AA39C,0x026D930A,0x9C0906A9,0xEB0E363F,0x72076785,0x05005713,0x95BF4A82,0xE2B87A14,0x7BB12BAE,0x0CB61B38,0x92D28E9B,0xE5D5BE0D,0x7CDCEFB7,0x0BDBDF21,
+        0x86D3D2D4,0xF1D4E242,0x68DDB3F8,0x1FDA836E,0x81BE16CD,0xF6B9265B,0x6FB077E1,0x18B74777,0x88085AE6,0xFF0F6A70,0x66063BCA,0x11010B5C,0x8F659EFF,0xF862AE69,0x616BFFD3,0x166CCF45,
+        0xA00AE278,0xD70DD2EE,0x4E048354,0x3903B3C2,0xA7672661,0xD06016F7,0x4969474D,0x3E6E77DB,0xAED16A4A,0xD9D65ADC,0x40DF0B66,0x37D83BF0,0xA9BCAE53,0xDEBB9EC5,0x47B2CF7F,0x30B5FFE9,
+        0xBDBDF21C,0xCABAC28A,0x53B39330,0x24B4A3A6,0xBAD03605,0xCDD70693,0x54DE5729,0x23D967BF,0xB3667A2E,0xC4614AB8,0x5D681B02,0x2A6F2B94,0xB40BBE37,0xC30C8EA1,0x5A05DF1B,0x2D02EF8D,
+    },
+    {
+        0x00000000,0x191B3141,0x32366282,0x2B2D53C3,0x646CC504,0x7D77F445,0x565AA786,0x4F4196C7,0xC8D98A08,0xD1C2BB49,0xFAEFE88A,0xE3F4D9CB,0xACB54F0C,0xB5AE7E4D,0x9E832D8E,0x87981CCF,
+        0x4AC21251,0x53D92310,0x78F470D3,0x61EF4192,0x2EAED755,0x37B5E614,0x1C98B5D7,0x05838496,0x821B9859,0x9B00A918,0xB02DFADB,0xA936CB9A,0xE6775D5D,0xFF6C6C1C,0xD4413FDF,0xCD5A0E9E,
+        0x958424A2,0x8C9F15E3,0xA7B24620,0xBEA97761,0xF1E8E1A6,0xE8F3D0E7,0xC3DE8324,0xDAC5B265,0x5D5DAEAA,0x44469FEB,0x6F6BCC28,0x7670FD69,0x39316BAE,0x202A5AEF,0x0B07092C,0x121C386D,
+        0xDF4636F3,0xC65D07B2,0xED705471,0xF46B6530,0xBB2AF3F7,0xA231C2B6,0x891C9175,0x9007A034,0x179FBCFB,0x0E848DBA,0x25A9DE79,0x3CB2EF38,0x73F379FF,0x6AE848BE,0x41C51B7D,0x58DE2A3C,
+        0xF0794F05,0xE9627E44,0xC24F2D87,0xDB541CC6,0x94158A01,0x8D0EBB40,0xA623E883,0xBF38D9C2,0x38A0C50D,0x21BBF44C,0x0A96A78F,0x138D96CE,0x5CCC0009,0x45D73148,0x6EFA628B,0x77E153CA,
+        0xBABB5D54,0xA3A06C15,0x888D3FD6,0x91960E97,0xDED79850,0xC7CCA911,0xECE1FAD2,0xF5FACB93,0x7262D75C,0x6B79E61D,0x4054B5DE,0x594F849F,0x160E1258,0x0F152319,0x243870DA,0x3D23419B,
+        0x65FD6BA7,0x7CE65AE6,0x57CB0925,0x4ED03864,0x0191AEA3,0x188A9FE2,0x33A7CC21,0x2ABCFD60,0xAD24E1AF,0xB43FD0EE,0x9F12832D,0x8609B26C,0xC94824AB,0xD05315EA,0xFB7E4629,0xE2657768,
+        0x2F3F79F6,0x362448B7,0x1D091B74,0x04122A35,0x4B53BCF2,0x52488DB3,0x7965DE70,0x607EEF31,0xE7E6F3FE,0xFEFDC2BF,0xD5D0917C,0xCCCBA03D,0x838A36FA,0x9A9107BB,0xB1BC5478,0xA8A76539,
+        0x3B83984B,0x2298A90A,0x09B5FAC9,0x10AECB88,0x5FEF5D4F,0x46F46C0E,0x6DD93FCD,0x74C20E8C,0xF35A1243,0xEA412302,0xC16C70C1,0xD8774180,0x9736D747,0x8E2DE606,0xA500B5C5,0xBC1B8484,
+        0x71418A1A,0x685ABB5B,0x4377E898,0x5A6CD9D9,0x152D4F1E,0x0C367E5F,0x271B2D9C,0x3E001CDD,0xB9980012,0xA0833153,0x8BAE6290,0x92B553D1,0xDDF4C516,0xC4EFF457,0xEFC2A794,0xF6D996D5,
+        0xAE07BCE9,0xB71C8DA8,0x9C31DE6B,0x852AEF2A,0xCA6B79ED,0xD37048AC,0xF85D1B6F,0xE1462A2E,0x66DE36E1,0x7FC507A0,0x54E85463,0x4DF36522,0x02B2F3E5,0x1BA9C2A4,0x30849167,0x299FA026,
+        0xE4C5AEB8,0xFDDE9FF9,0xD6F3CC3A,0xCFE8FD7B,0x80A96BBC,0x99B25AFD,0xB29F093E,0xAB84387F,0x2C1C24B0,0x350715F1,0x1E2A4632,0x07317773,0x4870E1B4,0x516BD0F5,0x7A468336,0x635DB277,
+        0xCBFAD74E,0xD2E1E60F,0xF9CCB5CC,0xE0D7848D,0xAF96124A,0xB68D230B,0x9DA070C8,0x84BB4189,0x03235D46,0x1A386C07,0x31153FC4,0x280E0E85,0x674F9842,0x7E54A903,0x5579FAC0,0x4C62CB81,
+        0x8138C51F,0x9823F45E,0xB30EA79D,0xAA1596DC,0xE554001B,0xFC4F315A,0xD7626299,0xCE7953D8,0x49E14F17,0x50FA7E56,0x7BD72D95,0x62CC1CD4,0x2D8D8A13,0x3496BB52,0x1FBBE891,0x06A0D9D0,
+        0x5E7EF3EC,0x4765C2AD,0x6C48916E,0x7553A02F,0x3A1236E8,0x230907A9,0x0824546A,0x113F652B,0x96A779E4,0x8FBC48A5,0xA4911B66,0xBD8A2A27,0xF2CBBCE0,0xEBD08DA1,0xC0FDDE62,0xD9E6EF23,
+        0x14BCE1BD,0x0DA7D0FC,0x268A833F,0x3F91B27E,0x70D024B9,0x69CB15F8,0x42E6463B,0x5BFD777A,0xDC656BB5,0xC57E5AF4,0xEE530937,0xF7483876,0xB809AEB1,0xA1129FF0,0x8A3FCC33,0x9324FD72,
+    },
+    {
+        0x00000000,0x01C26A37,0x0384D46E,0x0246BE59,0x0709A8DC,0x06CBC2EB,0x048D7CB2,0x054F1685,0x0E1351B8,0x0FD13B8F,0x0D9785D6,0x0C55EFE1,0x091AF964,0x08D89353,0x0A9E2D0A,0x0B5C473D,
+        0x1C26A370,0x1DE4C947,0x1FA2771E,0x1E601D29,0x1B2F0BAC,0x1AED619B,0x18ABDFC2,0x1969B5F5,0x1235F2C8,0x13F798FF,0x11B126A6,0x10734C91,0x153C5A14,0x14FE3023,0x16B88E7A,0x177AE44D,
+        0x384D46E0,0x398F2CD7,0x3BC9928E,0x3A0BF8B9,0x3F44EE3C,0x3E86840B,0x3CC03A52,0x3D025065,0x365E1758,0x379C7D6F,0x35DAC336,0x3418A901,0x3157BF84,0x3095D5B3,0x32D36BEA,0x331101DD,
+        0x246BE590,0x25A98FA7,0x27EF31FE,0x262D5BC9,0x23624D4C,0x22A0277B,0x20E69922,0x2124F315,0x2A78B428,0x2BBADE1F,0x29FC6046,0x283E0A71,0x2D711CF4,0x2CB376C3,0x2EF5C89A,0x2F37A2AD,
+        0x709A8DC0,0x7158E7F7,0x731E59AE,0x72DC3399,0x7793251C,0x76514F2B,0x7417F172,0x75D59B45,0x7E89DC78,0x7F4BB64F,0x7D0D0816,0x7CCF6221,0x798074A4,0x78421E93,0x7A04A0CA,0x7BC6CAFD,
+        0x6CBC2EB0,0x6D7E4487,0x6F38FADE,0x6EFA90E9,0x6BB5866C,0x6A77EC5B,0x68315202,0x69F33835,0x62AF7F08,0x636D153F,0x612BAB66,0x60E9C151,0x65A6D7D4,0x6464BDE3,0x662203BA,0x67E0698D,
+        0x48D7CB20,0x4915A117,0x4B531F4E,0x4A917579,0x4FDE63FC,0x4E1C09CB,0x4C5AB792,0x4D98DDA5,0x46C49A98,0x4706F0AF,0x45404EF6,0x448224C1,0x41CD3244,0x400F5873,0x4249E62A,0x438B8C1D,
+        0x54F16850,0x55330267,0x5775BC3E,0x56B7D609,0x53F8C08C,0x523AAABB,0x507C14E2,0x51BE7ED5,0x5AE239E8,0x5B2053DF,0x5966ED86,0x58A487B1,0x5DEB9134,0x5C29FB03,0x5E6F455A,0x5FAD2F6D,
+        0xE1351B80,0xE0F771B7,0xE2B1CFEE,0xE373A5D9,0xE63CB35C,0xE7FED96B,0xE5B86732,0xE47A0D05,0xEF264A38,0xEEE4200F,0xECA29E56,0xED60F461,0xE82FE2E4,0xE9ED88D3,0xEBAB368A,0xEA695CBD,
+        0xFD13B8F0,0xFCD1D2C7,0xFE976C9E,0xFF5506A9,0xFA1A102C,0xFBD87A1B,0xF99EC442,0xF85CAE75,0xF300E948,0xF2C2837F,0xF0843D26,0xF1465711,0xF4094194,0xF5CB2BA3,0xF78D95FA,0xF64FFFCD,
+        0xD9785D60,0xD8BA3757,0xDAFC890E,0xDB3EE339,0xDE71F5BC,0xDFB39F8B,0xDDF521D2,0xDC374BE5,0xD76B0CD8,0xD6A966EF,0xD4EFD8B6,0xD52DB281,0xD062A404,0xD1A0CE33,0xD3E6706A,0xD2241A5D,
+        0xC55EFE10,0xC49C9427,0xC6DA2A7E,0xC7184049,0xC25756CC,0xC3953CFB,0xC1D382A2,0xC011E895,0xCB4DAFA8,0xCA8FC59F,0xC8C97BC6,0xC90B11F1,0xCC440774,0xCD866D43,0xCFC0D31A,0xCE02B92D,
+        0x91AF9640,0x906DFC77,0x922B422E,0x93E92819,0x96A63E9C,0x976454AB,0x9522EAF2,0x94E080C5,0x9FBCC7F8,0x9E7EADCF,0x9C381396,0x9DFA79A1,0x98B56F24,0x99770513,0x9B31BB4A,0x9AF3D17D,
+        0x8D893530,0x8C4B5F07,0x8E0DE15E,0x8FCF8B69,0x8A809DEC,0x8B42F7DB,0x89044982,0x88C623B5,0x839A6488,0x82580EBF,0x801EB0E6,0x81DCDAD1,0x8493CC54,0x8551A663,0x8717183A,0x86D5720D,
+        0xA9E2D0A0,0xA820BA97,0xAA6604CE,0xABA46EF9,0xAEEB787C,0xAF29124B,0xAD6FAC12,0xACADC625,0xA7F18118,0xA633EB2F,0xA4755576,0xA5B73F41,0xA0F829C4,0xA13A43F3,0xA37CFDAA,0xA2BE979D,
+        0xB5C473D0,0xB40619E7,0xB640A7BE,0xB782CD89,0xB2CDDB0C,0xB30FB13B,0xB1490F62,0xB08B6555,0xBBD72268,0xBA15485F,0xB853F606,0xB9919C31,0xBCDE8AB4,0xBD1CE083,0xBF5A5EDA,0xBE9834ED,
+    },
+    {
+        0x00000000,0xB8BC6765,0xAA09C88B,0x12B5AFEE,0x8F629757,0x37DEF032,0x256B5FDC,0x9DD738B9,0xC5B428EF,0x7D084F8A,0x6FBDE064,0xD7018701,0x4AD6BFB8,0xF26AD8DD,0xE0DF7733,0x58631056,
+        0x5019579F,0xE8A530FA,0xFA109F14,0x42ACF871,0xDF7BC0C8,0x67C7A7AD,0x75720843,0xCDCE6F26,0x95AD7F70,0x2D111815,0x3FA4B7FB,0x8718D09E,0x1ACFE827,0xA2738F42,0xB0C620AC,0x087A47C9,
+        0xA032AF3E,0x188EC85B,0x0A3B67B5,0xB28700D0,0x2F503869,0x97EC5F0C,0x8559F0E2,0x3DE59787,0x658687D1,0xDD3AE0B4,0xCF8F4F5A,0x7733283F,0xEAE41086,0x525877E3,0x40EDD80D,0xF851BF68,
+        0xF02BF8A1,0x48979FC4,0x5A22302A,0xE29E574F,0x7F496FF6,0xC7F50893,0xD540A77D,0x6DFCC018,0x359FD04E,0x8D23B72B,0x9F9618C5,0x272A7FA0,0xBAFD4719,0x0241207C,0x10F48F92,0xA848E8F7,
+        0x9B14583D,0x23A83F58,0x311D90B6,0x89A1F7D3,0x1476CF6A,0xACCAA80F,0xBE7F07E1,0x06C36084,0x5EA070D2,0xE61C17B7,0xF4A9B859,0x4C15DF3C,0xD1C2E785,0x697E80E0,0x7BCB2F0E,0xC377486B,
+        0xCB0D0FA2,0x73B168C7,0x6104C729,0xD9B8A04C,0x446F98F5,0xFCD3FF90,0xEE66507E,0x56DA371B,0x0EB9274D,0xB6054028,0xA4B0EFC6,0x1C0C88A3,0x81DBB01A,0x3967D77F,0x2BD27891,0x936E1FF4,
+        0x3B26F703,0x839A9066,0x912F3F88,0x299358ED,0xB4446054,0x0CF80731,0x1E4DA8DF,0xA6F1CFBA,0xFE92DFEC,0x462EB889,0x549B1767,0xEC277002,0x71F048BB,0xC94C2FDE,0xDBF98030,0x6345E755,
+        0x6B3FA09C,0xD383C7F9,0xC1366817,0x798A0F72,0xE45D37CB,0x5CE150AE,0x4E54FF40,0xF6E89825,0xAE8B8873,0x1637EF16,0x048240F8,0xBC3E279D,0x21E91F24,0x99557841,0x8BE0D7AF,0x335CB0CA,
+        0xED59B63B,0x55E5D15E,0x47507EB0,0xFFEC19D5,0x623B216C,0xDA874609,0xC832E9E7,0x708E8E82,0x28ED9ED4,0x9051F9B1,0x82E4565F,0x3A58313A,0xA78F0983,0x1F336EE6,0x0D86C108,0xB53AA66D,
+        0xBD40E1A4,0x05FC86C1,0x1749292F,0xAFF54E4A,0x322276F3,0x8A9E1196,0x982BBE78,0x2097D91D,0x78F4C94B,0xC048AE2E,0xD2FD01C0,0x6A4166A5,0xF7965E1C,0x4F2A3979,0x5D9F9697,0xE523F1F2,
+        0x4D6B1905,0xF5D77E60,0xE762D18E,0x5FDEB6EB,0xC2098E52,0x7AB5E937,0x680046D9,0xD0BC21BC,0x88DF31EA,0x3063568F,0x22D6F961,0x9A6A9E04,0x07BDA6BD,0xBF01C1D8,0xADB46E36,0x15080953,
+        0x1D724E9A,0xA5CE29FF,0xB77B8611,0x0FC7E174,0x9210D9CD,0x2AACBEA8,0x38191146,0x80A57623,0xD8C66675,0x607A0110,0x72CFAEFE,0xCA73C99B,0x57A4F122,0xEF189647,0xFDAD39A9,0x45115ECC,
+        0x764DEE06,0xCEF18963,0xDC44268D,0x64F841E8,0xF92F7951,0x41931E34,0x5326B1DA,0xEB9AD6BF,0xB3F9C6E9,0x0B45A18C,0x19F00E62,0xA14C6907,0x3C9B51BE,0x842736DB,0x96929935,0x2E2EFE50,
+        0x2654B999,0x9EE8DEFC,0x8C5D7112,0x34E11677,0xA9362ECE,0x118A49AB,0x033FE645,0xBB838120,0xE3E09176,0x5B5CF613,0x49E959FD,0xF1553E98,0x6C820621,0xD43E6144,0xC68BCEAA,0x7E37A9CF,
+        0xD67F4138,0x6EC3265D,0x7C7689B3,0xC4CAEED6,0x591DD66F,0xE1A1B10A,0xF3141EE4,0x4BA87981,0x13CB69D7,0xAB770EB2,0xB9C2A15C,0x017EC639,0x9CA9FE80,0x241599E5,0x36A0360B,0x8E1C516E,
+        0x866616A7,0x3EDA71C2,0x2C6FDE2C,0x94D3B949,0x090481F0,0xB1B8E695,0xA30D497B,0x1BB12E1E,0x43D23E48,0xFB6E592D,0xE9DBF6C3,0x516791A6,0xCCB0A91F,0x740CCE7A,0x66B96194,0xDE0506F1,
+    },
+    {
+        0x00000000,0x3D6029B0,0x7AC05360,0x47A07AD0,0xF580A6C0,0xC8E08F70,0x8F40F5A0,0xB220DC10,0x30704BC1,0x0D106271,0x4AB018A1,0x77D03111,0xC5F0ED01,0xF890C4B1,0xBF30BE61,0x825097D1,
+        0x60E09782,0x5D80BE32,0x1A20C4E2,0x2740ED52,0x95603142,0xA80018F2,0xEFA06222,0xD2C04B92,0x5090DC43,0x6DF0F5F3,0x2A508F23,0x1730A693,0xA5107A83,0x98705333,0xDFD029E3,0xE2B00053,
+        0xC1C12F04,0xFCA106B4,0xBB017C64,0x866155D4,0x344189C4,0x0921A074,0x4E81DAA4,0x73E1F314,0xF1B164C5,0xCCD14D75,0x8B7137A5,0xB6111E15,0x0431C205,0x3951EBB5,0x7EF19165,0x4391B8D5,
+        0xA121B886,0x9C419136,0xDBE1EBE6,0xE681C256,0x54A11E46,0x69C137F6,0x2E614D26,0x13016496,0x9151F347,0xAC31DAF7,0xEB91A027,0xD6F18997,0x64D15587,0x59B17C37,0x1E1106E7,0x23712F57,
+        0x58F35849,0x659371F9,0x22330B29,0x1F532299,0xAD73FE89,0x9013D739,0xD7B3ADE9,0xEAD38459,0x68831388,0x55E33A38,0x124340E8,0x2F236958,0x9D03B548,0xA0639CF8,0xE7C3E628,0xDAA3CF98,
+        0x3813CFCB,0x0573E67B,0x42D39CAB,0x7FB3B51B,0xCD93690B,0xF0F340BB,0xB7533A6B,0x8A3313DB,0x0863840A,0x3503ADBA,0x72A3D76A,0x4FC3FEDA,0xFDE322CA,0xC0830B7A,0x872371AA,0xBA43581A,
+        0x9932774D,0xA4525EFD,0xE3F2242D,0xDE920D9D,0x6CB2D18D,0x51D2F83D,0x167282ED,0x2B12AB5D,0xA9423C8C,0x9422153C,0xD3826FEC,0xEEE2465C,0x5CC29A4C,0x61A2B3FC,0x2602C92C,0x1B62E09C,
+        0xF9D2E0CF,0xC4B2C97F,0x8312B3AF,0xBE729A1F,0x0C52460F,0x31326FBF,0x7692156F,0x4BF23CDF,0xC9A2AB0E,0xF4C282BE,0xB362F86E,0x8E02D1DE,0x3C220DCE,0x0142247E,0x46E25EAE,0x7B82771E,
+        0xB1E6B092,0x8C869922,0xCB26E3F2,0xF646CA42,0x44661652,0x79063FE2,0x3EA64532,0x03C66C82,0x8196FB53,0xBCF6D2E3,0xFB56A833,0xC6368183,0x74165D93,0x49767423,0x0ED60EF3,0x33B62743,
+        0xD1062710,0xEC660EA0,0xABC67470,0x96A65DC0,0x248681D0,0x19E6A860,0x5E46D2B0,0x6326FB00,0xE1766CD1,0xDC164561,0x9BB63FB1,0xA6D61601,0x14F6CA11,0x2996E3A1,0x6E369971,0x5356B0C1,
+        0x70279F96,0x4D47B626,0x0AE7CCF6,0x3787E546,0x85A73956,0xB8C710E6,0xFF676A36,0xC2074386,0x4057D457,0x7D37FDE7,0x3A978737,0x07F7AE87,0xB5D77297,0x88B75B27,0xCF1721F7,0xF2770847,
+        0x10C70814,0x2DA721A4,0x6A075B74,0x576772C4,0xE547AED4,0xD8278764,0x9F87FDB4,0xA2E7D404,0x20B743D5,0x1DD76A65,0x5A7710B5,0x67173905,0xD537E515,0xE857CCA5,0xAFF7B675,0x92979FC5,
+        0xE915E8DB,0xD475C16B,0x93D5BBBB,0xAEB5920B,0x1C954E1B,0x21F567AB,0x66551D7B,0x5B3534CB,0xD965A31A,0xE4058AAA,0xA3A5F07A,0x9EC5D9CA,0x2CE505DA,0x11852C6A,0x562556BA,0x6B457F0A,
+        0x89F57F59,0xB49556E9,0xF3352C39,0xCE550589,0x7C75D999,0x4115F029,0x06B58AF9,0x3BD5A349,0xB9853498,0x84E51D28,0xC34567F8,0xFE254E48,0x4C059258,0x7165BBE8,0x36C5C138,0x0BA5E888,
+        0x28D4C7DF,0x15B4EE6F,0x521494BF,0x6F74BD0F,0xDD54611F,0xE03448AF,0xA794327F,0x9AF41BCF,0x18A48C1E,0x25C4A5AE,0x6264DF7E,0x5F04F6CE,0xED242ADE,0xD044036E,0x97E479BE,0xAA84500E,
+        0x4834505D,0x755479ED,0x32F4033D,0x0F942A8D,0xBDB4F69D,0x80D4DF2D,0xC774A5FD,0xFA148C4D,0x78441B9C,0x4524322C,0x028448FC,0x3FE4614C,0x8DC4BD5C,0xB0A494EC,0xF704EE3C,0xCA64C78C,
+    },
+    {
+        0x00000000,0xCB5CD3A5,0x4DC8A10B,0x869472AE,0x9B914216,0x50CD91B3,0xD659E31D,0x1D0530B8,0xEC53826D,0x270F51C8,0xA19B2366,0x6AC7F0C3,0x77C2C07B,0xBC9E13DE,0x3A0A6170,0xF156B2D5,
+        0x03D6029B,0xC88AD13E,0x4E1EA390,0x85427035,0x9847408D,0x531B9328,0xD58FE186,0x1ED33223,0xEF8580F6,0x24D95353,0xA24D21FD,0x6911F258,0x7414C2E0,0xBF481145,0x39DC63EB,0xF280B04E,
+        0x07AC0536,0xCCF0D693,0x4A64A43D,0x81387798,0x9C3D4720,0x57619485,0xD1F5E62B,0x1AA9358E,0xEBFF875B,0x20A354FE,0xA6372650,0x6D6BF5F5,0x706EC54D,0xBB3216E8,0x3DA66446,0xF6FAB7E3,
+        0x047A07AD,0xCF26D408,0x49B2A6A6,0x82EE7503,0x9FEB45BB,0x54B7961E,0xD223E4B0,0x197F3715,0xE82985C0,0x23755665,0xA5E124CB,0x6EBDF76E,0x73B8C7D6,0xB8E41473,0x3E7066DD,0xF52CB578,
+        0x0F580A6C,0xC404D9C9,0x4290AB67,0x89CC78C2,0x94C9487A,0x5F959BDF,0xD901E971,0x125D3AD4,0xE30B8801,0x28575BA4,0xAEC3290A,0x659FFAAF,0x789ACA17,0xB3C619B2,0x35526B1C,0xFE0EB8B9,
+        0x0C8E08F7,0xC7D2DB52,0x4146A9FC,0x8A1A7A59,0x971F4AE1,0x5C439944,0xDAD7EBEA,0x118B384F,0xE0DD8A9A,0x2B81593F,0xAD152B91,0x6649F834,0x7B4CC88C,0xB0101B29,0x36846987,0xFDD8BA22,
+        0x08F40F5A,0xC3A8DCFF,0x453CAE51,0x8E607DF4,0x93654D4C,0x58399EE9,0xDEADEC47,0x15F13FE2,0xE4A78D37,0x2FFB5E92,0xA96F2C3C,0x6233FF99,0x7F36CF21,0xB46A1C84,0x32FE6E2A,0xF9A2BD8F,
+        0x0B220DC1,0xC07EDE64,0x46EAACCA,0x8DB67F6F,0x90B34FD7,0x5BEF9C72,0xDD7BEEDC,0x16273D79,0xE7718FAC,0x2C2D5C09,0xAAB92EA7,0x61E5FD02,0x7CE0CDBA,0xB7BC1E1F,0x31286CB1,0xFA74BF14,
+        0x1EB014D8,0xD5ECC77D,0x5378B5D3,0x98246676,0x852156CE,0x4E7D856B,0xC8E9F7C5,0x03B52460,0xF2E396B5,0x39BF4510,0xBF2B37BE,0x7477E41B,0x6972D4A3,0xA22E0706,0x24BA75A8,0xEFE6A60D,
+        0x1D661643,0xD63AC5E6,0x50AEB748,0x9BF264ED,0x86F75455,0x4DAB87F0,0xCB3FF55E,0x006326FB,0xF135942E,0x3A69478B,0xBCFD3525,0x77A1E680,0x6AA4D638,0xA1F8059D,0x276C7733,0xEC30A496,
+        0x191C11EE,0xD240C24B,0x54D4B0E5,0x9F886340,0x828D53F8,0x49D1805D,0xCF45F2F3,0x04192156,0xF54F9383,0x3E134026,0xB8873288,0x73DBE12D,0x6EDED195,0xA5820230,0x2316709E,0xE84AA33B,
+        0x1ACA1375,0xD196C0D0,0x5702B27E,0x9C5E61DB,0x815B5163,0x4A0782C6,0xCC93F068,0x07CF23CD,0xF6999118,0x3DC542BD,0xBB513013,0x700DE3B6,0x6D08D30E,0xA65400AB,0x20C07205,0xEB9CA1A0,
+        0x11E81EB4,0xDAB4CD11,0x5C20BFBF,0x977C6C1A,0x8A795CA2,0x41258F07,0xC7B1FDA9,0x0CED2E0C,0xFDBB9CD9,0x36E74F7C,0xB0733DD2,0x7B2FEE77,0x662ADECF,0xAD760D6A,0x2BE27FC4,0xE0BEAC61,
+        0x123E1C2F,0xD962CF8A,0x5FF6BD24,0x94AA6E81,0x89AF5E39,0x42F38D9C,0xC467FF32,0x0F3B2C97,0xFE6D9E42,0x35314DE7,0xB3A53F49,0x78F9ECEC,0x65FCDC54,0xAEA00FF1,0x28347D5F,0xE368AEFA,
+        0x16441B82,0xDD18C827,0x5B8CBA89,0x90D0692C,0x8DD55994,0x46898A31,0xC01DF89F,0x0B412B3A,0xFA1799EF,0x314B4A4A,0xB7DF38E4,0x7C83EB41,0x6186DBF9,0xAADA085C,0x2C4E7AF2,0xE712A957,
+        0x15921919,0xDECECABC,0x585AB812,0x93066BB7,0x8E035B0F,0x455F88AA,0xC3CBFA04,0x089729A1,0xF9C19B74,0x329D48D1,0xB4093A7F,0x7F55E9DA,0x6250D962,0xA90C0AC7,0x2F987869,0xE4C4ABCC,
+    },
+    {
+        0x00000000,0xA6770BB4,0x979F1129,0x31E81A9D,0xF44F2413,0x52382FA7,0x63D0353A,0xC5A73E8E,0x33EF4E67,0x959845D3,0xA4705F4E,0x020754FA,0xC7A06A74,0x61D761C0,0x503F7B5D,0xF64870E9,
+        0x67DE9CCE,0xC1A9977A,0xF0418DE7,0x56368653,0x9391B8DD,0x35E6B369,0x040EA9F4,0xA279A240,0x5431D2A9,0xF246D91D,0xC3AEC380,0x65D9C834,0xA07EF6BA,0x0609FD0E,0x37E1E793,0x9196EC27,
+        0xCFBD399C,0x69CA3228,0x582228B5,0xFE552301,0x3BF21D8F,0x9D85163B,0xAC6D0CA6,0x0A1A0712,0xFC5277FB,0x5A257C4F,0x6BCD66D2,0xCDBA6D66,0x081D53E8,0xAE6A585C,0x9F8242C1,0x39F54975,
+        0xA863A552,0x0E14AEE6,0x3FFCB47B,0x998BBFCF,0x5C2C8141,0xFA5B8AF5,0xCBB39068,0x6DC49BDC,0x9B8CEB35,0x3DFBE081,0x0C13FA1C,0xAA64F1A8,0x6FC3CF26,0xC9B4C492,0xF85CDE0F,0x5E2BD5BB,
+        0x440B7579,0xE27C7ECD,0xD3946450,0x75E36FE4,0xB044516A,0x16335ADE,0x27DB4043,0x81AC4BF7,0x77E43B1E,0xD19330AA,0xE07B2A37,0x460C2183,0x83AB1F0D,0x25DC14B9,0x14340E24,0xB2430590,
+        0x23D5E9B7,0x85A2E203,0xB44AF89E,0x123DF32A,0xD79ACDA4,0x71EDC610,0x4005DC8D,0xE672D739,0x103AA7D0,0xB64DAC64,0x87A5B6F9,0x21D2BD4D,0xE47583C3,0x42028877,0x73EA92EA,0xD59D995E,
+        0x8BB64CE5,0x2DC14751,0x1C295DCC,0xBA5E5678,0x7FF968F6,0xD98E6342,0xE86679DF,0x4E11726B,0xB8590282,0x1E2E0936,0x2FC613AB,0x89B1181F,0x4C162691,0xEA612D25,0xDB8937B8,0x7DFE3C0C,
+        0xEC68D02B,0x4A1FDB9F,0x7BF7C102,0xDD80CAB6,0x1827F438,0xBE50FF8C,0x8FB8E511,0x29CFEEA5,0xDF879E4C,0x79F095F8,0x48188F65,0xEE6F84D1,0x2BC8BA5F,0x8DBFB1EB,0xBC57AB76,0x1A20A0C2,
+        0x8816EAF2,0x2E61E146,0x1F89FBDB,0xB9FEF06F,0x7C59CEE1,0xDA2EC555,0xEBC6DFC8,0x4DB1D47C,0xBBF9A495,0x1D8EAF21,0x2C66B5BC,0x8A11BE08,0x4FB68086,0xE9C18B32,0xD82991AF,0x7E5E9A1B,
+        0xEFC8763C,0x49BF7D88,0x78576715,0xDE206CA1,0x1B87522F,0xBDF0599B,0x8C184306,0x2A6F48B2,0xDC27385B,0x7A5033EF,0x4BB82972,0xEDCF22C6,0x28681C48,0x8E1F17FC,0xBFF70D61,0x198006D5,
+        0x47ABD36E,0xE1DCD8DA,0xD034C247,0x7643C9F3,0xB3E4F77D,0x1593FCC9,0x247BE654,0x820CEDE0,0x74449D09,0xD23396BD,0xE3DB8C20,0x45AC8794,0x800BB91A,0x267CB2AE,0x1794A833,0xB1E3A387,
+        0x20754FA0,0x86024414,0xB7EA5E89,0x119D553D,0xD43A6BB3,0x724D6007,0x43A57A9A,0xE5D2712E,0x139A01C7,0xB5ED0A73,0x840510EE,0x22721B5A,0xE7D525D4,0x41A22E60,0x704A34FD,0xD63D3F49,
+        0xCC1D9F8B,0x6A6A943F,0x5B828EA2,0xFDF58516,0x3852BB98,0x9E25B02C,0xAFCDAAB1,0x09BAA105,0xFFF2D1EC,0x5985DA58,0x686DC0C5,0xCE1ACB71,0x0BBDF5FF,0xADCAFE4B,0x9C22E4D6,0x3A55EF62,
+        0xABC30345,0x0DB408F1,0x3C5C126C,0x9A2B19D8,0x5F8C2756,0xF9FB2CE2,0xC813367F,0x6E643DCB,0x982C4D22,0x3E5B4696,0x0FB35C0B,0xA9C457BF,0x6C636931,0xCA146285,0xFBFC7818,0x5D8B73AC,
+        0x03A0A617,0xA5D7ADA3,0x943FB73E,0x3248BC8A,0xF7EF8204,0x519889B0,0x6070932D,0xC6079899,0x304FE870,0x9638E3C4,0xA7D0F959,0x01A7F2ED,0xC400CC63,0x6277C7D7,0x539FDD4A,0xF5E8D6FE,
+        0x647E3AD9,0xC209316D,0xF3E12BF0,0x55962044,0x90311ECA,0x3646157E,0x07AE0FE3,0xA1D90457,0x579174BE,0xF1E67F0A,0xC00E6597,0x66796E23,0xA3DE50AD,0x05A95B19,0x34414184,0x92364A30,
+    },
+    {
+        0x00000000,0xCCAA009E,0x4225077D,0x8E8F07E3,0x844A0EFA,0x48E00E64,0xC66F0987,0x0AC50919,0xD3E51BB5,0x1F4F1B2B,0x91C01CC8,0x5D6A1C56,0x57AF154F,0x9B0515D1,0x158A1232,0xD92012AC,
+        0x7CBB312B,0xB01131B5,0x3E9E3656,0xF23436C8,0xF8F13FD1,0x345B3F4F,0xBAD438AC,0x767E3832,0xAF5E2A9E,0x63F42A00,0xED7B2DE3,0x21D12D7D,0x2B142464,0xE7BE24FA,0x69312319,0xA59B2387,
+        0xF9766256,0x35DC62C8,0xBB53652B,0x77F965B5,0x7D3C6CAC,0xB1966C32,0x3F196BD1,0xF3B36B4F,0x2A9379E3,0xE639797D,0x68B67E9E,0xA41C7E00,0xAED97719,0x62737787,0xECFC7064,0x205670FA,
+        0x85CD537D,0x496753E3,0xC7E85400,0x0B42549E,0x01875D87,0xCD2D5D19,0x43A25AFA,0x8F085A64,0x562848C8,0x9A824856,0x140D4FB5,0xD8A74F2B,0xD2624632,0x1EC846AC,0x9047414F,0x5CED41D1,
+        0x299DC2ED,0xE537C273,0x6BB8C590,0xA712C50E,0xADD7CC17,0x617DCC89,0xEFF2CB6A,0x2358CBF4,0xFA78D958,0x36D2D9C6,0xB85DDE25,0x74F7DEBB,0x7E32D7A2,0xB298D73C,0x3C17D0DF,0xF0BDD041,
+        0x5526F3C6,0x998CF358,0x1703F4BB,0xDBA9F425,0xD16CFD3C,0x1DC6FDA2,0x9349FA41,0x5FE3FADF,0x86C3E873,0x4A69E8ED,0xC4E6EF0E,0x084CEF90,0x0289E689,0xCE23E617,0x40ACE1F4,0x8C06E16A,
+        0xD0EBA0BB,0x1C41A025,0x92CEA7C6,0x5E64A758,0x54A1AE41,0x980BAEDF,0x1684A93C,0xDA2EA9A2,0x030EBB0E,0xCFA4BB90,0x412BBC73,0x8D81BCED,0x8744B5F4,0x4BEEB56A,0xC561B289,0x09CBB217,
+        0xAC509190,0x60FA910E,0xEE7596ED,0x22DF9673,0x281A9F6A,0xE4B09FF4,0x6A3F9817,0xA6959889,0x7FB58A25,0xB31F8ABB,0x3D908D58,0xF13A8DC6,0xFBFF84DF,0x37558441,0xB9DA83A2,0x7570833C,
+        0x533B85DA,0x9F918544,0x111E82A7,0xDDB48239,0xD7718B20,0x1BDB8BBE,0x95548C5D,0x59FE8CC3,0x80DE9E6F,0x4C749EF1,0xC2FB9912,0x0E51998C,0x04949095,0xC83E900B,0x46B197E8,0x8A1B9776,
+        0x2F80B4F1,0xE32AB46F,0x6DA5B38C,0xA10FB312,0xABCABA0B,0x6760BA95,0xE9EFBD76,0x2545BDE8,0xFC65AF44,0x30CFAFDA,0xBE40A839,0x72EAA8A7,0x782FA1BE,0xB485A120,0x3A0AA6C3,0xF6A0A65D,
+        0xAA4DE78C,0x66E7E712,0xE868E0F1,0x24C2E06F,0x2E07E976,0xE2ADE9E8,0x6C22EE0B,0xA088EE95,0x79A8FC39,0xB502FCA7,0x3B8DFB44,0xF727FBDA,0xFDE2F2C3,0x3148F25D,0xBFC7F5BE,0x736DF520,
+        0xD6F6D6A7,0x1A5CD639,0x94D3D1DA,0x5879D144,0x52BCD85D,0x9E16D8C3,0x1099DF20,0xDC33DFBE,0x0513CD12,0xC9B9CD8C,0x4736CA6F,0x8B9CCAF1,0x8159C3E8,0x4DF3C376,0xC37CC495,0x0FD6C40B,
+        0x7AA64737,0xB60C47A9,0x3883404A,0xF42940D4,0xFEEC49CD,0x32464953,0xBCC94EB0,0x70634E2E,0xA9435C82,0x65E95C1C,0xEB665BFF,0x27CC5B61,0x2D095278,0xE1A352E6,0x6F2C5505,0xA386559B,
+        0x061D761C,0xCAB77682,0x44387161,0x889271FF,0x825778E6,0x4EFD7878,0xC0727F9B,0x0CD87F05,0xD5F86DA9,0x19526D37,0x97DD6AD4,0x5B776A4A,0x51B26353,0x9D1863CD,0x1397642E,0xDF3D64B0,
+        0x83D02561,0x4F7A25FF,0xC1F5221C,0x0D5F2282,0x079A2B9B,0xCB302B05,0x45BF2CE6,0x89152C78,0x50353ED4,0x9C9F3E4A,0x121039A9,0xDEBA3937,0xD47F302E,0x18D530B0,0x965A3753,0x5AF037CD,
+        0xFF6B144A,0x33C114D4,0xBD4E1337,0x71E413A9,0x7B211AB0,0xB78B1A2E,0x39041DCD,0xF5AE1D53,0x2C8E0FFF,0xE0240F61,0x6EAB0882,0xA201081C,0xA8C40105,0x646E019B,0xEAE10678,0x264B06E6,
+    },
 };
 
+// Little-endian load regardless of platform endianness and alignment (compiles to a single load on common platforms)
+static inline ImU32 ImCrc32Load32(const unsigned char* p)
+{
+    return (ImU32)p[0] | ((ImU32)p[1] << 8) | ((ImU32)p[2] << 16) | ((ImU32)p[3] << 24);
+}
+
+static inline ImU32 ImCrc32Update1(ImU32 crc, unsigned char c)
+{
+#ifdef IMGUI_ENABLE_ARM_CRC32
+    return __crc32b(crc, c);
+#else
+    return (crc >> 8) ^ GCrc32LookupTable[0][(crc & 0xFF) ^ c];
+#endif
+}
+
+static inline ImU32 ImCrc32Update4(ImU32 crc, ImU32 v)
+{
+#ifdef IMGUI_ENABLE_ARM_CRC32
+    return __crc32w(crc, v);
+#else
+    crc ^= v;
+    return GCrc32LookupTable[3][crc & 0xFF] ^ GCrc32LookupTable[2][(crc >> 8) & 0xFF] ^ GCrc32LookupTable[1][(crc >> 16) & 0xFF] ^ GCrc32LookupTable[0][crc >> 24];
+#endif
+}
+
+static inline ImU32 ImCrc32Update8(ImU32 crc, ImU32 lo, ImU32 hi)
+{
+#ifdef IMGUI_ENABLE_ARM_CRC32
+    return __crc32d(crc, (ImU64)lo | ((ImU64)hi << 32));
+#else
+    crc ^= lo;
+    return GCrc32LookupTable[7][crc & 0xFF] ^ GCrc32LookupTable[6][(crc >> 8) & 0xFF] ^ GCrc32LookupTable[5][(crc >> 16) & 0xFF] ^ GCrc32LookupTable[4][crc >> 24] ^
+           GCrc32LookupTable[3][hi & 0xFF] ^ GCrc32LookupTable[2][(hi >> 8) & 0xFF] ^ GCrc32LookupTable[1][(hi >> 16) & 0xFF] ^ GCrc32LookupTable[0][hi >> 24];
+#endif
+}
+
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
+// - Hashes 8 bytes per step (slicing-by-8 tables, or ARMv8 CRC32 instructions when IMGUI_ENABLE_ARM_CRC32 is defined). Output is the same in all cases.
+// FIXME-OPT: Replace with e.g. FNV1a hash? Changing the hash would invalidate IDs stored in .ini files.
 ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
 {
     ImU32 crc = ~seed;
     const unsigned char* data = (const unsigned char*)data_p;
-    const ImU32* crc32_lut = GCrc32LookupTable;
+    for (; data_size >= 8; data += 8, data_size -= 8)
+        crc = ImCrc32Update8(crc, ImCrc32Load32(data), ImCrc32Load32(data + 4));
+    if (data_size >= 4)
+    {
+        crc = ImCrc32Update4(crc, ImCrc32Load32(data));
+        data += 4;
+        data_size -= 4;
+    }
     while (data_size-- != 0)
-        crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ *data++];
+        crc = ImCrc32Update1(crc, *data++);
     return ~crc;
 }
 
@@ -1997,31 +2485,51 @@ ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
 // We support a syntax of "label###id" where only "###id" is included in the hash, and only "label" gets displayed.
 // Because this syntax is rarely used we are optimizing for the common case.
 // - If we reach ### in the string we discard the hash so far and reset to the seed.
-// - We don't do 'current += 2; continue;' after handling ### to keep the code smaller/faster (measured ~10% diff in Debug build)
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
+// - Blocks of 8 or 4 bytes without any '#' are hashed in one step (tested a word at a time), other blocks go through the byte-wise loop.
+// - Zero-terminated strings are measured with strlen() first, which is vectorized by the C library and never reads past the terminator.
 ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
 {
     seed = ~seed;
     ImU32 crc = seed;
     const unsigned char* data = (const unsigned char*)data_p;
-    const ImU32* crc32_lut = GCrc32LookupTable;
-    if (data_size != 0)
+    if (data_size == 0)
+        data_size = strlen(data_p);
+    const unsigned char* data_end = data + data_size;
+    while (data < data_end)
     {
-        while (data_size-- != 0)
+        if (data_end - data >= 8)
         {
-            unsigned char c = *data++;
-            if (c == '#' && data_size >= 2 && data[0] == '#' && data[1] == '#')
-                crc = seed;
-            crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ c];
+            const ImU32 lo = ImCrc32Load32(data);
+            const ImU32 hi = ImCrc32Load32(data + 4);
+            const ImU32 lo_x = lo ^ 0x23232323; // Zero bytes where '#' is
+            const ImU32 hi_x = hi ^ 0x23232323;
+            if (((((lo_x - 0x01010101) & ~lo_x) | ((hi_x - 0x01010101) & ~hi_x)) & 0x80808080) == 0)
+            {
+                crc = ImCrc32Update8(crc, lo, hi);
+                data += 8;
+                continue;
+            }
         }
-    }
-    else
-    {
-        while (unsigned char c = *data++)
+        if (data_end - data >= 4)
+        {
+            const ImU32 lo = ImCrc32Load32(data);
+            const ImU32 lo_x = lo ^ 0x23232323;
+            if ((((lo_x - 0x01010101) & ~lo_x) & 0x80808080) == 0)
+            {
+                crc = ImCrc32Update4(crc, lo);
+                data += 4;
+                continue;
+            }
+        }
+
+        // Block containing a '#', or last bytes
+        const unsigned char* block_end = (data_end - data >= 4) ? data + 4 : data_end;
+        while (data < block_end)
         {
-            if (c == '#' && data[0] == '#' && data[1] == '#')
+            unsigned char c = *data++;
+            if (c == '#' && data_end - data >= 2 && data[0] == '#' && data[1] == '#')
                 crc = seed;
-            crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ c];
+            crc = ImCrc32Update1(crc, c);
         }
     }
     return ~crc;
@@ -2034,6 +2542,7 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
 // Default file functions
 #ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
 
+// 'ctx' may be NULL, e.g. when called from the .ini writer thread (we then can't use its TempBuffer).
 ImFileHandle ImFileOpen(ImGuiContext* ctx, const char* filename, const char* mode)
 {
 #if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS) && !defined(__CYGWIN__) && !defined(__GNUC__)
@@ -2041,9 +2550,10 @@ ImFileHandle ImFileOpen(ImGuiContext* ctx, const char* filename, const char* mod
     // Previously we used ImTextCountCharsFromUtf8/ImTextStrFromUtf8 here but we now need to support ImWchar16 and ImWchar32!
     const int filename_wsize = ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, NULL, 0);
     const int mode_wsize = ::MultiByteToWideChar(CP_UTF8, 0, mode, -1, NULL, 0);
-    ImGuiContext& g = *ctx;
-    g.TempBuffer.reserve((filename_wsize + mode_wsize) * sizeof(wchar_t));
-    wchar_t* buf = (wchar_t*)(void*)g.TempBuffer.Data;
+    ImVector<char> local_buffer;
+    ImVector<char>& temp_buffer = ctx ? ctx->TempBuffer : local_buffer;
+    temp_buffer.reserve((filename_wsize + mode_wsize) * sizeof(wchar_t));
+    wchar_t* buf = (wchar_t*)(void*)temp_buffer.Data;
     ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, (wchar_t*)&buf[0], filename_wsize);
     ::MultiByteToWideChar(CP_UTF8, 0, mode, -1, (wchar_t*)&buf[filename_wsize], mode_wsize);
     return ::_wfopen((const wchar_t*)&buf[0], (const wchar_t*)&buf[filename_wsize]);
@@ -2057,6 +2567,22 @@ bool    ImFileClose(ImFileHandle f)     { return fclose(f) == 0; }
 ImU64   ImFileGetSize(ImFileHandle f)   { long off = 0, sz = 0; return ((off = ftell(f)) != -1 && !fseek(f, 0, SEEK_END) && (sz = ftell(f)) != -1 && !fseek(f, off, SEEK_SET)) ? (ImU64)sz : (ImU64)-1; }
 ImU64   ImFileRead(void* data, ImU64 sz, ImU64 count, ImFileHandle f)           { return fread(data, (size_t)sz, (size_t)count, f); }
 ImU64   ImFileWrite(const void* data, ImU64 sz, ImU64 count, ImFileHandle f)    { return fwrite(data, (size_t)sz, (size_t)count, f); }
+
+bool ImFileRename(const char* old_filename, const char* new_filename)
+{
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS) && !defined(__CYGWIN__)
+    // rename() fails on Windows when the destination exists, MoveFileEx() can replace it.
+    const int old_wsize = ::MultiByteToWideChar(CP_UTF8, 0, old_filename, -1, NULL, 0);
+    const int new_wsize = ::MultiByteToWideChar(CP_UTF8, 0, new_filename, -1, NULL, 0);
+    ImVector<wchar_t> buf;
+    buf.resize(old_wsize + new_wsize);
+    ::MultiByteToWideChar(CP_UTF8, 0, old_filename, -1, &buf[0], old_wsize);
+    ::MultiByteToWideChar(CP_UTF8, 0, new_filename, -1, &buf[old_wsize], new_wsize);
+    return ::MoveFileExW(&buf[0], &buf[old_wsize], MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    return rename(old_filename, new_filename) == 0; // Atomic on POSIX
+#endif
+}
 #endif // #ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
 
 // Helper: Load file content into memory
@@ -2101,6 +2627,84 @@ void*   ImFileLoadToMemory(ImGuiContext* ctx, const char* filename, const char*
     return file_data;
 }
 
+// Map whole file in memory for reading, without copying it when the platform supports memory mapped files.
+// Empty files are not mapped (return NULL).
+void* ImFileMapToMemory(ImGuiContext* ctx, const char* filename, size_t* out_file_size)
+{
+    IM_ASSERT(filename);
+    if (out_file_size)
+        *out_file_size = 0;
+#if defined(IMGUI_FILE_MAPPING_WIN32)
+    IM_UNUSED(ctx);
+    const int filename_wsize = ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, NULL, 0);
+    ImVector<wchar_t> filename_w;
+    filename_w.resize(filename_wsize);
+    ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, filename_w.Data, filename_wsize);
+    HANDLE file = ::CreateFileW(filename_w.Data, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return NULL;
+    LARGE_INTEGER file_size;
+    if (!::GetFileSizeEx(file, &file_size) || file_size.QuadPart <= 0 || (ImU64)file_size.QuadPart > (ImU64)(size_t)-1)
+    {
+        ::CloseHandle(file);
+        return NULL;
+    }
+    HANDLE mapping = ::CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    ::CloseHandle(file);
+    if (mapping == NULL)
+        return NULL;
+    void* data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    ::CloseHandle(mapping); // The view keeps the mapping alive
+    if (data != NULL && out_file_size)
+        *out_file_size = (size_t)file_size.QuadPart;
+    return data;
+#elif defined(IMGUI_FILE_MAPPING_POSIX)
+    IM_UNUSED(ctx);
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0)
+    {
+        close(fd);
+        return NULL;
+    }
+    void* data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // The mapping stays valid
+    if (data == MAP_FAILED)
+        return NULL;
+    if (out_file_size)
+        *out_file_size = (size_t)st.st_size;
+    return data;
+#else
+    size_t file_size = 0;
+    void* data = ImFileLoadToMemory(ctx, filename, "rb", &file_size);
+    if (data != NULL && file_size == 0)
+    {
+        IM_FREE(data);
+        return NULL;
+    }
+    if (out_file_size)
+        *out_file_size = file_size;
+    return data;
+#endif
+}
+
+void ImFileUnmapFromMemory(void* data, size_t data_size)
+{
+    if (data == NULL)
+        return;
+#if defined(IMGUI_FILE_MAPPING_WIN32)
+    IM_UNUSED(data_size);
+    ::UnmapViewOfFile(data);
+#elif defined(IMGUI_FILE_MAPPING_POSIX)
+    munmap(data, data_size);
+#else
+    IM_UNUSED(data_size);
+    IM_FREE(data);
+#endif
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 //-----------------------------------------------------------------------------
@@ -2405,6 +3009,93 @@ static ImGuiStorage::ImGuiStoragePair* LowerBound(ImVector<ImGuiStorage::ImGuiSt
     return first;
 }
 
+// Open-addressing hash index (when UseHashIndex is set)
+// - HashIndex[] stores indices into Data[] + 1, so pairs stay contiguous and code iterating Data[] doesn't need to know about it.
+// - Load factor is kept <= 0.5 so linear probing sequences stay short. Pairs are never removed so we don't need tombstones.
+static inline ImU32 ImGuiStorageHashKey(ImGuiID key)
+{
+    // Keys are often hashes already, but may be user provided sequential integers: mix bits (MurmurHash3 finalizer, partial)
+    key ^= key >> 16;
+    key *= 0x85EBCA6B;
+    key ^= key >> 13;
+    return key;
+}
+
+static void ImGuiStorageBuildHashIndex(ImGuiStorage* storage)
+{
+    int capacity = 16;
+    while (capacity < storage->Data.Size * 2)
+        capacity <<= 1;
+    ImVector<int>& index = storage->HashIndex;
+    index.resize(capacity);
+    memset(index.Data, 0, (size_t)index.size_in_bytes());
+    const ImU32 mask = (ImU32)capacity - 1;
+    for (int n = 0; n < storage->Data.Size; n++)
+    {
+        ImU32 slot = ImGuiStorageHashKey(storage->Data.Data[n].key) & mask;
+        while (index.Data[slot] != 0)
+            slot = (slot + 1) & mask;
+        index.Data[slot] = n + 1;
+    }
+    storage->HashIndexCount = storage->Data.Size;
+}
+
+// Return pair or NULL. Output slot where the key would be inserted. Index needs to be up to date.
+static ImGuiStorage::ImGuiStoragePair* ImGuiStorageHashFind(const ImGuiStorage* storage, ImGuiID key, ImU32* out_slot = NULL)
+{
+    const int* index = storage->HashIndex.Data;
+    const ImU32 mask = (ImU32)storage->HashIndex.Size - 1;
+    for (ImU32 slot = ImGuiStorageHashKey(key) & mask; ; slot = (slot + 1) & mask)
+    {
+        const int n = index[slot];
+        if (n == 0)
+        {
+            if (out_slot)
+                *out_slot = slot;
+            return NULL;
+        }
+        if (storage->Data.Data[n - 1].key == key)
+            return &storage->Data.Data[n - 1];
+    }
+}
+
+// Lookup for const Get***() functions: never rebuild the index, so concurrent reads are safe.
+// Index is only out of date after Data[] has been modified directly (or before first insertion): use a linear search.
+static ImGuiStorage::ImGuiStoragePair* ImGuiStorageHashFindNoRebuild(const ImGuiStorage* storage, ImGuiID key)
+{
+    if (storage->HashIndexCount == storage->Data.Size && storage->HashIndex.Size != 0)
+        return ImGuiStorageHashFind(storage, key);
+    for (ImGuiStorage::ImGuiStoragePair* it = storage->Data.Data; it < storage->Data.Data + storage->Data.Size; it++)
+        if (it->key == key)
+            return it;
+    return NULL;
+}
+
+static ImGuiStorage::ImGuiStoragePair* ImGuiStorageHashInsert(ImGuiStorage* storage, ImU32 slot, const ImGuiStorage::ImGuiStoragePair& pair)
+{
+    storage->Data.push_back(pair);
+    if (storage->Data.Size * 2 > storage->HashIndex.Size)
+    {
+        ImGuiStorageBuildHashIndex(storage); // Grow
+    }
+    else
+    {
+        storage->HashIndex.Data[slot] = storage->Data.Size;
+        storage->HashIndexCount++;
+    }
+    return &storage->Data.back();
+}
+
+static ImGuiStorage::ImGuiStoragePair* ImGuiStorageHashFindOrInsert(ImGuiStorage* storage, const ImGuiStorage::ImGuiStoragePair& default_pair)
+{
+    if (storage->HashIndexCount != storage->Data.Size || storage->HashIndex.Size == 0)
+        ImGuiStorageBuildHashIndex(storage);
+    ImU32 slot;
+    if (ImGuiStorage::ImGuiStoragePair* it = ImGuiStorageHashFind(storage, default_pair.key, &slot))
+        return it;
+    return ImGuiStorageHashInsert(storage, slot, default_pair);
+}
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
@@ -2419,10 +3110,30 @@ void ImGuiStorage::BuildSortByKey()
         }
     };
     ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), StaticFunc::PairComparerByID);
+    if (UseHashIndex)
+        ImGuiStorageBuildHashIndex(this);
+}
+
+void ImGuiStorage::SetHashIndex(bool enabled)
+{
+    if (UseHashIndex == enabled)
+        return;
+    UseHashIndex = enabled;
+    HashIndex.clear();
+    HashIndexCount = 0;
+    if (enabled)
+        ImGuiStorageBuildHashIndex(this); // Build now so const lookups don't need to
+    else
+        BuildSortByKey(); // Restore sorted order for binary search
 }
 
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
+    if (UseHashIndex)
+    {
+        ImGuiStoragePair* it = ImGuiStorageHashFindNoRebuild(this, key);
+        return it ? it->val_i : default_val;
+    }
     ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
     if (it == Data.end() || it->key != key)
         return default_val;
@@ -2436,6 +3147,11 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
+    if (UseHashIndex)
+    {
+        ImGuiStoragePair* it = ImGuiStorageHashFindNoRebuild(this, key);
+        return it ? it->val_f : default_val;
+    }
     ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
     if (it == Data.end() || it->key != key)
         return default_val;
@@ -2444,6 +3160,11 @@ float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
+    if (UseHashIndex)
+    {
+        ImGuiStoragePair* it = ImGuiStorageHashFindNoRebuild(this, key);
+        return it ? it->val_p : NULL;
+    }
     ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
     if (it == Data.end() || it->key != key)
         return NULL;
@@ -2453,6 +3174,8 @@ void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
+    if (UseHashIndex)
+        return &ImGuiStorageHashFindOrInsert(this, ImGuiStoragePair(key, default_val))->val_i;
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
@@ -2466,6 +3189,8 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
+    if (UseHashIndex)
+        return &ImGuiStorageHashFindOrInsert(this, ImGuiStoragePair(key, default_val))->val_f;
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
@@ -2474,6 +3199,8 @@ float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
+    if (UseHashIndex)
+        return &ImGuiStorageHashFindOrInsert(this, ImGuiStoragePair(key, default_val))->val_p;
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
@@ -2483,8 +3210,13 @@ void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 // FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
+    if (UseHashIndex)
+    {
+        ImGuiStorageHashFindOrInsert(this, ImGuiStoragePair(key, val))->val_i = val;
+        return;
+    }
+    ImGuiStoragePair* it = LowerBound(Data, key);
+    if (it == Data.end() || it->key != key)
         Data.insert(it, ImGuiStoragePair(key, val));
     else
         it->val_i = val;
@@ -2497,6 +3229,11 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
+    if (UseHashIndex)
+    {
+        ImGuiStorageHashFindOrInsert(this, ImGuiStoragePair(key, val))->val_f = val;
+        return;
+    }
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
         Data.insert(it, ImGuiStoragePair(key, val));
@@ -2506,6 +3243,11 @@ void ImGuiStorage::SetFloat(ImGuiID key, float val)
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
+    if (UseHashIndex)
+    {
+        ImGuiStorageHashFindOrInsert(this, ImGuiStoragePair(key, val))->val_p = val;
+        return;
+    }
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
         Data.insert(it, ImGuiStoragePair(key, val));
@@ -2528,6 +3270,7 @@ ImGuiTextFilter::ImGuiTextFilter(const char* default_filter) //-V1077
 {
     InputBuf[0] = 0;
     CountGrep = 0;
+    BuiltAsRefinement = false;
     if (default_filter)
     {
         ImStrncpy(InputBuf, default_filter, IM_ARRAYSIZE(InputBuf));
@@ -2563,8 +3306,82 @@ void ImGuiTextFilter::ImGuiTextRange::split(char separator, ImVector<ImGuiTextRa
         out->push_back(ImGuiTextRange(wb, we));
 }
 
+// Case-insensitive search of an upper-cased pattern in [text, text_end).
+// Same rules as ImStristr() (ASCII letters only are folded), but candidates are located 16 bytes at a time
+// by matching both the first and the last character of the pattern, which rejects most positions early.
+#if defined(IMGUI_ENABLE_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define IMGUI_TEXT_FILTER_USE_SSE2
+static inline __m128i ImTextFilterToUpper16(__m128i v)
+{
+    const __m128i is_lower = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('z' + 1)));
+    return _mm_sub_epi8(v, _mm_and_si128(is_lower, _mm_set1_epi8(0x20)));
+}
+#endif
+
+static inline bool ImTextFilterMatchAt(const char* text, const char* pattern, int pattern_len)
+{
+    for (int n = 0; n < pattern_len; n++)
+        if (ImToUpper(text[n]) != pattern[n])
+            return false;
+    return true;
+}
+
+static bool ImTextFilterFind(const char* text, int text_len, const char* pattern, int pattern_len)
+{
+    const int last_pos = text_len - pattern_len;
+    if (last_pos < 0)
+        return false;
+    int pos = 0;
+#ifdef IMGUI_TEXT_FILTER_USE_SSE2
+    const __m128i first_c = _mm_set1_epi8(pattern[0]);
+    const __m128i last_c = _mm_set1_epi8(pattern[pattern_len - 1]);
+    for (; last_pos >= 15 && pos <= last_pos; pos += 16)
+    {
+        if (pos + 15 > last_pos)
+            pos = last_pos - 15; // Last block overlaps previous one
+        const __m128i first_block = ImTextFilterToUpper16(_mm_loadu_si128((const __m128i*)(const void*)(text + pos)));
+        const __m128i last_block = ImTextFilterToUpper16(_mm_loadu_si128((const __m128i*)(const void*)(text + pos + pattern_len - 1)));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first_block, first_c), _mm_cmpeq_epi8(last_block, last_c)));
+        for (int bit = 0; mask != 0; bit++, mask >>= 1)
+            if ((mask & 1) && ImTextFilterMatchAt(text + pos + bit + 1, pattern + 1, pattern_len - 2))
+                return true;
+    }
+#endif
+    const char first_c_scalar = pattern[0];
+    for (; pos <= last_pos; pos++)
+        if (ImToUpper(text[pos]) == first_c_scalar && ImTextFilterMatchAt(text + pos + 1, pattern + 1, pattern_len - 1))
+            return true;
+    return false;
+}
+
+// Evaluate compiled patterns in order: the first matching term decides (exclusion -> fail, grep -> pass).
+static bool ImTextFilterPass(const ImGuiTextFilter* filter, const char* text, const char* text_end)
+{
+    if (text == NULL)
+        text = "";
+    const int text_len = text_end ? (int)(text_end - text) : (int)strlen(text);
+    const char* patterns_buf = filter->PatternsBuf.Data;
+    for (const ImGuiTextFilter::ImGuiTextPattern& pattern : filter->Patterns)
+        if (ImTextFilterFind(text, text_len, patterns_buf + pattern.Offset, pattern.Len))
+            return !pattern.Exclude;
+
+    // Implicit * grep
+    return filter->CountGrep == 0;
+}
+
+static bool ImTextFilterPatternContains(const ImGuiTextFilter::ImGuiTextPattern& haystack, const char* haystack_buf, const ImGuiTextFilter::ImGuiTextPattern& needle, const char* needle_buf)
+{
+    return ImTextFilterFind(haystack_buf + haystack.Offset, haystack.Len, needle_buf + needle.Offset, needle.Len);
+}
+
 void ImGuiTextFilter::Build()
 {
+    ImVector<ImGuiTextPattern> prev_patterns;
+    ImVector<char> prev_patterns_buf;
+    prev_patterns.swap(Patterns);
+    prev_patterns_buf.swap(PatternsBuf);
+    const int prev_count_grep = CountGrep;
+
     Filters.resize(0);
     ImGuiTextRange input_range(InputBuf, InputBuf + strlen(InputBuf));
     input_range.split(',', &Filters);
@@ -2580,6 +3397,40 @@ void ImGuiTextFilter::Build()
             continue;
         if (f.b[0] != '-')
             CountGrep += 1;
+
+        // Compile (a lone '-' never excludes anything)
+        ImGuiTextPattern pattern;
+        pattern.Exclude = (f.b[0] == '-');
+        const char* p = pattern.Exclude ? f.b + 1 : f.b;
+        pattern.Offset = PatternsBuf.Size;
+        pattern.Len = (int)(f.e - p);
+        if (pattern.Len == 0)
+            continue;
+        for (; p < f.e; p++)
+            PatternsBuf.push_back(ImToUpper(*p));
+        Patterns.push_back(pattern);
+    }
+
+    // Can previous results be refined? Only if every text passing the new filter also passed the previous one:
+    // - previous filter had no terms (everything passed), or
+    // - same terms in same order where each grep term contains the previous one and each exclusion term is contained
+    //   in the previous one, optionally followed by new exclusion terms.
+    BuiltAsRefinement = (prev_patterns.Size == 0 && prev_count_grep == 0);
+    if (!BuiltAsRefinement && Patterns.Size >= prev_patterns.Size)
+    {
+        BuiltAsRefinement = true;
+        for (int n = 0; n < Patterns.Size && BuiltAsRefinement; n++)
+        {
+            const ImGuiTextPattern& pattern = Patterns[n];
+            if (n >= prev_patterns.Size)
+                BuiltAsRefinement = pattern.Exclude;
+            else if (pattern.Exclude != prev_patterns[n].Exclude)
+                BuiltAsRefinement = false;
+            else if (pattern.Exclude)
+                BuiltAsRefinement = ImTextFilterPatternContains(prev_patterns[n], prev_patterns_buf.Data, pattern, PatternsBuf.Data);
+            else
+                BuiltAsRefinement = ImTextFilterPatternContains(pattern, PatternsBuf.Data, prev_patterns[n], prev_patterns_buf.Data);
+        }
     }
 }
 
@@ -2587,33 +3438,28 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
 {
     if (Filters.empty())
         return true;
+    return ImTextFilterPass(this, text, text_end);
+}
 
-    if (text == NULL)
-        text = "";
-
-    for (const ImGuiTextRange& f : Filters)
+int ImGuiTextFilter::PassFilterMany(const char* const* texts, const char* const* text_ends, int count, ImU32* inout_mask, bool refine) const
+{
+    int pass_count = 0;
+    for (int word_n = 0; word_n * 32 < count; word_n++)
     {
-        if (f.empty())
-            continue;
-        if (f.b[0] == '-')
-        {
-            // Subtract
-            if (ImStristr(text, text_end, f.b + 1, f.e) != NULL)
-                return false;
-        }
-        else
-        {
-            // Grep
-            if (ImStristr(text, text_end, f.b, f.e) != NULL)
-                return true;
-        }
+        const int base = word_n * 32;
+        const int word_count = ImMin(count - base, 32);
+        const ImU32 word_valid_mask = (word_count == 32) ? ~(ImU32)0 : (((ImU32)1 << word_count) - 1);
+        ImU32 word_in = refine ? (inout_mask[word_n] & word_valid_mask) : word_valid_mask;
+        ImU32 word_out = Filters.empty() ? word_in : 0;
+        if (!Filters.empty())
+            for (int bit = 0; bit < word_count; bit++)
+                if ((word_in & ((ImU32)1 << bit)) && ImTextFilterPass(this, texts[base + bit], text_ends ? text_ends[base + bit] : NULL))
+                    word_out |= (ImU32)1 << bit;
+        inout_mask[word_n] = word_out;
+        for (; word_out != 0; word_out &= word_out - 1)
+            pass_count++;
     }
-
-    // Implicit * grep
-    if (CountGrep == 0)
-        return true;
-
-    return false;
+    return pass_count;
 }
 
 //-----------------------------------------------------------------------------
@@ -2735,14 +3581,13 @@ static void ImGuiListClipper_SortAndFuseRanges(ImVector<ImGuiListClipperRange>&
     }
 }
 
-static void ImGuiListClipper_SeekCursorAndSetupPrevLine(ImGuiContext* ctx, float pos_y, float line_height)
+static void ImGuiListClipper_SeekCursorAndSetupPrevLine(ImGuiContext* ctx, float pos_y, float line_height, int row_increase)
 {
     // Set cursor position and a few other things so that SetScrollHereY() and Columns() can work when seeking cursor.
     // FIXME: It is problematic that we have to do that here, because custom/equivalent end-user code would stumble on the same issue.
     // The clipper should probably have a final step to display the last item in a regular manner, maybe with an opt-out flag for data sets which may have costly seek?
     ImGuiContext& g = *ctx;
     ImGuiWindow* window = g.CurrentWindow;
-    float off_y = pos_y - window->DC.CursorPos.y;
     window->DC.CursorPos.y = pos_y;
     window->DC.CursorMaxPos.y = ImMax(window->DC.CursorMaxPos.y, pos_y - g.Style.ItemSpacing.y);
     window->DC.CursorPosPrevLine.y = window->DC.CursorPos.y - line_height;  // Setting those fields so that SetScrollHereY() can properly function after the end of our clipper usage.
@@ -2754,7 +3599,6 @@ static void ImGuiListClipper_SeekCursorAndSetupPrevLine(ImGuiContext* ctx, float
         if (table->IsInsideRow)
             ImGui::TableEndRow(ctx, table);
         table->RowPosY2 = window->DC.CursorPos.y;
-        const int row_increase = (int)((off_y / line_height) + 0.5f);
         //table->CurrentRow += row_increase; // Can't do without fixing TableEndRow()
         table->RowBgColorCounter += row_increase;
     }
@@ -2764,9 +3608,21 @@ static void ImGuiListClipper_SeekCursorForItem(ImGuiContext* ctx, ImGuiListClipp
 {
     // StartPosY starts from ItemsFrozen hence the subtraction
     // Perform the add and multiply with double to allow seeking through larger ranges
+    ImGuiContext& g = *ctx;
     ImGuiListClipperData* data = (ImGuiListClipperData*)clipper->TempData;
+    const float cursor_y = g.CurrentWindow->DC.CursorPos.y;
+    if (ImGuiListClipperHeights* heights = clipper->ItemsHeights)
+    {
+        // Variable height: offsets come from the prefix sums, row increase is the number of items between current cursor and target
+        const double frozen_offset = heights->GetItemOffset(data->ItemsFrozen);
+        const float pos_y = (float)((double)clipper->StartPosY + data->LossynessOffset + heights->GetItemOffset(item_n) - frozen_offset);
+        const int cursor_item = heights->FindItemAtOffset(frozen_offset + (double)cursor_y - clipper->StartPosY - data->LossynessOffset);
+        const float line_height = (item_n > 0) ? heights->GetItemHeight(item_n - 1) : clipper->ItemsHeight;
+        ImGuiListClipper_SeekCursorAndSetupPrevLine(ctx, pos_y, line_height, item_n - ImMin(cursor_item, item_n));
+        return;
+    }
     float pos_y = (float)((double)clipper->StartPosY + data->LossynessOffset + (double)(item_n - data->ItemsFrozen) * clipper->ItemsHeight);
-    ImGuiListClipper_SeekCursorAndSetupPrevLine(ctx, pos_y, clipper->ItemsHeight);
+    ImGuiListClipper_SeekCursorAndSetupPrevLine(ctx, pos_y, clipper->ItemsHeight, (int)(((pos_y - cursor_y) / clipper->ItemsHeight) + 0.5f));
 }
 
 ImGuiListClipper::ImGuiListClipper(ImGuiContext* ctx)
@@ -2797,6 +3653,7 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     StartPosY = window->DC.CursorPos.y;
     ItemsHeight = items_height;
     ItemsCount = items_count;
+    ItemsHeights = NULL;
     DisplayStart = -1;
     DisplayEnd = 0;
 
@@ -2809,6 +3666,20 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     TempData = data;
 }
 
+void ImGuiListClipper::BeginVariableHeight(int items_count, ImGuiListClipperHeights* heights)
+{
+    IM_ASSERT(Ctx != NULL);
+    IM_ASSERT(heights != NULL && items_count >= 0 && items_count < INT_MAX && "Variable height clipper needs to know the number of items!");
+    ImGuiContext& g = *Ctx;
+    if (heights->DefaultHeight <= 0.0f)
+        heights->DefaultHeight = g.FontSize + g.Style.ItemSpacing.y;
+    heights->Resize(items_count);
+
+    // Item height is only used as a fallback, it also skips the measuring step
+    Begin(items_count, heights->DefaultHeight);
+    ItemsHeights = heights;
+}
+
 void ImGuiListClipper::End()
 {
     if (ImGuiListClipperData* data = (ImGuiListClipperData*)TempData)
@@ -2852,6 +3723,15 @@ static bool ImGuiListClipper_StepInternal(ImGuiContext* ctx, ImGuiListClipper* c
     if (table && table->IsInsideRow)
         ImGui::TableEndRow(ctx, table);
 
+    // Variable height: store measured height of the item returned by last step
+    if (data->MeasureItem >= 0)
+    {
+        const float measured_height = window->DC.CursorPos.y - data->MeasureStartY;
+        if (measured_height > 0.0f)
+            clipper->ItemsHeights->SetItemHeight(data->MeasureItem, measured_height);
+        data->MeasureItem = -1;
+    }
+
     // No items
     if (clipper->ItemsCount == 0 || GetSkipItemForListClipping(ctx))
         return false;
@@ -2936,8 +3816,18 @@ static bool ImGuiListClipper_StepInternal(ImGuiContext* ctx, ImGuiListClipper* c
         for (ImGuiListClipperRange& range : data->Ranges)
             if (range.PosToIndexConvert)
             {
-                int m1 = (int)(((double)range.Min - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight);
-                int m2 = (int)((((double)range.Max - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight) + 0.999999f);
+                int m1, m2;
+                if (ImGuiListClipperHeights* heights = clipper->ItemsHeights)
+                {
+                    const double base_offset = heights->GetItemOffset(already_submitted) - window->DC.CursorPos.y - data->LossynessOffset;
+                    m1 = heights->FindItemAtOffset(base_offset + range.Min) - already_submitted;
+                    m2 = heights->FindItemAtOffset(base_offset + range.Max) + 1 - already_submitted;
+                }
+                else
+                {
+                    m1 = (int)(((double)range.Min - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight);
+                    m2 = (int)((((double)range.Max - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight) + 0.999999f);
+                }
                 range.Min = ImClamp(already_submitted + m1 + range.PosToIndexOffsetMin, already_submitted, clipper->ItemsCount - 1);
                 range.Max = ImClamp(already_submitted + m2 + range.PosToIndexOffsetMax, range.Min + 1, clipper->ItemsCount);
                 range.PosToIndexConvert = false;
@@ -2952,6 +3842,17 @@ static bool ImGuiListClipper_StepInternal(ImGuiContext* ctx, ImGuiListClipper* c
         clipper->DisplayEnd = ImMin(data->Ranges[data->StepNo].Max, clipper->ItemsCount);
         if (clipper->DisplayStart > already_submitted) //-V1051
             ImGuiListClipper_SeekCursorForItem(ctx, clipper, clipper->DisplayStart);
+        if (clipper->ItemsHeights && clipper->DisplayEnd > clipper->DisplayStart)
+        {
+            // Variable height: return items one by one so each of them can be measured
+            if (clipper->DisplayEnd > clipper->DisplayStart + 1)
+            {
+                data->Ranges.insert(data->Ranges.Data + data->StepNo + 1, ImGuiListClipperRange::FromIndices(clipper->DisplayStart + 1, clipper->DisplayEnd));
+                clipper->DisplayEnd = clipper->DisplayStart + 1;
+            }
+            data->MeasureItem = clipper->DisplayStart;
+            data->MeasureStartY = window->DC.CursorPos.y;
+        }
         data->StepNo++;
         if (clipper->DisplayStart == clipper->DisplayEnd && data->StepNo < data->Ranges.Size)
             continue;
@@ -2979,14 +3880,530 @@ bool ImGuiListClipper::Step()
         IMGUI_DEBUG_LOG_CLIPPER(Ctx, "Clipper: Step(): computed ItemsHeight: %.2f.\n", ItemsHeight);
     if (ret)
     {
-        IMGUI_DEBUG_LOG_CLIPPER(Ctx, "Clipper: Step(): display %d to %d.\n", DisplayStart, DisplayEnd);
+        IMGUI_DEBUG_LOG_CLIPPER(Ctx, "Clipper: Step(): display %d to %d.\n", DisplayStart, DisplayEnd);
+    }
+    else
+    {
+        IMGUI_DEBUG_LOG_CLIPPER(Ctx, "Clipper: Step(): End.\n");
+        End();
+    }
+    return ret;
+}
+
+// Appending only needs to fold into new nodes the nodes of the old tree whose parent is beyond the old count,
+// which are exactly the nodes visited by a prefix query of the old count.
+void ImGuiListClipperHeights::Resize(int items_count)
+{
+    IM_ASSERT(items_count >= 0);
+    const int old_count = GetCount();
+    Tree.resize(items_count + 1);
+    if (items_count <= old_count)
+        return;
+    if (old_count == 0)
+        Tree[0] = 0.0;
+    for (int i = old_count + 1; i <= items_count; i++)
+        Tree[i] = DefaultHeight;
+    for (int i = old_count; i > 0; i -= (i & -i))
+        if (i + (i & -i) <= items_count)
+            Tree[i + (i & -i)] += Tree[i];
+    for (int i = old_count + 1; i <= items_count; i++)
+        if (i + (i & -i) <= items_count)
+            Tree[i + (i & -i)] += Tree[i];
+}
+
+void ImGuiListClipperHeights::SetItemHeight(int item_n, float height)
+{
+    IM_ASSERT(item_n >= 0 && item_n < GetCount());
+    const double delta = (double)height - GetItemHeight(item_n);
+    if (delta == 0.0)
+        return;
+    for (int i = item_n + 1; i < Tree.Size; i += (i & -i))
+        Tree[i] += delta;
+}
+
+float ImGuiListClipperHeights::GetItemHeight(int item_n) const
+{
+    IM_ASSERT(item_n >= 0 && item_n < GetCount());
+    const int i = item_n + 1;
+    double height = Tree[i];
+    for (int j = i - 1, j_end = i - (i & -i); j > j_end; j -= (j & -j))
+        height -= Tree[j];
+    return (float)height;
+}
+
+double ImGuiListClipperHeights::GetItemOffset(int item_n) const
+{
+    IM_ASSERT(item_n >= 0 && item_n <= GetCount());
+    double offset = 0.0;
+    for (int i = item_n; i > 0; i -= (i & -i))
+        offset += Tree[i];
+    return offset;
+}
+
+int ImGuiListClipperHeights::FindItemAtOffset(double offset) const
+{
+    const int count = GetCount();
+    if (count == 0)
+        return 0;
+    int step = 1;
+    while (step * 2 <= count)
+        step *= 2;
+    int item_n = 0;
+    for (; step > 0; step >>= 1)
+        if (item_n + step <= count && Tree[item_n + step] <= offset)
+        {
+            item_n += step;
+            offset -= Tree[item_n];
+        }
+    return ImMin(item_n, count - 1);
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImGuiGridClipper
+//-----------------------------------------------------------------------------
+
+// Append (block - sub) to 'out', as up to 4 blocks. 'block' is passed by copy as it may be stored in 'out'.
+static void ImGuiGridClipper_SubtractBlock(ImGuiGridClipperBlock block, const ImGuiGridClipperBlock& sub, ImVector<ImGuiGridClipperBlock>* out)
+{
+    if (sub.IsEmpty() || sub.RowMin >= block.RowMax || sub.RowMax <= block.RowMin || sub.ColumnMin >= block.ColumnMax || sub.ColumnMax <= block.ColumnMin)
+    {
+        out->push_back(block);
+        return;
+    }
+    const int row_min = ImMax(block.RowMin, sub.RowMin);
+    const int row_max = ImMin(block.RowMax, sub.RowMax);
+    ImGuiGridClipperBlock pieces[4] =
+    {
+        ImGuiGridClipperBlock(block.RowMin, row_min, block.ColumnMin, block.ColumnMax),         // Above
+        ImGuiGridClipperBlock(row_max, block.RowMax, block.ColumnMin, block.ColumnMax),         // Below
+        ImGuiGridClipperBlock(row_min, row_max, block.ColumnMin, ImMax(block.ColumnMin, sub.ColumnMin)), // Left
+        ImGuiGridClipperBlock(row_min, row_max, ImMin(block.ColumnMax, sub.ColumnMax), block.ColumnMax), // Right
+    };
+    for (const ImGuiGridClipperBlock& piece : pieces)
+        if (!piece.IsEmpty())
+            out->push_back(piece);
+}
+
+// Convert an absolute rectangle to a block of cells (clamping before converting to integers, as rectangles may be unbounded)
+static ImGuiGridClipperBlock ImGuiGridClipper_BlockFromRect(ImGuiGridClipper* clipper, const ImRect& rect, const ImVec2& lossyness_offset, int off_row_min, int off_row_max, int off_column_min, int off_column_max)
+{
+    const double rows = (double)clipper->RowsCount, columns = (double)clipper->ColumnsCount;
+    const double x1 = ImClamp(((double)rect.Min.x - clipper->StartPos.x - lossyness_offset.x) / clipper->CellSize.x, 0.0, columns);
+    const double x2 = ImClamp(((double)rect.Max.x - clipper->StartPos.x - lossyness_offset.x) / clipper->CellSize.x, 0.0, columns);
+    const double y1 = ImClamp(((double)rect.Min.y - clipper->StartPos.y - lossyness_offset.y) / clipper->CellSize.y, 0.0, rows);
+    const double y2 = ImClamp(((double)rect.Max.y - clipper->StartPos.y - lossyness_offset.y) / clipper->CellSize.y, 0.0, rows);
+    ImGuiGridClipperBlock block;
+    block.RowMin = ImClamp((int)y1 + off_row_min, 0, clipper->RowsCount);
+    block.RowMax = ImClamp((int)(y2 + 0.999999) + off_row_max, block.RowMin, clipper->RowsCount);
+    block.ColumnMin = ImClamp((int)x1 + off_column_min, 0, clipper->ColumnsCount);
+    block.ColumnMax = ImClamp((int)(x2 + 0.999999) + off_column_max, block.ColumnMin, clipper->ColumnsCount);
+    return block;
+}
+
+ImGuiGridClipper::ImGuiGridClipper(ImGuiContext* ctx)
+{
+    memset(this, 0, sizeof(*this));
+    Ctx = ctx;
+    IM_ASSERT(Ctx != NULL);
+    RowsCount = ColumnsCount = -1;
+}
+
+ImGuiGridClipper::~ImGuiGridClipper()
+{
+    End();
+}
+
+void ImGuiGridClipper::Begin(int rows_count, int columns_count, const ImVec2& cell_size)
+{
+    IM_ASSERT(Ctx != NULL);
+    IM_ASSERT(rows_count >= 0 && columns_count >= 0);
+    IM_ASSERT(cell_size.x > 0.0f && cell_size.y > 0.0f);
+
+    ImGuiContext& g = *Ctx;
+    ImGuiWindow* window = g.CurrentWindow;
+    IMGUI_DEBUG_LOG_CLIPPER(Ctx, "GridClipper: Begin(%d,%d,%.2f,%.2f) in '%s'\n", rows_count, columns_count, cell_size.x, cell_size.y, window->Name);
+
+    StartPos = window->DC.CursorPos;
+    CellSize = cell_size;
+    RowsCount = rows_count;
+    ColumnsCount = columns_count;
+    DisplayRowStart = DisplayRowEnd = 0;
+    DisplayColumnStart = DisplayColumnEnd = 0;
+
+    // Acquire temporary buffer
+    if (++g.GridClipperTempDataStacked > g.GridClipperTempData.Size)
+        g.GridClipperTempData.resize(g.GridClipperTempDataStacked, ImGuiGridClipperData());
+    ImGuiGridClipperData* data = &g.GridClipperTempData[g.GridClipperTempDataStacked - 1];
+    data->Reset(this);
+    data->LossynessOffset = window->DC.CursorStartPosLossyness;
+    TempData = data;
+}
+
+void ImGuiGridClipper::End()
+{
+    if (ImGuiGridClipperData* data = (ImGuiGridClipperData*)TempData)
+    {
+        // Move cursor below the grid and extend content size on both axes, as if the whole grid was a single item.
+        ImGuiContext& g = *Ctx;
+        ImGuiWindow* window = g.CurrentWindow;
+        IMGUI_DEBUG_LOG_CLIPPER(Ctx, "GridClipper: End() in '%s'\n", window->Name);
+        const ImVec2 end_pos = GetCellPos(RowsCount, ColumnsCount);
+        window->DC.CursorPos = ImVec2(StartPos.x, end_pos.y);
+        window->DC.CursorMaxPos.x = ImMax(window->DC.CursorMaxPos.x, end_pos.x - g.Style.ItemSpacing.x);
+        window->DC.CursorMaxPos.y = ImMax(window->DC.CursorMaxPos.y, end_pos.y - g.Style.ItemSpacing.y);
+        window->DC.CursorPosPrevLine = ImVec2(end_pos.x - g.Style.ItemSpacing.x, end_pos.y - CellSize.y);
+        window->DC.PrevLineSize.y = CellSize.y - g.Style.ItemSpacing.y;
+        window->DC.IsSameLine = false;
+
+        // Restore temporary buffer and fix back pointers which may be invalidated when nesting
+        IM_ASSERT(data->GridClipper == this);
+        if (--g.GridClipperTempDataStacked > 0)
+        {
+            data = &g.GridClipperTempData[g.GridClipperTempDataStacked - 1];
+            data->GridClipper->TempData = data;
+        }
+        TempData = NULL;
+    }
+    RowsCount = ColumnsCount = -1;
+}
+
+ImVec2 ImGuiGridClipper::GetCellPos(int row, int column) const
+{
+    // Perform the add and multiply with double to allow seeking through larger ranges
+    const ImGuiGridClipperData* data = (const ImGuiGridClipperData*)TempData;
+    const ImVec2 lossyness_offset = data ? data->LossynessOffset : ImVec2(0.0f, 0.0f);
+    return ImVec2((float)((double)StartPos.x + lossyness_offset.x + (double)column * CellSize.x), (float)((double)StartPos.y + lossyness_offset.y + (double)row * CellSize.y));
+}
+
+void ImGuiGridClipper::SeekCell(int row, int column)
+{
+    ImGuiContext& g = *Ctx;
+    ImGuiWindow* window = g.CurrentWindow;
+    window->DC.CursorPos = GetCellPos(row, column);
+    window->DC.IsSameLine = false;
+}
+
+void ImGuiGridClipper::IncludeItemsByIndex(int item_begin, int item_end)
+{
+    ImGuiGridClipperData* data = (ImGuiGridClipperData*)TempData;
+    IM_ASSERT(data != NULL && data->StepNo == 0); // Only allowed after Begin() and before first Step().
+    IM_ASSERT(item_begin <= item_end);
+    if (item_begin >= item_end || ColumnsCount <= 0)
+        return;
+
+    // Split into a partial first row, full rows, partial last row
+    const int row_begin = item_begin / ColumnsCount, column_begin = item_begin % ColumnsCount;
+    const int row_last = (item_end - 1) / ColumnsCount, column_last = (item_end - 1) % ColumnsCount;
+    if (row_begin == row_last)
+    {
+        data->Blocks.push_back(ImGuiGridClipperBlock(row_begin, row_begin + 1, column_begin, column_last + 1));
+        return;
+    }
+    data->Blocks.push_back(ImGuiGridClipperBlock(row_begin, row_begin + 1, column_begin, ColumnsCount));
+    if (row_last > row_begin + 1)
+        data->Blocks.push_back(ImGuiGridClipperBlock(row_begin + 1, row_last, 0, ColumnsCount));
+    data->Blocks.push_back(ImGuiGridClipperBlock(row_last, row_last + 1, 0, column_last + 1));
+}
+
+static bool ImGuiGridClipper_StepInternal(ImGuiContext* ctx, ImGuiGridClipper* clipper)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImGuiGridClipperData* data = (ImGuiGridClipperData*)clipper->TempData;
+    IM_ASSERT(data != NULL && "Called ImGuiGridClipper::Step() too many times, or before ImGuiGridClipper::Begin() ?");
+
+    // No cells
+    if (clipper->RowsCount == 0 || clipper->ColumnsCount == 0 || GetSkipItemForListClipping(ctx))
+        return false;
+
+    // Step 0: Calculate the blocks of cells to display
+    if (data->StepNo == 0)
+    {
+        ImVector<ImGuiGridClipperBlock>& blocks = data->Blocks;
+        if (g.LogEnabled)
+        {
+            // If logging is active, do not perform any clipping
+            blocks.resize(0);
+            blocks.push_back(ImGuiGridClipperBlock(0, clipper->RowsCount, 0, clipper->ColumnsCount));
+        }
+        else
+        {
+            // Visible block goes first so that it is submitted first
+            const bool is_nav_request = (g.NavMoveScoringItems && g.NavWindow && g.NavWindow->RootWindowForNav == window->RootWindowForNav);
+            const int off_row_min = (is_nav_request && g.NavMoveClipDir == ImGuiDir_Up) ? -1 : 0;
+            const int off_row_max = (is_nav_request && g.NavMoveClipDir == ImGuiDir_Down) ? 1 : 0;
+            const int off_column_min = (is_nav_request && g.NavMoveClipDir == ImGuiDir_Left) ? -1 : 0;
+            const int off_column_max = (is_nav_request && g.NavMoveClipDir == ImGuiDir_Right) ? 1 : 0;
+            blocks.push_front(ImGuiGridClipper_BlockFromRect(clipper, window->ClipRect, data->LossynessOffset, off_row_min, off_row_max, off_column_min, off_column_max));
+
+            // Add range selected to be included for navigation
+            if (is_nav_request)
+                blocks.push_back(ImGuiGridClipper_BlockFromRect(clipper, g.NavScoringNoClipRect, data->LossynessOffset, 0, 0, 0, 0));
+            if (is_nav_request && (g.NavMoveFlags & ImGuiNavMoveFlags_IsTabbing) && g.NavTabbingDir == -1)
+                blocks.push_back(ImGuiGridClipperBlock(clipper->RowsCount - 1, clipper->RowsCount, clipper->ColumnsCount - 1, clipper->ColumnsCount));
+
+            // Add focused/active item
+            if (g.NavId != 0 && window->NavLastIds[0] == g.NavId)
+                blocks.push_back(ImGuiGridClipper_BlockFromRect(clipper, ImGui::WindowRectRelToAbs(window, window->NavRectRel[0]), data->LossynessOffset, 0, 0, 0, 0));
+
+            // Make blocks disjoint so that no cell is submitted twice: subtract all previous blocks from each block
+            ImVector<ImGuiGridClipperBlock>& out_blocks = data->BlocksTemp;
+            out_blocks.resize(0);
+            for (int block_n = 0; block_n < blocks.Size; block_n++)
+            {
+                const int pieces_begin = out_blocks.Size;
+                out_blocks.push_back(blocks[block_n]);
+                for (int prev_n = 0; prev_n < block_n && out_blocks.Size > pieces_begin; prev_n++)
+                {
+                    const int pieces_end = out_blocks.Size;
+                    for (int piece_n = pieces_begin; piece_n < pieces_end; piece_n++)
+                        ImGuiGridClipper_SubtractBlock(out_blocks[piece_n], blocks[prev_n], &out_blocks);
+                    out_blocks.erase(out_blocks.Data + pieces_begin, out_blocks.Data + pieces_end);
+                }
+            }
+            blocks.swap(out_blocks);
+        }
+    }
+
+    // Display the next non-empty block
+    while (data->StepNo < data->Blocks.Size)
+    {
+        const ImGuiGridClipperBlock& block = data->Blocks[data->StepNo++];
+        if (block.IsEmpty())
+            continue;
+        clipper->DisplayRowStart = block.RowMin;
+        clipper->DisplayRowEnd = block.RowMax;
+        clipper->DisplayColumnStart = block.ColumnMin;
+        clipper->DisplayColumnEnd = block.ColumnMax;
+        return true;
+    }
+    return false;
+}
+
+bool ImGuiGridClipper::Step()
+{
+    ImGuiContext& g = *Ctx;
+    bool ret = ImGuiGridClipper_StepInternal(Ctx, this);
+    if (ret)
+    {
+        IMGUI_DEBUG_LOG_CLIPPER(Ctx, "GridClipper: Step(): display rows %d to %d, columns %d to %d.\n", DisplayRowStart, DisplayRowEnd, DisplayColumnStart, DisplayColumnEnd);
+    }
+    else
+    {
+        DisplayRowStart = DisplayRowEnd = DisplayColumnStart = DisplayColumnEnd = 0;
+        IMGUI_DEBUG_LOG_CLIPPER(Ctx, "GridClipper: Step(): End.\n");
+        End();
+    }
+    return ret;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImGuiTreeClipper
+//-----------------------------------------------------------------------------
+
+int ImGuiTreeClipperIndex::FindParentRow(int row) const
+{
+    const int depth = Rows[row].Depth;
+    while (--row >= 0)
+        if (Rows[row].Depth < depth)
+            return row;
+    return -1;
+}
+
+// Append rows for the visible descendants of 'parent_node', in display order. Iterative to support deep trees.
+static void ImGuiTreeClipper_AppendVisibleDescendants(ImGuiTreeClipper* clipper, int parent_node, int depth, ImVector<ImGuiTreeClipperRow>* out)
+{
+    ImVector<int>& stack = clipper->Index->BuildStack; // (node, next child, children count) triplets
+    stack.resize(0);
+    stack.push_back(parent_node);
+    stack.push_back(0);
+    stack.push_back(clipper->ChildrenCountFunc(parent_node, clipper->UserData));
+    while (stack.Size > 0)
+    {
+        int* entry = &stack.Data[stack.Size - 3];
+        if (entry[1] == entry[2])
+        {
+            stack.resize(stack.Size - 3);
+            continue;
+        }
+        ImGuiTreeClipperRow row;
+        row.Node = clipper->ChildFunc(entry[0], entry[1]++, clipper->UserData);
+        row.Depth = depth + stack.Size / 3 - 1;
+        const int children_count = clipper->ChildrenCountFunc(row.Node, clipper->UserData);
+        row.IsLeaf = (children_count == 0);
+        row.IsOpen = !row.IsLeaf && clipper->Storage->GetInt(clipper->GetNodeID(row.Node), 0) != 0;
+        out->push_back(row);
+        if (row.IsOpen)
+        {
+            stack.push_back(row.Node);
+            stack.push_back(0);
+            stack.push_back(children_count);
+        }
+    }
+}
+
+static void ImGuiTreeClipper_ExpandRow(ImGuiTreeClipper* clipper, int row_n)
+{
+    ImGuiTreeClipperIndex* index = clipper->Index;
+    ImVector<ImGuiTreeClipperRow>& new_rows = index->BuildRows;
+    new_rows.resize(0);
+    ImGuiTreeClipper_AppendVisibleDescendants(clipper, index->Rows[row_n].Node, index->Rows[row_n].Depth + 1, &new_rows);
+    const int old_count = index->Rows.Size;
+    index->Rows.resize(old_count + new_rows.Size);
+    ImGuiTreeClipperRow* insert_at = index->Rows.Data + row_n + 1;
+    memmove(insert_at + new_rows.Size, insert_at, (size_t)(old_count - row_n - 1) * sizeof(ImGuiTreeClipperRow));
+    if (new_rows.Size > 0)
+        memcpy(insert_at, new_rows.Data, (size_t)new_rows.Size * sizeof(ImGuiTreeClipperRow));
+    index->Rows[row_n].IsOpen = true;
+    clipper->ListClipper.ItemsCount = index->Rows.Size; // So End() seeks cursor to the new content height this frame
+}
+
+static void ImGuiTreeClipper_CollapseRow(ImGuiTreeClipper* clipper, int row_n)
+{
+    ImVector<ImGuiTreeClipperRow>& rows = clipper->Index->Rows;
+    int end_n = row_n + 1;
+    while (end_n < rows.Size && rows[end_n].Depth > rows[row_n].Depth)
+        end_n++;
+    memmove(rows.Data + row_n + 1, rows.Data + end_n, (size_t)(rows.Size - end_n) * sizeof(ImGuiTreeClipperRow));
+    rows.resize(rows.Size - (end_n - row_n - 1));
+    rows[row_n].IsOpen = false;
+    clipper->DisplayEnd = ImMin(clipper->DisplayEnd, rows.Size);
+    clipper->ListClipper.ItemsCount = rows.Size;
+}
+
+ImGuiTreeClipper::ImGuiTreeClipper(ImGuiContext* ctx) : ListClipper(ctx)
+{
+    Ctx = ctx;
+    DisplayStart = DisplayEnd = 0;
+    Index = NULL;
+    ChildrenCountFunc = NULL;
+    ChildFunc = NULL;
+    UserData = NULL;
+    ID = 0;
+    Storage = NULL;
+    StartPosX = 0.0f;
+}
+
+ImGuiTreeClipper::~ImGuiTreeClipper()
+{
+    End();
+}
+
+void ImGuiTreeClipper::Begin(const char* str_id, ImGuiTreeClipperIndex* index, ImGuiTreeClipperChildrenCountFunc children_count_func, ImGuiTreeClipperChildFunc child_func, void* user_data)
+{
+    ImGuiContext& g = *Ctx;
+    ImGuiWindow* window = g.CurrentWindow;
+    IM_ASSERT(index != NULL && children_count_func != NULL && child_func != NULL);
+    Index = index;
+    ChildrenCountFunc = children_count_func;
+    ChildFunc = child_func;
+    UserData = user_data;
+    ID = window->GetID(str_id);
+    Storage = window->DC.StateStorage;
+    StartPosX = window->DC.CursorPos.x;
+    DisplayStart = DisplayEnd = 0;
+
+    if (index->IsDirty || index->ID != ID)
+    {
+        index->Rows.resize(0);
+        ImGuiTreeClipper_AppendVisibleDescendants(this, -1, 0, &index->Rows);
+        index->ID = ID;
+        index->IsDirty = false;
+    }
+    ListClipper.Begin(index->Rows.Size);
+}
+
+void ImGuiTreeClipper::End()
+{
+    ListClipper.End();
+    Index = NULL;
+}
+
+bool ImGuiTreeClipper::Step()
+{
+    IM_ASSERT(Index != NULL && "Must call Begin() before Step()!");
+    bool ret = ListClipper.Step();
+    if (ret)
+    {
+        DisplayStart = ImMin(ListClipper.DisplayStart, Index->Rows.Size);
+        DisplayEnd = ImMin(ListClipper.DisplayEnd, Index->Rows.Size); // Rows may have been removed by a node closing earlier in the frame
+    }
+    else
+    {
+        DisplayStart = DisplayEnd = 0;
+        End();
+    }
+    return ret;
+}
+
+ImGuiID ImGuiTreeClipper::GetNodeID(int node) const
+{
+    return ImHashData(&node, sizeof(node), ID);
+}
+
+void ImGuiTreeClipper::SetNodeOpen(int row_n, bool open)
+{
+    ImGuiTreeClipperRow& row = Index->Rows[row_n];
+    if (row.IsLeaf)
+        return;
+    Storage->SetInt(GetNodeID(row.Node), open ? 1 : 0);
+    if (row.IsOpen != open)
+    {
+        if (open)
+            ImGuiTreeClipper_ExpandRow(this, row_n);
+        else
+            ImGuiTreeClipper_CollapseRow(this, row_n);
+    }
+}
+
+bool ImGuiTreeClipper::TreeNode(int row_n, const char* label, ImGuiTreeNodeFlags flags)
+{
+    ImGuiContext& g = *Ctx;
+    ImGuiWindow* window = g.CurrentWindow;
+    IM_ASSERT(Index != NULL && row_n >= 0 && row_n < Index->Rows.Size);
+    const ImGuiTreeClipperRow row = Index->Rows[row_n];
+    const ImGuiID id = GetNodeID(row.Node);
+    if (row.IsLeaf)
+        flags |= ImGuiTreeNodeFlags_Leaf;
+    flags |= ImGuiTreeNodeFlags_NoTreePushOnOpen;
+
+    window->DC.CursorPos.x = StartPosX + row.Depth * g.Style.IndentSpacing;
+    const bool is_open = ImGui::TreeNodeBehavior(Ctx, id, flags, label, NULL);
+
+    // Sync rows with open state (toggled by user or via SetNextItemOpen())
+    if (!row.IsLeaf && is_open != row.IsOpen)
+    {
+        if (is_open)
+            ImGuiTreeClipper_ExpandRow(this, row_n);
+        else
+            ImGuiTreeClipper_CollapseRow(this, row_n);
     }
-    else
+
+    // Left arrow on a closed node: move to parent. Right arrow on an open node: move to first child.
+    // This is the equivalent of ImGuiTreeNodeFlags_NavLeftJumpsBackHere, except the target is generally clipped:
+    // we build its ImGuiNavTreeNodeData from the row positions instead of storing it in g.NavTreeNodeStack.
+    if (g.NavId == id && g.NavWindow == window && (g.NavMoveDir == ImGuiDir_Left || g.NavMoveDir == ImGuiDir_Right) && ImGui::NavMoveRequestButNoResultYet(Ctx))
     {
-        IMGUI_DEBUG_LOG_CLIPPER(Ctx, "Clipper: Step(): End.\n");
-        End();
+        int target_n = -1;
+        if (g.NavMoveDir == ImGuiDir_Left && !is_open)
+            target_n = Index->FindParentRow(row_n);
+        else if (g.NavMoveDir == ImGuiDir_Right && is_open && row_n + 1 < Index->Rows.Size && Index->Rows[row_n + 1].Depth > row.Depth)
+            target_n = row_n + 1;
+        if (target_n != -1)
+        {
+            const float row_height = (ListClipper.ItemsHeight > 0.0f) ? ListClipper.ItemsHeight : g.LastItemData.NavRect.GetHeight() + g.Style.ItemSpacing.y;
+            ImGuiNavTreeNodeData target;
+            target.ID = GetNodeID(Index->Rows[target_n].Node);
+            target.InFlags = g.LastItemData.InFlags;
+            target.NavRect = g.LastItemData.NavRect;
+            target.NavRect.TranslateX((Index->Rows[target_n].Depth - row.Depth) * g.Style.IndentSpacing);
+            target.NavRect.TranslateY((target_n - row_n) * row_height);
+            ImGuiLastItemData backup_last_item_data = g.LastItemData;
+            ImGui::NavMoveRequestResolveWithPastTreeNode(Ctx, &g.NavMoveResultLocal, &target);
+            g.LastItemData = backup_last_item_data;
+        }
     }
-    return ret;
+    return is_open;
 }
 
 //-----------------------------------------------------------------------------
@@ -3286,6 +4703,25 @@ void ImGui::RenderTextWrapped(ImGuiContext* ctx, ImVec2 pos, const char* text, c
     }
 }
 
+// Render word-wrapped text from a layout computed by CalcTextWrapLayout() with current font. Only visible lines are processed.
+// (not logging, caller is expected to use RenderTextWrapped() when logging is enabled)
+void ImGui::RenderTextWrapLayout(ImGuiContext* ctx, ImVec2 pos, const char* text, const ImGuiTextWrapLayout* layout)
+{
+    ImGuiContext& g = *ctx;
+    ImDrawList* draw_list = g.CurrentWindow->DrawList;
+    const float line_height = g.FontSize;
+    const ImU32 col = GetColorU32(ctx, ImGuiCol_Text);
+    pos.y = IM_TRUNC(pos.y);
+    const int line_min = ImMax((int)((draw_list->GetClipRectMin().y - pos.y) / line_height), 0);
+    const int line_max = ImMin((int)((draw_list->GetClipRectMax().y - pos.y) / line_height) + 1, layout->Lines.Size);
+    for (int line_n = line_min; line_n < line_max; line_n++)
+    {
+        const ImGuiTextWrapLine& line = layout->Lines[line_n];
+        if (line.Begin < line.End)
+            draw_list->AddText(g.Font, g.FontSize, ImVec2(pos.x, pos.y + line_n * line_height), col, text + line.Begin, text + line.End);
+    }
+}
+
 // Default clip_rect uses (pos_min,pos_max)
 // Handle clipping on CPU immediately (vs typically let the GPU clip the triangles that are overlapping the clipping rectangle edges)
 // FIXME-OPT: Since we have or calculate text_size we could coarse clip whole block immediately, especally for text above draw_list->DrawList.
@@ -3537,6 +4973,9 @@ void ImGui::Initialize(ImGuiContext* ctx)
         ini_handler.ReadLineFn = WindowSettingsHandler_ReadLine;
         ini_handler.ApplyAllFn = WindowSettingsHandler_ApplyAll;
         ini_handler.WriteAllFn = WindowSettingsHandler_WriteAll;
+        ini_handler.ReadBinaryFn = WindowSettingsHandler_ReadBinary;
+        ini_handler.WriteBinaryFn = WindowSettingsHandler_WriteBinary;
+        ini_handler.BinaryVersion = 1;
         AddSettingsHandler(ctx, &ini_handler);
     }
     TableSettingsAddSettingsHandler(ctx);
@@ -3555,6 +4994,9 @@ void ImGui::Initialize(ImGuiContext* ctx)
     g.Viewports.push_back(viewport);
     g.TempBuffer.resize(1024 * 3 + 1, 0);
 
+    // Create input events queue for other threads (with IMGUI_ENABLE_THREADED_INPUT_EVENTS, otherwise NULL)
+    g.InputEventsRing = InputEventRingCreate();
+
 #ifdef IMGUI_HAS_DOCK
 #endif
 
@@ -3582,12 +5024,17 @@ void ImGui::Shutdown(ImGuiContext* ctx)
         return;
 
     // Save settings (unless we haven't attempted to load them: CreateContext/DestroyContext without a call to NewFrame shouldn't save an empty file)
+    // Wait for asynchronous writes first so they can't overwrite the final data.
+    SettingsWriterShutdown(ctx);
     if (g.SettingsLoaded && g.IO.IniFilename != NULL)
         SaveIniSettingsToDisk(ctx, g.IO.IniFilename);
 
     CallContextHooks(&g, ImGuiContextHookType_Shutdown);
 
     // Clear everything else
+    // (with IMGUI_ENABLE_THREADED_INPUT_EVENTS, other threads must have stopped calling io.AddXXXEvent() functions by now)
+    InputEventRingDestroy(g.InputEventsRing);
+    g.InputEventsRing = NULL;
     g.Windows.clear_delete();
     g.WindowsFocusOrder.clear();
     g.WindowsTempSortBuffer.clear();
@@ -3615,10 +5062,17 @@ void ImGui::Shutdown(ImGuiContext* ctx)
     g.ShrinkWidthBuffer.clear();
 
     g.ClipperTempData.clear_destruct();
+    g.GridClipperTempData.clear_destruct();
 
+    g.TextWrapLayouts.Clear();
+    g.TextWrapLinesTemp.clear();
     g.Tables.Clear();
     g.TablesTempData.clear_destruct();
     g.DrawChannelsTempMergeBuffer.clear();
+    g.DebugProfiler.Frames.clear_destruct();
+    g.DebugProfiler.ZonesStack.clear();
+    g.DebugProfiler.FramesIdx = g.DebugProfiler.FramesCount = 0;
+    g.DebugProfiler.Recording = false;
 
     g.ClipboardHandlerData.clear();
     g.MenusIdSubmittedThisFrame.clear();
@@ -3626,6 +5080,10 @@ void ImGui::Shutdown(ImGuiContext* ctx)
     g.InputTextDeactivatedState.ClearFreeMemory();
 
     g.SettingsWindows.clear();
+    g.SettingsWindowsById.Clear();
+    g.SettingsBinaryData.clear();
+    g.SettingsWindowsIniCache.clear();
+    g.SettingsTablesIniCache.clear();
     g.SettingsHandlers.clear();
 
     if (g.LogFile)
@@ -3682,6 +5140,9 @@ void ImGui::CallContextHooks(ImGuiContext* ctx, ImGuiContextHookType hook_type)
 ImGuiWindow::ImGuiWindow(ImGuiContext* ctx, const char* name) : DrawListInst(NULL)
 {
     memset(this, 0, sizeof(*this));
+#ifdef IMGUI_STORAGE_USE_HASH_INDEX
+    StateStorage.SetHashIndex(true); // Cleared by memset()
+#endif
     Ctx = ctx;
     Name = ImStrdup(name);
     NameBufLen = (int)strlen(name) + 1;
@@ -3714,8 +5175,16 @@ ImGuiWindow::~ImGuiWindow()
 ImGuiID ImGuiWindow::GetID(const char* str, const char* str_end)
 {
     ImGuiID seed = IDStack.back();
-    ImGuiID id = ImHashStr(str, str_end ? (str_end - str) : 0, seed);
     ImGuiContext& g = *Ctx;
+    if (g.NextItemLiteralID != NULL)
+    {
+        // Label was hashed at compile time (see ImGuiLiteralID). Widgets taking one must call GetID() on its exact string first.
+        IM_ASSERT(g.NextItemLiteralID->Str == str && str_end == NULL && "Widget taking a ImGuiLiteralID didn't request the ID of its label first!");
+        const ImGuiLiteralID* literal_id = g.NextItemLiteralID;
+        g.NextItemLiteralID = NULL;
+        return ImGui::GetIDWithSeed(Ctx, *literal_id, seed);
+    }
+    ImGuiID id = ImHashStr(str, str_end ? (str_end - str) : 0, seed);
     if (g.DebugHookIdInfo == id)
         ImGui::DebugHookIdInfo(Ctx, id, ImGuiDataType_String, str, str_end);
     return id;
@@ -4032,10 +5501,16 @@ bool ImGui::IsItemHovered(ImGuiContext* ctx, ImGuiHoveredFlags flags)
         // but once unlocked on a given item we also moving.
         //if (g.HoverDelayTimer >= delay && (g.HoverDelayTimer - g.IO.DeltaTime < delay || g.MouseStationaryTimer - g.IO.DeltaTime < g.Style.HoverStationaryDelay)) { IMGUI_DEBUG_LOG("HoverDelayTimer = %f/%f, MouseStationaryTimer = %f\n", g.HoverDelayTimer, delay, g.MouseStationaryTimer); }
         if ((flags & ImGuiHoveredFlags_Stationary) != 0 && g.HoverItemUnlockedStationaryId != hover_delay_id)
+        {
+            RequestWakeup(ctx, g.Style.HoverStationaryDelay - g.MouseStationaryTimer);
             return false;
+        }
 
         if (g.HoverItemDelayTimer < delay)
+        {
+            RequestWakeup(ctx, delay - g.HoverItemDelayTimer);
             return false;
+        }
     }
 
     return true;
@@ -4245,6 +5720,68 @@ int ImGui::GetFrameCount(ImGuiContext* ctx)
     return ctx->FrameCount;
 }
 
+bool ImGui::IsFrameNeeded(ImGuiContext* ctx)
+{
+    return GetNextWakeupTime(ctx) <= 0.0f;
+}
+
+// Tell if the next frame may render differently from the last one, and if not, how long we can wait.
+// - Anything which may change because of inputs is covered by the input queue (+ a few settle frames, see NewFrame()).
+// - Anything happening over time needs to be covered here or to call RequestWakeup() when it is submitted (cursor blink, hover delays etc.)
+float ImGui::GetNextWakeupTime(ImGuiContext* ctx)
+{
+    ImGuiContext& g = *ctx;
+    if (g.WakeupFramesLeft > 0 || g.InputEventsQueue.Size > 0 || (g.InputEventsRing != NULL && !InputEventRingIsEmpty(g.InputEventsRing)))
+        return 0.0f;
+
+    // Held inputs (dragging, key repeat, CTRL+Tab windowing, etc.)
+    ImGuiIO& io = g.IO;
+    for (int n = 0; n < IM_ARRAYSIZE(io.MouseDown); n++)
+        if (io.MouseDown[n])
+            return 0.0f;
+    for (int n = 0; n < IM_ARRAYSIZE(io.KeysData); n++)
+        if (io.KeysData[n].Down)
+            return 0.0f;
+
+    // Animations and requests processed on next frame
+    const bool dim_bg = GetTopMostPopupModal(ctx) != NULL || (g.NavWindowingTarget != NULL && g.NavWindowingHighlightAlpha > 0.0f);
+    if (g.DimBgRatio != (dim_bg ? 1.0f : 0.0f) || g.NavWindowingTarget != NULL || g.NavWindowingHighlightAlpha > 0.0f)
+        return 0.0f;
+    if (g.NavInitRequest || g.NavMoveSubmitted || g.NavMoveForwardToNextFrame || g.DragDropActive)
+        return 0.0f;
+    for (ImGuiWindow* window : g.Windows)
+    {
+        if (!window->Active && !window->WasActive)
+            continue;
+        if (window->HiddenFramesCanSkipItems > 0 || window->HiddenFramesCannotSkipItems > 0 || window->HiddenFramesForRenderOnly > 0 || window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0)
+            return 0.0f;
+        if (window->ScrollTarget.x != FLT_MAX || window->ScrollTarget.y != FLT_MAX)
+        {
+            ImVec2 next_scroll = CalcNextScrollFromScrollTargetAndClamp(window);
+            if (next_scroll.x != window->Scroll.x || next_scroll.y != window->Scroll.y)
+                return 0.0f;
+        }
+    }
+
+    // Timers
+    float wakeup = FLT_MAX;
+    if (g.WakeupTime != FLT_MAX)
+        wakeup = ImMax((float)(g.WakeupTime - g.Time), 0.0f);
+    if (g.SettingsDirtyTimer > 0.0f)
+        wakeup = ImMin(wakeup, g.SettingsDirtyTimer);
+    if (g.WheelingWindowReleaseTimer > 0.0f)
+        wakeup = ImMin(wakeup, g.WheelingWindowReleaseTimer);
+    if (g.IO.IniSavingInProgress)
+        wakeup = ImMin(wakeup, WAKEUP_INI_SAVING_POLL_DELAY); // io.IniSavingXXX fields are only updated by NewFrame()
+    return wakeup;
+}
+
+void ImGui::RequestWakeup(ImGuiContext* ctx, float delay)
+{
+    ImGuiContext& g = *ctx;
+    g.WakeupTime = ImMin(g.WakeupTime, g.Time + ImMax(delay, 0.0f));
+}
+
 static ImDrawList* GetViewportBgFgDrawList(ImGuiContext* ctx, ImGuiViewportP* viewport, size_t drawlist_no, const char* drawlist_name)
 {
     // Create the draw list on demand, because they are not frequently used for all viewports
@@ -4262,7 +5799,7 @@ static ImDrawList* GetViewportBgFgDrawList(ImGuiContext* ctx, ImGuiViewportP* vi
     if (viewport->BgFgDrawListsLastFrame[drawlist_no] != g.FrameCount)
     {
         draw_list->_ResetForNewFrame();
-        draw_list->PushTextureID(g.IO.Fonts->TexID);
+        draw_list->PushTextureID(g.IO.Fonts->GetGlyphsTexID());
         draw_list->PushClipRect(viewport->Pos, viewport->Pos + viewport->Size, false);
         viewport->BgFgDrawListsLastFrame[drawlist_no] = g.FrameCount;
     }
@@ -4417,6 +5954,7 @@ static bool IsWindowActiveAndVisible(ImGuiWindow* window)
 // The reason this is exposed in imgui_internal.h is: on touch-based system that don't have hovering, we want to dispatch inputs to the right target (imgui vs imgui+app)
 void ImGui::UpdateHoveredWindowAndCaptureFlags(ImGuiContext* ctx)
 {
+    IMGUI_PROFILER_ZONE(ctx, "UpdateHoveredWindowAndCaptureFlags");
     ImGuiContext& g = *ctx;
     ImGuiIO& io = g.IO;
     g.WindowsHoverPadding = ImMax(g.Style.TouchExtraPadding, ImVec2(WINDOWS_HOVER_PADDING, WINDOWS_HOVER_PADDING));
@@ -4494,6 +6032,8 @@ void ImGui::NewFrame(ImGuiContext* ctx)
 {
     IM_ASSERT(ctx != NULL && "No current context. Did you call ImGui::CreateContext() and ImGui::SetCurrentContext() ?");
     ImGuiContext& g = *ctx;
+    ProfilerNewFrame(ctx);
+    IMGUI_PROFILER_ZONE(ctx, "NewFrame");
 
     // Remove pending delete hooks before frame start.
     // This deferred removal avoid issues of removal while iterating the hook vector
@@ -4527,6 +6067,14 @@ void ImGui::NewFrame(ImGuiContext* ctx)
     g.InputEventsTrail.resize(0);
     UpdateInputEvents(ctx, g.IO.ConfigInputTrickleEventQueue);
 
+    // Idle: after inputs keep requesting a few frames, so that changes depending on previous frame state get visible
+    if (g.InputEventsTrail.Size > 0)
+        g.WakeupFramesLeft = IMGUI_WAKEUP_SETTLE_FRAMES;
+    else if (g.WakeupFramesLeft > 0)
+        g.WakeupFramesLeft--;
+    if (g.WakeupTime <= g.Time)
+        g.WakeupTime = FLT_MAX;
+
     // Update viewports (after processing input queue, so io.MouseHoveredViewport is set)
     UpdateViewportsNewFrame(ctx);
 
@@ -4543,7 +6091,7 @@ void ImGui::NewFrame(ImGuiContext* ctx)
     g.DrawListSharedData.InitialFlags = ImDrawListFlags_None;
     if (g.Style.AntiAliasedLines)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLines;
-    if (g.Style.AntiAliasedLinesUseTex && !(g.Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedLines))
+    if (g.Style.AntiAliasedLinesUseTex && !(g.Font->ContainerAtlas->Flags & (ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_SignedDistanceField)))
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLinesUseTex;
     if (g.Style.AntiAliasedFill)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
@@ -4696,6 +6244,7 @@ void ImGui::NewFrame(ImGuiContext* ctx)
     UpdateMouseWheel(ctx);
 
     // Mark all windows as not visible and compact unused memory.
+    IMGUI_PROFILER_ZONE_BEGIN(ctx, "GC");
     IM_ASSERT(g.WindowsFocusOrder.Size <= g.Windows.Size);
     const float memory_compact_start_time = (g.GcCompactAll || g.IO.ConfigMemoryCompactTimer < 0.0f) ? FLT_MAX : (float)g.Time - g.IO.ConfigMemoryCompactTimer;
     for (ImGuiWindow* window : g.Windows)
@@ -4712,9 +6261,12 @@ void ImGui::NewFrame(ImGuiContext* ctx)
     }
 
     // Garbage collect transient buffers of recently unused tables
-    for (int i = 0; i < g.TablesLastTimeActive.Size; i++)
+    for (int n = 0; n < g.Tables.GetAliveCount(); n++)
+    {
+        const ImPoolIdx i = g.Tables.GetAliveIndexByPos(n);
         if (g.TablesLastTimeActive[i] >= 0.0f && g.TablesLastTimeActive[i] < memory_compact_start_time)
             TableGcCompactTransientBuffers(ctx, g.Tables.GetByIndex(i));
+    }
     for (ImGuiTableTempData& table_temp_data : g.TablesTempData)
         if (table_temp_data.LastTimeActive >= 0.0f && table_temp_data.LastTimeActive < memory_compact_start_time)
             TableGcCompactTransientBuffers(&table_temp_data);
@@ -4722,6 +6274,13 @@ void ImGui::NewFrame(ImGuiContext* ctx)
         GcCompactTransientMiscBuffers(ctx);
     g.GcCompactAll = false;
 
+    // Garbage collect word-wrapping layouts which were not used during last frame.
+    for (int n = g.TextWrapLayouts.GetAliveCount() - 1; n >= 0; n--)
+        if (ImGuiTextWrapLayout* layout = g.TextWrapLayouts.GetAliveByPos(n))
+            if (layout->LastFrameUsed < g.FrameCount - 1)
+                g.TextWrapLayouts.Remove(layout->ID, layout);
+    IMGUI_PROFILER_ZONE_END(ctx);
+
     // Closing the focused window restore focus to the first active root window in descending z-order
     if (g.NavWindow && !g.NavWindow->WasActive)
         FocusTopMostWindowUnderOne(ctx, NULL, NULL, NULL, ImGuiFocusRequestFlags_RestoreFocusedChild);
@@ -4969,6 +6528,7 @@ void ImGui::EndFrame(ImGuiContext* ctx)
     if (g.FrameCountEnded == g.FrameCount)
         return;
     IM_ASSERT(g.WithinFrameScope && "Forgot to call ImGui::NewFrame()?");
+    IMGUI_PROFILER_ZONE(ctx, "EndFrame");
 
     CallContextHooks(&g, ImGuiContextHookType_EndFramePre);
 
@@ -5029,6 +6589,7 @@ void ImGui::EndFrame(ImGuiContext* ctx)
 
     // Sort the window list so that all child windows are after their parent
     // We cannot do that on FocusWindow() because children may not exist yet
+    IMGUI_PROFILER_ZONE_BEGIN(ctx, "SortWindows");
     g.WindowsTempSortBuffer.resize(0);
     g.WindowsTempSortBuffer.reserve(g.Windows.Size);
     for (ImGuiWindow* window : g.Windows)
@@ -5041,6 +6602,7 @@ void ImGui::EndFrame(ImGuiContext* ctx)
     // This usually assert if there is a mismatch between the ImGuiWindowFlags_ChildWindow / ParentWindow values and DC.ChildWindows[] in parents, aka we've done something wrong.
     IM_ASSERT(g.Windows.Size == g.WindowsTempSortBuffer.Size);
     g.Windows.swap(g.WindowsTempSortBuffer);
+    IMGUI_PROFILER_ZONE_END(ctx);
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
 
     // Unlock font atlas
@@ -5068,6 +6630,7 @@ void ImGui::Render(ImGuiContext* ctx)
     if (g.FrameCountRendered == g.FrameCount)
         return;
     g.FrameCountRendered = g.FrameCount;
+    IMGUI_PROFILER_ZONE(ctx, "Render");
 
     g.IO.MetricsRenderWindows = 0;
     CallContextHooks(&g, ImGuiContextHookType_RenderPre);
@@ -5084,6 +6647,7 @@ void ImGui::Render(ImGuiContext* ctx)
     }
 
     // Add ImDrawList to render
+    IMGUI_PROFILER_ZONE_BEGIN(ctx, "AddDrawLists");
     ImGuiWindow* windows_to_render_top_most[2];
     windows_to_render_top_most[0] = (g.NavWindowingTarget && !(g.NavWindowingTarget->Flags & ImGuiWindowFlags_NoBringToFrontOnFocus)) ? g.NavWindowingTarget->RootWindow : NULL;
     windows_to_render_top_most[1] = (g.NavWindowingTarget ? g.NavWindowingListWindow : NULL);
@@ -5096,6 +6660,7 @@ void ImGui::Render(ImGuiContext* ctx)
     for (int n = 0; n < IM_ARRAYSIZE(windows_to_render_top_most); n++)
         if (windows_to_render_top_most[n] && IsWindowActiveAndVisible(windows_to_render_top_most[n])) // NavWindowingTarget is always temporarily displayed as the top-most window
             AddRootWindowToDrawData(ctx, windows_to_render_top_most[n]);
+    IMGUI_PROFILER_ZONE_END(ctx);
 
     // Draw software mouse cursor if requested by io.MouseDrawCursor flag
     if (g.IO.MouseDrawCursor && g.MouseCursor != ImGuiMouseCursor_None)
@@ -5105,6 +6670,7 @@ void ImGui::Render(ImGuiContext* ctx)
     g.IO.MetricsRenderVertices = g.IO.MetricsRenderIndices = 0;
     for (ImGuiViewportP* viewport : g.Viewports)
     {
+        IMGUI_PROFILER_ZONE(ctx, "FlattenDrawData");
         FlattenDrawDataIntoSingleLayer(&viewport->DrawDataBuilder);
 
         // Add foreground ImDrawList (for each active viewport)
@@ -5152,6 +6718,108 @@ ImVec2 ImGui::CalcTextSize(ImGuiContext* ctx, const char* text, const char* text
     return text_size;
 }
 
+// Retrieve cached word-wrapping layout for a block of text using current font, computing or updating it if needed.
+// - Layouts are identified by 'text_id', font, font size and current window, so the text pointer may change every frame.
+// - If 'text_id' == 0 the layout is identified by the order of submission of wrapped texts in the window instead, and the text contents
+//   are hashed every call to detect changes. If 'text_id' != 0 there is no O(n) hashing per call, but the caller needs to change the ID
+//   when contents change (only a change of length is detected).
+// - A same text ID used at different wrap widths during a frame gets one layout per width.
+// - Layouts are garbage collected by NewFrame() when not used during the previous frame.
+// - The returned pointer is only valid until the next call.
+ImGuiTextWrapLayout* ImGui::CalcTextWrapLayout(ImGuiContext* ctx, const char* text, const char* text_end, float wrap_width, ImGuiID text_id)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiWindow* window = g.CurrentWindow;
+    if (!text_end)
+        text_end = text + strlen(text); // FIXME-OPT
+
+    ImFont* font = g.Font;
+    const float font_size = g.FontSize;
+    const int text_len = (int)(text_end - text);
+    ImGuiID text_hash = 0;
+    if (text_id == 0)
+    {
+        text_hash = ImHashData(text, (size_t)text_len);
+        text_id = ImHashData(&window->DC.TextWrapLayoutCount, sizeof(int), ~window->ID);
+        window->DC.TextWrapLayoutCount++;
+    }
+    ImGuiID id = ImHashData(&font, sizeof(font), window->ID);
+    id = ImHashData(&font_size, sizeof(font_size), id);
+    id = ImHashData(&text_id, sizeof(text_id), id);
+
+    ImGuiTextWrapLayout* layout = g.TextWrapLayouts.GetOrAddByKey(id);
+    if (layout->LastFrameUsed == g.FrameCount && layout->WrapWidth != wrap_width)
+    {
+        // Same text submitted again at another width during this frame: use one layout per width instead of re-wrapping on every call.
+        id = ImHashData(&wrap_width, sizeof(wrap_width), id);
+        layout = g.TextWrapLayouts.GetOrAddByKey(id);
+    }
+    const bool layout_is_new = (layout->LastFrameUsed == -1 || layout->TextLen != text_len || layout->TextHash != text_hash);
+    layout->TextHash = text_hash;
+    layout->ID = id;
+    layout->LastFrameUsed = g.FrameCount;
+    if (!layout_is_new && layout->WrapWidth == wrap_width)
+        return layout;
+
+    ImVector<ImGuiTextWrapLine>& lines = layout->Lines;
+    if (layout_is_new)
+    {
+        // Wrap all paragraphs. A trailing '\n' doesn't create an extra line.
+        lines.resize(0);
+        for (const char* p = text; ; )
+        {
+            const char* p_end = (const char*)memchr(p, '\n', text_end - p);
+            if (p_end == NULL)
+                p_end = text_end;
+            if (p == text_end && p != text)
+                break;
+            ImFontCalcWrapLines(font, font_size, wrap_width, text, p, p_end, &lines);
+            if (p_end == text_end)
+                break;
+            p = p_end + 1;
+        }
+    }
+    else
+    {
+        // Wrap width changed: keep lines which would wrap at the same location, wrap remainder of paragraph from first line which doesn't.
+        // (comparing the exact unscaled values tested by CalcWordWrapPositionA(), so the result is identical to wrapping everything again)
+        const float scale = font_size / font->FontSize;
+        const float wrap_width_unscaled = wrap_width / scale;
+        const float prev_wrap_width_unscaled = layout->WrapWidth / scale;
+        ImVector<ImGuiTextWrapLine>& prev_lines = g.TextWrapLinesTemp;
+        prev_lines.swap(lines);
+        lines.resize(0);
+        lines.reserve(prev_lines.Size);
+        for (int line_n = 0; line_n < prev_lines.Size; )
+        {
+            const char* p = text + prev_lines[line_n].Begin;
+            const char* p_end = (const char*)memchr(p, '\n', text_end - p);
+            if (p_end == NULL)
+                p_end = text_end;
+            for (; line_n < prev_lines.Size && text + prev_lines[line_n].Begin <= p_end; line_n++)
+            {
+                const ImGuiTextWrapLine& line = prev_lines[line_n];
+                if (line.FitWidth > wrap_width_unscaled || line.BreakWidth <= wrap_width_unscaled || (line.BreakWordWidth < wrap_width_unscaled) != (line.BreakWordWidth < prev_wrap_width_unscaled))
+                {
+                    ImFontCalcWrapLines(font, font_size, wrap_width, text, text + line.Begin, p_end, &lines);
+                    while (line_n < prev_lines.Size && text + prev_lines[line_n].Begin <= p_end)
+                        line_n++;
+                    break;
+                }
+                lines.push_back(line);
+            }
+        }
+    }
+    layout->TextLen = text_len;
+    layout->WrapWidth = wrap_width;
+
+    float max_width = 0.0f;
+    for (const ImGuiTextWrapLine& line : lines)
+        max_width = ImMax(max_width, line.Width);
+    layout->Size = ImVec2(IM_TRUNC(max_width + 0.99999f), lines.Size * font_size);
+    return layout;
+}
+
 // Find window given position, search front-to-back
 // FIXME: Note that we have an inconsequential lag here: OuterRectClipped is updated in Begin(), so windows moved programmatically
 // with SetWindowPos() and not SetNextWindowPos() will have that rectangle lagging by a frame at the time FindHoveredWindow() is
@@ -5908,7 +7576,10 @@ static int ImGui::UpdateWindowManualResize(ImGuiContext* ctx, ImGuiWindow* windo
         ButtonBehavior(ctx, border_rect, border_id, &hovered, &held, ImGuiButtonFlags_FlattenChildren | ImGuiButtonFlags_NoNavFocus);
         //GetForegroundDrawList(window)->AddRect(border_rect.Min, border_rect.Max, IM_COL32(255, 255, 0, 255));
         if (hovered && g.HoveredIdTimer <= WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER)
+        {
+            RequestWakeup(ctx, WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER - g.HoveredIdTimer + 0.001f);
             hovered = false;
+        }
         if (hovered || held)
             g.MouseCursor = (axis == ImGuiAxis_X) ? ImGuiMouseCursor_ResizeEW : ImGuiMouseCursor_ResizeNS;
         if (held && g.IO.MouseDoubleClicked[0])
@@ -6320,6 +7991,7 @@ bool ImGui::Begin(ImGuiContext* ctx, const char* name, bool* p_open, ImGuiWindow
     IM_ASSERT(name != NULL && name[0] != '\0');     // Window name required
     IM_ASSERT(g.WithinFrameScope);                  // Forgot to call ImGui::NewFrame()
     IM_ASSERT(g.FrameCountEnded != g.FrameCount);   // Called ImGui::Render() or ImGui::EndFrame() and haven't called ImGui::NewFrame() again yet
+    IMGUI_PROFILER_ZONE_ARG(ctx, "Begin", name);
 
     // Find or create
     ImGuiWindow* window = FindWindowByName(ctx, name);
@@ -6799,7 +8471,7 @@ bool ImGui::Begin(ImGuiContext* ctx, const char* name, bool* p_open, ImGuiWindow
 
         // Setup draw list and outer clipping rectangle
         IM_ASSERT(window->DrawList->CmdBuffer.Size == 1 && window->DrawList->CmdBuffer[0].ElemCount == 0);
-        window->DrawList->PushTextureID(g.Font->ContainerAtlas->TexID);
+        window->DrawList->PushTextureID(g.Font->ContainerAtlas->GetGlyphsTexID());
         PushClipRect(ctx, host_rect.Min, host_rect.Max, false);
 
         // Child windows can render their decoration (bg color, border, scrollbars, etc.) within their parent to save a draw call (since 1.71)
@@ -6887,6 +8559,7 @@ bool ImGui::Begin(ImGuiContext* ctx, const char* name, bool* p_open, ImGuiWindow
         window->DC.MenuBarAppending = false;
         window->DC.MenuColumns.Update(style.ItemSpacing.x, window_just_activated_by_user);
         window->DC.TreeDepth = 0;
+        window->DC.TextWrapLayoutCount = 0;
         window->DC.TreeJumpToParentOnPopMask = 0x00;
         window->DC.ChildWindows.resize(0);
         window->DC.StateStorage = &window->StateStorage;
@@ -7031,6 +8704,7 @@ void ImGui::End(ImGuiContext* ctx)
         return;
     }
     IM_ASSERT(g.CurrentWindowStack.Size > 0);
+    IMGUI_PROFILER_ZONE_ARG(ctx, "End", window->Name);
 
     // Error checking: verify that user doesn't directly call End() on a child window.
     if (window->Flags & ImGuiWindowFlags_ChildWindow)
@@ -7251,7 +8925,7 @@ void ImGui::PushFont(ImGuiContext* ctx, ImFont* font)
         font = GetDefaultFont(ctx);
     SetCurrentFont(ctx, font);
     g.FontStack.push_back(font);
-    g.CurrentWindow->DrawList->PushTextureID(font->ContainerAtlas->TexID);
+    g.CurrentWindow->DrawList->PushTextureID(font->ContainerAtlas->GetGlyphsTexID());
 }
 
 void  ImGui::PopFont(ImGuiContext* ctx)
@@ -7457,7 +9131,10 @@ bool ImGui::IsWindowHovered(ImGuiContext* ctx, ImGuiHoveredFlags flags)
     if (flags & ImGuiHoveredFlags_ForTooltip)
         flags = ApplyHoverFlagsForTooltip(flags, g.Style.HoverFlagsForTooltipMouse);
     if ((flags & ImGuiHoveredFlags_Stationary) != 0 && g.HoverWindowUnlockedStationaryId != ref_window->ID)
+    {
+        RequestWakeup(ctx, g.Style.HoverStationaryDelay - g.MouseStationaryTimer);
         return false;
+    }
 
     return true;
 }
@@ -7895,6 +9572,14 @@ void ImGui::PushID(ImGuiContext* ctx, int int_id)
     window->IDStack.push_back(id);
 }
 
+void ImGui::PushID(ImGuiContext* ctx, const ImGuiLiteralID& str_id)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImGuiID id = GetIDWithSeed(ctx, str_id, window->IDStack.back());
+    window->IDStack.push_back(id);
+}
+
 // Push a given id value ignoring the ID stack as a seed.
 void ImGui::PushOverrideID(ImGuiContext* ctx, ImGuiID id)
 {
@@ -7926,6 +9611,39 @@ ImGuiID ImGui::GetIDWithSeed(ImGuiContext* ctx, int n, ImGuiID seed)
     return id;
 }
 
+// Combine a label hashed at compile time with a seed. Result is identical to ImHashStr(str_id.Str, 0, seed).
+// CRC32 is linear: crc(~seed, data) == crc(0, data) ^ crc(~seed, zeroes), so we only need the seed advanced by HashLen zero bytes.
+// - This is calculated 8 zero bytes at a time, so a cache miss costs about HashLen/8 table steps.
+// - Results are cached per (seed, length), so the many items submitted with a same ID stack hit, and so do
+//   loops such as 'for (i) { PushID(i); Button(ID_Apply); PopID(); }' from the second frame (seeds are the same every frame).
+ImGuiID ImGui::GetIDWithSeed(ImGuiContext* ctx, const ImGuiLiteralID& str_id, ImGuiID seed)
+{
+    ImGuiContext& g = *ctx;
+    const int len = str_id.HashLen;
+    ImGuiLiteralIDSeedShift* entry = &g.LiteralIDSeedShifts[(seed ^ (seed >> 16) ^ ((ImU32)len * 0x9E3779B1u)) % IM_ARRAYSIZE(g.LiteralIDSeedShifts)];
+    if (entry->Seed != seed || entry->Len != len)
+    {
+        ImU32 crc = ~seed;
+        int n = len;
+        for (; n >= 8; n -= 8)
+            crc = ImCrc32Update8(crc, 0, 0);
+        if (n >= 4)
+        {
+            crc = ImCrc32Update4(crc, 0);
+            n -= 4;
+        }
+        for (; n > 0; n--)
+            crc = ImCrc32Update1(crc, 0);
+        entry->Seed = seed;
+        entry->Len = len;
+        entry->Shift = crc;
+    }
+    ImGuiID id = ~(str_id.Hash ^ entry->Shift);
+    if (g.DebugHookIdInfo == id)
+        DebugHookIdInfo(ctx, id, ImGuiDataType_String, str_id.Str, NULL);
+    return id;
+}
+
 void ImGui::PopID(ImGuiContext* ctx)
 {
     ImGuiWindow* window = ctx->CurrentWindow;
@@ -7951,6 +9669,12 @@ ImGuiID ImGui::GetID(ImGuiContext* ctx, const void* ptr_id)
     return window->GetID(ptr_id);
 }
 
+ImGuiID ImGui::GetID(ImGuiContext* ctx, const ImGuiLiteralID& str_id)
+{
+    ImGuiWindow* window = ctx->CurrentWindow;
+    return GetIDWithSeed(ctx, str_id, window->IDStack.back());
+}
+
 bool ImGui::IsRectVisible(ImGuiContext* ctx, const ImVec2& size)
 {
     ImGuiWindow* window = ctx->CurrentWindow;
@@ -9057,6 +10781,7 @@ static void DebugPrintInputEvent(ImGuiContext* ctx, const char* prefix, const Im
 // - trickle_fast_inputs = true  : process as many events as possible (successive down/up/down/up will be trickled over several frames so nothing is lost) (new feature in 1.87)
 void ImGui::UpdateInputEvents(ImGuiContext* ctx, bool trickle_fast_inputs)
 {
+    IMGUI_PROFILER_ZONE(ctx, "UpdateInputEvents");
     ImGuiContext& g = *ctx;
     ImGuiIO& io = g.IO;
 
@@ -9069,6 +10794,14 @@ void ImGui::UpdateInputEvents(ImGuiContext* ctx, bool trickle_fast_inputs)
     int  mouse_button_changed = 0x00;
     ImBitArray<ImGuiKey_KeysData_SIZE> key_changed_mask;
 
+    // Move events submitted from other threads into the queue (see AddInputEvent())
+    if (g.InputEventsRing != NULL)
+    {
+        ImGuiInputEvent e;
+        while (InputEventRingPop(g.InputEventsRing, &e))
+            QueueInputEvent(ctx, &e);
+    }
+
     int event_n = 0;
     for (; event_n < g.InputEventsQueue.Size; event_n++)
     {
@@ -10567,6 +12300,7 @@ void ImGui::OpenPopupEx(ImGuiContext* ctx, ImGuiID id, ImGuiPopupFlags popup_fla
     popup_ref.OpenMousePos = IsMousePosValid(ctx, &g.IO.MousePos) ? g.IO.MousePos : popup_ref.OpenPopupPos;
 
     IMGUI_DEBUG_LOG_POPUP(ctx, "[popup] OpenPopupEx(0x%08X)\n", id);
+    RequestWakeup(ctx); // BeginPopup() may have been called before us this frame
     if (g.OpenPopupStack.Size < current_stack_size + 1)
     {
         g.OpenPopupStack.push_back(popup_ref);
@@ -11625,6 +13359,7 @@ float ImGui::GetNavTweakPressedAmount(ImGuiContext* ctx, ImGuiAxis axis)
 
 static void ImGui::NavUpdate(ImGuiContext* ctx)
 {
+    IMGUI_PROFILER_ZONE(ctx, "NavUpdate");
     ImGuiContext& g = *ctx;
     ImGuiIO& io = g.IO;
 
@@ -13159,6 +14894,11 @@ void ImGui::LogButtons(ImGuiContext* ctx)
 // - LoadIniSettingsFromMemory()
 // - SaveIniSettingsToDisk()
 // - SaveIniSettingsToMemory()
+// - SettingsWriter***() [Internal]
+// - LoadBinarySettingsFromDisk()
+// - LoadBinarySettingsFromMemory()
+// - SaveBinarySettingsToDisk()
+// - SaveBinarySettingsToMemory()
 //-----------------------------------------------------------------------------
 // - CreateNewWindowSettings() [Internal]
 // - FindWindowSettingsByID() [Internal]
@@ -13180,13 +14920,19 @@ void ImGui::UpdateSettings(ImGuiContext* ctx)
         g.SettingsLoaded = true;
     }
 
+    // Report completion of asynchronous writes
+    if (g.SettingsWriter != NULL)
+        SettingsWriterUpdate(ctx);
+
     // Save settings (with a delay after the last modification, so we don't spam disk too much)
     if (g.SettingsDirtyTimer > 0.0f)
     {
         g.SettingsDirtyTimer -= g.IO.DeltaTime;
         if (g.SettingsDirtyTimer <= 0.0f)
         {
-            if (g.IO.IniFilename != NULL)
+            if (g.IO.IniFilename != NULL && g.IO.ConfigIniSavingAsync)
+                SettingsWriterQueue(ctx, g.IO.IniFilename);
+            else if (g.IO.IniFilename != NULL)
                 SaveIniSettingsToDisk(ctx, g.IO.IniFilename);
             else
                 g.IO.WantSaveIniSettings = true;  // Let user know they can call SaveIniSettingsToMemory(). user will need to clear io.WantSaveIniSettings themselves.
@@ -13244,117 +14990,392 @@ void ImGui::ClearIniSettings(ImGuiContext* ctx)
             handler.ClearAllFn(&g, &handler);
 }
 
-void ImGui::LoadIniSettingsFromDisk(ImGuiContext* ctx, const char* ini_filename)
+void ImGui::LoadIniSettingsFromDisk(ImGuiContext* ctx, const char* ini_filename)
+{
+    size_t file_data_size = 0;
+    char* file_data = (char*)ImFileLoadToMemory(ctx, ini_filename, "rb", &file_data_size);
+    if (!file_data)
+        return;
+    if (file_data_size > 0)
+        LoadIniSettingsFromMemory(ctx, file_data, (size_t)file_data_size);
+    IM_FREE(file_data);
+}
+
+// Zero-tolerance, no error reporting, cheap .ini parsing
+// Parse lines and call handlers ReadOpenFn/ReadLineFn. The buffer is modified, buf_end[0] needs to be writable.
+static void LoadIniSettingsLines(ImGuiContext* ctx, char* buf, char* buf_end)
+{
+    ImGuiContext& g = *ctx;
+    void* entry_data = NULL;
+    ImGuiSettingsHandler* entry_handler = NULL;
+
+    char* line_end = NULL;
+    for (char* line = buf; line < buf_end; line = line_end + 1)
+    {
+        // Skip new lines markers, then find end of the line
+        while (*line == '\n' || *line == '\r')
+            line++;
+        line_end = line;
+        while (line_end < buf_end && *line_end != '\n' && *line_end != '\r')
+            line_end++;
+        line_end[0] = 0;
+        if (line[0] == ';')
+            continue;
+        if (line[0] == '[' && line_end > line && line_end[-1] == ']')
+        {
+            // Parse "[Type][Name]". Note that 'Name' can itself contains [] characters, which is acceptable with the current format and parsing code.
+            line_end[-1] = 0;
+            const char* name_end = line_end - 1;
+            const char* type_start = line + 1;
+            char* type_end = (char*)(void*)ImStrchrRange(type_start, name_end, ']');
+            const char* name_start = type_end ? ImStrchrRange(type_end + 1, name_end, '[') : NULL;
+            if (!type_end || !name_start)
+                continue;
+            *type_end = 0; // Overwrite first ']'
+            name_start++;  // Skip second '['
+            entry_handler = ImGui::FindSettingsHandler(ctx, type_start);
+            entry_data = entry_handler ? entry_handler->ReadOpenFn(&g, entry_handler, name_start) : NULL;
+        }
+        else if (entry_handler != NULL && entry_data != NULL)
+        {
+            // Let type handler parse the line
+            entry_handler->ReadLineFn(&g, entry_handler, entry_data, line);
+        }
+    }
+}
+
+// Set ini_size==0 to let us use strlen(ini_data). Do not call this function with a 0 if your buffer is actually empty!
+void ImGui::LoadIniSettingsFromMemory(ImGuiContext* ctx, const char* ini_data, size_t ini_size)
+{
+    ImGuiContext& g = *ctx;
+    IM_ASSERT(g.Initialized);
+    //IM_ASSERT(!g.WithinFrameScope && "Cannot be called between NewFrame() and EndFrame()");
+    //IM_ASSERT(g.SettingsLoaded == false && g.FrameCount == 0);
+
+    // For user convenience, we allow passing a non zero-terminated string (hence the ini_size parameter).
+    // For our convenience and to make the code simpler, we'll also write zero-terminators within the buffer. So let's create a writable copy..
+    if (ini_size == 0)
+        ini_size = strlen(ini_data);
+    g.SettingsIniData.Buf.resize((int)ini_size + 1);
+    char* const buf = g.SettingsIniData.Buf.Data;
+    char* const buf_end = buf + ini_size;
+    memcpy(buf, ini_data, ini_size);
+    buf_end[0] = 0;
+
+    // Call pre-read handlers
+    // Some types will clear their data (e.g. dock information) some types will allow merge/override (window)
+    for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+        if (handler.ReadInitFn != NULL)
+            handler.ReadInitFn(&g, &handler);
+
+    LoadIniSettingsLines(ctx, buf, buf_end);
+    g.SettingsLoaded = true;
+
+    // [DEBUG] Restore untouched copy so it can be browsed in Metrics (not strictly necessary)
+    memcpy(buf, ini_data, ini_size);
+
+    // Call post-read handlers
+    for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+        if (handler.ApplyAllFn != NULL)
+            handler.ApplyAllFn(&g, &handler);
+}
+
+void ImGui::SaveIniSettingsToDisk(ImGuiContext* ctx, const char* ini_filename)
+{
+    ImGuiContext& g = *ctx;
+    g.SettingsDirtyTimer = 0.0f;
+    if (!ini_filename)
+        return;
+
+    size_t ini_data_size = 0;
+    const char* ini_data = SaveIniSettingsToMemory(ctx, &ini_data_size);
+    ImFileHandle f = ImFileOpen(ctx, ini_filename, "wt");
+    if (!f)
+        return;
+    ImFileWrite(ini_data, sizeof(char), ini_data_size, f);
+    ImFileClose(f);
+}
+
+// Call registered handlers (e.g. SettingsHandlerWindow_WriteAll() + custom handlers) to write their stuff into a text buffer
+const char* ImGui::SaveIniSettingsToMemory(ImGuiContext* ctx, size_t* out_size)
+{
+    ImGuiContext& g = *ctx;
+    g.SettingsDirtyTimer = 0.0f;
+    g.SettingsIniData.Buf.resize(0);
+    g.SettingsIniData.Buf.push_back(0);
+    for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+        handler.WriteAllFn(&g, &handler, &g.SettingsIniData);
+    if (out_size)
+        *out_size = (size_t)g.SettingsIniData.size();
+    return g.SettingsIniData.c_str();
+}
+
+// Asynchronous .ini saving (io.ConfigIniSavingAsync)
+// - The main thread formats .ini data (cheap as unchanged entries are cached) and hands a copy to the writer thread.
+// - The writer thread writes it to "<ini_filename>.tmp" and renames it over ini_filename, so a crash or a slow/full disk never leaves a truncated file.
+// - If data is queued while the writer is busy, only the most recent data will be written.
+// - Completion is reported to io.IniSavingInProgress/io.IniSavingFailed/io.IniSavingCompletedCount by NewFrame().
+// - The writer thread calls ImFileOpen() with a NULL context, and ImFileWrite(), ImFileClose(), ImFileRename(), so those need to be thread-safe if you implement them yourself.
+#ifdef IMGUI_ENABLE_ASYNC_INI_SAVING
+struct ImGuiSettingsWriter
+{
+    std::thread             Thread;
+    std::mutex              Mutex;
+    std::condition_variable Cond;
+    ImVector<char>          StagingData;        // [Main thread] Copy of .ini data being prepared
+    ImVector<char>          StagingFilename;    // [Main thread]
+    ImVector<char>          PendingData;        // [Locked] Data to write next (swapped with StagingData)
+    ImVector<char>          PendingFilename;    // [Locked]
+    ImVector<char>          WriteData;          // [Writer thread] Data being written (swapped with PendingData)
+    ImVector<char>          WriteFilename;      // [Writer thread]
+    bool                    HasPending;         // [Locked]
+    bool                    Busy;               // [Locked] Writer is writing WriteData
+    bool                    Quit;               // [Locked] Exit after writing pending data
+    bool                    LastFailed;         // [Locked]
+    int                     CompletedCount;     // [Locked]
+
+    ImGuiSettingsWriter()   { HasPending = Busy = Quit = LastFailed = false; CompletedCount = 0; }
+};
+
+static bool SettingsWriterWriteFile(const char* filename, const char* data, size_t data_size)
+{
+    char tmp_filename[1024];
+    if (ImFormatString(tmp_filename, IM_ARRAYSIZE(tmp_filename), "%s.tmp", filename) >= IM_ARRAYSIZE(tmp_filename) - 1)
+        return false;
+    ImFileHandle f = ImFileOpen(NULL, tmp_filename, "wt");
+    if (!f)
+        return false;
+    const bool write_ok = ImFileWrite(data, sizeof(char), data_size, f) == data_size;
+    const bool close_ok = ImFileClose(f);
+    return write_ok && close_ok && ImFileRename(tmp_filename, filename);
+}
+
+static void SettingsWriterThreadMain(ImGuiSettingsWriter* w)
+{
+    std::unique_lock<std::mutex> lock(w->Mutex);
+    while (true)
+    {
+        while (!w->HasPending && !w->Quit)
+            w->Cond.wait(lock);
+        if (!w->HasPending)
+            break;
+        w->WriteData.swap(w->PendingData);
+        w->WriteFilename.swap(w->PendingFilename);
+        w->HasPending = false;
+        w->Busy = true;
+
+        lock.unlock();
+        const bool ok = SettingsWriterWriteFile(w->WriteFilename.Data, w->WriteData.Data, (size_t)w->WriteData.Size);
+        lock.lock();
+
+        w->Busy = false;
+        w->LastFailed = !ok;
+        w->CompletedCount++;
+    }
+}
+
+static void SettingsWriterQueue(ImGuiContext* ctx, const char* ini_filename)
+{
+    ImGuiContext& g = *ctx;
+    size_t ini_data_size = 0;
+    const char* ini_data = ImGui::SaveIniSettingsToMemory(ctx, &ini_data_size);
+
+    if (g.SettingsWriter == NULL)
+    {
+        g.SettingsWriter = IM_NEW(ImGuiSettingsWriter)();
+        g.SettingsWriter->Thread = std::thread(SettingsWriterThreadMain, g.SettingsWriter);
+    }
+    ImGuiSettingsWriter* w = g.SettingsWriter;
+
+    // Copy outside of the lock, then swap
+    w->StagingData.resize((int)ini_data_size);
+    if (ini_data_size > 0)
+        memcpy(w->StagingData.Data, ini_data, ini_data_size);
+    const size_t filename_size = strlen(ini_filename) + 1;
+    w->StagingFilename.resize((int)filename_size);
+    memcpy(w->StagingFilename.Data, ini_filename, filename_size);
+    {
+        std::lock_guard<std::mutex> lock(w->Mutex);
+        w->PendingData.swap(w->StagingData);
+        w->PendingFilename.swap(w->StagingFilename);
+        w->HasPending = true;
+    }
+    w->Cond.notify_one();
+    g.IO.IniSavingInProgress = true;
+}
+
+static void SettingsWriterUpdate(ImGuiContext* ctx)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiSettingsWriter* w = g.SettingsWriter;
+    std::lock_guard<std::mutex> lock(w->Mutex);
+    g.IO.IniSavingInProgress = w->HasPending || w->Busy;
+    g.IO.IniSavingFailed = w->LastFailed;
+    g.IO.IniSavingCompletedCount = w->CompletedCount;
+}
+
+// Write pending data and stop the writer thread
+static void SettingsWriterShutdown(ImGuiContext* ctx)
 {
-    size_t file_data_size = 0;
-    char* file_data = (char*)ImFileLoadToMemory(ctx, ini_filename, "rb", &file_data_size);
-    if (!file_data)
+    ImGuiContext& g = *ctx;
+    ImGuiSettingsWriter* w = g.SettingsWriter;
+    if (w == NULL)
         return;
-    if (file_data_size > 0)
-        LoadIniSettingsFromMemory(ctx, file_data, (size_t)file_data_size);
-    IM_FREE(file_data);
+    {
+        std::lock_guard<std::mutex> lock(w->Mutex);
+        w->Quit = true;
+    }
+    w->Cond.notify_one();
+    w->Thread.join();
+    SettingsWriterUpdate(ctx);
+    IM_DELETE(w);
+    g.SettingsWriter = NULL;
 }
+#else
+static void SettingsWriterQueue(ImGuiContext* ctx, const char* ini_filename) { ImGui::SaveIniSettingsToDisk(ctx, ini_filename); }
+static void SettingsWriterUpdate(ImGuiContext*) {}
+static void SettingsWriterShutdown(ImGuiContext*) {}
+#endif // #ifdef IMGUI_ENABLE_ASYNC_INI_SAVING
 
-// Zero-tolerance, no error reporting, cheap .ini parsing
-// Set ini_size==0 to let us use strlen(ini_data). Do not call this function with a 0 if your buffer is actually empty!
-void ImGui::LoadIniSettingsFromMemory(ImGuiContext* ctx, const char* ini_data, size_t ini_size)
+bool ImGui::LoadBinarySettingsFromDisk(ImGuiContext* ctx, const char* filename)
+{
+    size_t data_size = 0;
+    void* data = ImFileMapToMemory(ctx, filename, &data_size);
+    if (!data)
+        return false;
+    const bool ret = LoadBinarySettingsFromMemory(ctx, data, data_size);
+    ImFileUnmapFromMemory(data, data_size);
+    return ret;
+}
+
+// Binary data is read in place: handlers get a pointer to their chunk, only chunks containing .ini text are copied and parsed.
+bool ImGui::LoadBinarySettingsFromMemory(ImGuiContext* ctx, const void* data, size_t data_size)
 {
     ImGuiContext& g = *ctx;
     IM_ASSERT(g.Initialized);
-    //IM_ASSERT(!g.WithinFrameScope && "Cannot be called between NewFrame() and EndFrame()");
-    //IM_ASSERT(g.SettingsLoaded == false && g.FrameCount == 0);
 
-    // For user convenience, we allow passing a non zero-terminated string (hence the ini_size parameter).
-    // For our convenience and to make the code simpler, we'll also write zero-terminators within the buffer. So let's create a writable copy..
-    if (ini_size == 0)
-        ini_size = strlen(ini_data);
-    g.SettingsIniData.Buf.resize((int)ini_size + 1);
-    char* const buf = g.SettingsIniData.Buf.Data;
-    char* const buf_end = buf + ini_size;
-    memcpy(buf, ini_data, ini_size);
-    buf_end[0] = 0;
+    // Validate header and chunks before calling any handler, so corrupted data can't be partially loaded
+    ImGuiSettingsBinaryHeader header;
+    if (data_size < sizeof(header))
+        return false;
+    memcpy(&header, data, sizeof(header));
+    if (header.Magic != IMGUI_SETTINGS_BINARY_MAGIC || header.Version != IMGUI_SETTINGS_BINARY_VERSION || header.DataSize < sizeof(header) || header.DataSize > data_size)
+        return false;
+    const char* const data_start = (const char*)data + sizeof(header);
+    const char* const data_end = (const char*)data + header.DataSize;
+    const char* p = data_start;
+    for (ImU32 chunk_n = 0; chunk_n < header.ChunksCount; chunk_n++)
+    {
+        ImGuiSettingsBinaryChunk chunk;
+        if (!ImSettingsBinaryRead(&p, data_end, &chunk, sizeof(chunk)) || (size_t)(data_end - p) < chunk.Size)
+            return false;
+        p += ImMin((size_t)IM_MEMALIGN(chunk.Size, 8), (size_t)(data_end - p));
+    }
 
     // Call pre-read handlers
-    // Some types will clear their data (e.g. dock information) some types will allow merge/override (window)
     for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
         if (handler.ReadInitFn != NULL)
             handler.ReadInitFn(&g, &handler);
 
-    void* entry_data = NULL;
-    ImGuiSettingsHandler* entry_handler = NULL;
-
-    char* line_end = NULL;
-    for (char* line = buf; line < buf_end; line = line_end + 1)
+    ImVector<char> text_buf;
+    p = data_start;
+    for (ImU32 chunk_n = 0; chunk_n < header.ChunksCount; chunk_n++)
     {
-        // Skip new lines markers, then find end of the line
-        while (*line == '\n' || *line == '\r')
-            line++;
-        line_end = line;
-        while (line_end < buf_end && *line_end != '\n' && *line_end != '\r')
-            line_end++;
-        line_end[0] = 0;
-        if (line[0] == ';')
-            continue;
-        if (line[0] == '[' && line_end > line && line_end[-1] == ']')
-        {
-            // Parse "[Type][Name]". Note that 'Name' can itself contains [] characters, which is acceptable with the current format and parsing code.
-            line_end[-1] = 0;
-            const char* name_end = line_end - 1;
-            const char* type_start = line + 1;
-            char* type_end = (char*)(void*)ImStrchrRange(type_start, name_end, ']');
-            const char* name_start = type_end ? ImStrchrRange(type_end + 1, name_end, '[') : NULL;
-            if (!type_end || !name_start)
-                continue;
-            *type_end = 0; // Overwrite first ']'
-            name_start++;  // Skip second '['
-            entry_handler = FindSettingsHandler(ctx, type_start);
-            entry_data = entry_handler ? entry_handler->ReadOpenFn(&g, entry_handler, name_start) : NULL;
-        }
-        else if (entry_handler != NULL && entry_data != NULL)
+        ImGuiSettingsBinaryChunk chunk;
+        ImSettingsBinaryRead(&p, data_end, &chunk, sizeof(chunk));
+        const char* chunk_data = p;
+        p += ImMin((size_t)IM_MEMALIGN(chunk.Size, 8), (size_t)(data_end - p));
+        if (chunk.Flags & ImGuiSettingsBinaryChunkFlags_Text)
         {
-            // Let type handler parse the line
-            entry_handler->ReadLineFn(&g, entry_handler, entry_data, line);
+            // Text from a handler which can't write binary data: parse as .ini data
+            text_buf.resize((int)chunk.Size + 1);
+            memcpy(text_buf.Data, chunk_data, chunk.Size);
+            text_buf[(int)chunk.Size] = 0;
+            LoadIniSettingsLines(ctx, text_buf.Data, text_buf.Data + chunk.Size);
+            continue;
         }
+        for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+            if (handler.TypeHash == chunk.TypeHash && handler.ReadBinaryFn != NULL)
+            {
+                handler.ReadBinaryFn(&g, &handler, (int)chunk.Version, chunk_data, chunk.Size);
+                break;
+            }
     }
     g.SettingsLoaded = true;
 
-    // [DEBUG] Restore untouched copy so it can be browsed in Metrics (not strictly necessary)
-    memcpy(buf, ini_data, ini_size);
-
     // Call post-read handlers
     for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
         if (handler.ApplyAllFn != NULL)
             handler.ApplyAllFn(&g, &handler);
+    return true;
 }
 
-void ImGui::SaveIniSettingsToDisk(ImGuiContext* ctx, const char* ini_filename)
+void ImGui::SaveBinarySettingsToDisk(ImGuiContext* ctx, const char* filename)
 {
     ImGuiContext& g = *ctx;
     g.SettingsDirtyTimer = 0.0f;
-    if (!ini_filename)
+    if (!filename)
         return;
 
-    size_t ini_data_size = 0;
-    const char* ini_data = SaveIniSettingsToMemory(ctx, &ini_data_size);
-    ImFileHandle f = ImFileOpen(ctx, ini_filename, "wt");
+    size_t data_size = 0;
+    const void* data = SaveBinarySettingsToMemory(ctx, &data_size);
+    ImFileHandle f = ImFileOpen(ctx, filename, "wb");
     if (!f)
         return;
-    ImFileWrite(ini_data, sizeof(char), ini_data_size, f);
+    ImFileWrite(data, 1, data_size, f);
     ImFileClose(f);
 }
 
-// Call registered handlers (e.g. SettingsHandlerWindow_WriteAll() + custom handlers) to write their stuff into a text buffer
-const char* ImGui::SaveIniSettingsToMemory(ImGuiContext* ctx, size_t* out_size)
+// Call registered handlers WriteBinaryFn, or WriteAllFn for handlers which don't support binary data.
+const void* ImGui::SaveBinarySettingsToMemory(ImGuiContext* ctx, size_t* out_data_size)
 {
     ImGuiContext& g = *ctx;
     g.SettingsDirtyTimer = 0.0f;
-    g.SettingsIniData.Buf.resize(0);
-    g.SettingsIniData.Buf.push_back(0);
+    ImVector<char>& buf = g.SettingsBinaryData;
+    buf.resize(sizeof(ImGuiSettingsBinaryHeader));
+
+    ImGuiSettingsBinaryHeader header;
+    header.Magic = IMGUI_SETTINGS_BINARY_MAGIC;
+    header.Version = IMGUI_SETTINGS_BINARY_VERSION;
+    header.ChunksCount = 0;
+
+    ImGuiTextBuffer text_buf;
     for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
-        handler.WriteAllFn(&g, &handler, &g.SettingsIniData);
-    if (out_size)
-        *out_size = (size_t)g.SettingsIniData.size();
-    return g.SettingsIniData.c_str();
+    {
+        ImGuiSettingsBinaryChunk chunk;
+        chunk.TypeHash = handler.TypeHash;
+        const int chunk_offset = buf.Size;
+        buf.resize(buf.Size + (int)sizeof(chunk));
+        if (handler.WriteBinaryFn != NULL)
+        {
+            handler.WriteBinaryFn(&g, &handler, &buf);
+            chunk.Version = (ImU32)handler.BinaryVersion;
+            chunk.Flags = ImGuiSettingsBinaryChunkFlags_None;
+        }
+        else
+        {
+            text_buf.Buf.resize(0);
+            handler.WriteAllFn(&g, &handler, &text_buf);
+            ImSettingsBinaryWrite(&buf, text_buf.begin(), (size_t)text_buf.size());
+            chunk.Version = 0;
+            chunk.Flags = ImGuiSettingsBinaryChunkFlags_Text;
+        }
+        chunk.Size = (ImU32)(buf.Size - chunk_offset - (int)sizeof(chunk));
+        if (chunk.Size == 0)
+        {
+            buf.resize(chunk_offset);
+            continue;
+        }
+        memcpy(buf.Data + chunk_offset, &chunk, sizeof(chunk));
+        ImSettingsBinaryWritePadding(&buf, chunk.Size, 8);
+        header.ChunksCount++;
+    }
+    header.DataSize = (ImU32)buf.Size;
+    memcpy(buf.Data, &header, sizeof(header));
+
+    if (out_data_size)
+        *out_data_size = (size_t)buf.Size;
+    return buf.Data;
 }
 
 ImGuiWindowSettings* ImGui::CreateNewWindowSettings(ImGuiContext* ctx, const char* name)
@@ -13375,8 +15396,11 @@ ImGuiWindowSettings* ImGui::CreateNewWindowSettings(ImGuiContext* ctx, const cha
     ImGuiWindowSettings* settings = g.SettingsWindows.alloc_chunk(chunk_size);
     IM_PLACEMENT_NEW(settings) ImGuiWindowSettings();
     settings->ID = ImHashStr(name, name_len);
+    settings->IsDirty = true;
     memcpy(settings->GetName(), name, name_len + 1);   // Store with zero terminator
 
+    // Newer entry takes precedence over a previous one with same ID (which would have been deleted)
+    g.SettingsWindowsById.SetInt(settings->ID, g.SettingsWindows.offset_from_ptr(settings));
     return settings;
 }
 
@@ -13385,9 +15409,12 @@ ImGuiWindowSettings* ImGui::CreateNewWindowSettings(ImGuiContext* ctx, const cha
 ImGuiWindowSettings* ImGui::FindWindowSettingsByID(ImGuiContext* ctx, ImGuiID id)
 {
     ImGuiContext& g = *ctx;
-    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
-        if (settings->ID == id && !settings->WantDelete)
-            return settings;
+    const int offset = g.SettingsWindowsById.GetInt(id, -1);
+    if (offset == -1)
+        return NULL;
+    ImGuiWindowSettings* settings = g.SettingsWindows.ptr_from_offset(offset);
+    if (settings->ID == id && !settings->WantDelete)
+        return settings;
     return NULL;
 }
 
@@ -13420,6 +15447,7 @@ static void WindowSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandl
     for (ImGuiWindow* window : g.Windows)
         window->SettingsOffset = -1;
     g.SettingsWindows.clear();
+    g.SettingsWindowsById.Clear();
 }
 
 static void* WindowSettingsHandler_ReadOpen(ImGuiContext* ctx, ImGuiSettingsHandler*, const char* name)
@@ -13432,6 +15460,7 @@ static void* WindowSettingsHandler_ReadOpen(ImGuiContext* ctx, ImGuiSettingsHand
         settings = ImGui::CreateNewWindowSettings(ctx, name);
     settings->ID = id;
     settings->WantApply = true;
+    settings->IsDirty = true;
     return (void*)settings;
 }
 
@@ -13459,10 +15488,10 @@ static void WindowSettingsHandler_ApplyAll(ImGuiContext* ctx, ImGuiSettingsHandl
         }
 }
 
-static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+// Gather data from windows that were active during this session
+// (if a window wasn't opened in this session we preserve its settings)
+static void WindowSettingsHandler_GatherAll(ImGuiContext* ctx)
 {
-    // Gather data from windows that were active during this session
-    // (if a window wasn't opened in this session we preserve its settings)
     ImGuiContext& g = *ctx;
     for (ImGuiWindow* window : g.Windows)
     {
@@ -13476,19 +15505,43 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
             window->SettingsOffset = g.SettingsWindows.offset_from_ptr(settings);
         }
         IM_ASSERT(settings->ID == window->ID);
-        settings->Pos = ImVec2ih(window->Pos);
-        settings->Size = ImVec2ih(window->SizeFull);
-        settings->IsChild = (window->Flags & ImGuiWindowFlags_ChildWindow) != 0;
+        const ImVec2ih pos(window->Pos);
+        const ImVec2ih size(window->SizeFull);
+        const bool is_child = (window->Flags & ImGuiWindowFlags_ChildWindow) != 0;
+        if (settings->Pos.x != pos.x || settings->Pos.y != pos.y || settings->Size.x != size.x || settings->Size.y != size.y || settings->IsChild != is_child || settings->Collapsed != window->Collapsed)
+            settings->IsDirty = true;
+        settings->Pos = pos;
+        settings->Size = size;
+        settings->IsChild = is_child;
         settings->Collapsed = window->Collapsed;
         settings->WantDelete = false;
     }
+}
+
+static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *ctx;
+    WindowSettingsHandler_GatherAll(ctx);
 
     // Write to text buffer
-    buf->reserve(buf->size() + g.SettingsWindows.size() * 6); // ballpark reserve
+    // Entries which haven't changed since last write are copied from the cache instead of being formatted again.
+    ImGuiTextBuffer* cache = &g.SettingsWindowsIniCache;
+    const int buf_start = buf->size();
+    buf->reserve(buf->size() + ImMax(g.SettingsWindows.size() * 6, cache->size())); // ballpark reserve
     for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
     {
         if (settings->WantDelete)
+        {
+            settings->IsDirty = true; // Cached text won't survive this write
+            continue;
+        }
+        const int entry_start = buf->size();
+        if (!settings->IsDirty && settings->IniSize > 0)
+        {
+            buf->append(cache->begin() + settings->IniOffset, cache->begin() + settings->IniOffset + settings->IniSize);
+            settings->IniOffset = entry_start - buf_start;
             continue;
+        }
         const char* settings_name = settings->GetName();
         buf->appendf("[%s][%s]\n", handler->TypeName, settings_name);
         if (settings->IsChild)
@@ -13504,6 +15557,68 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
                 buf->appendf("Collapsed=1\n");
         }
         buf->append("\n");
+        settings->IniOffset = entry_start - buf_start;
+        settings->IniSize = buf->size() - entry_start;
+        settings->IsDirty = false;
+    }
+    cache->Buf.resize(0);
+    cache->append(buf->begin() + buf_start, buf->end());
+}
+
+// Binary entry: ImGuiWindowSettingsBinary followed by zero-terminated name (NameSize bytes), padded to 4 bytes
+struct ImGuiWindowSettingsBinary
+{
+    ImVec2ih    Pos;
+    ImVec2ih    Size;
+    ImU32       NameSize;       // Including zero-terminator
+    ImU8        Collapsed;
+    ImU8        IsChild;
+    ImU16       Padding;
+};
+
+static void WindowSettingsHandler_ReadBinary(ImGuiContext* ctx, ImGuiSettingsHandler* handler, int version, const void* data, size_t data_size)
+{
+    if (version != 1)
+        return;
+    const char* p = (const char*)data;
+    const char* p_end = p + data_size;
+    ImGuiWindowSettingsBinary entry;
+    while (ImSettingsBinaryRead(&p, p_end, &entry, sizeof(entry)))
+    {
+        const char* name = p;
+        if (entry.NameSize == 0 || (size_t)(p_end - p) < entry.NameSize || name[entry.NameSize - 1] != 0)
+            return;
+        p += ImMin((size_t)IM_MEMALIGN(entry.NameSize, 4), (size_t)(p_end - p));
+
+        ImGuiWindowSettings* settings = (ImGuiWindowSettings*)WindowSettingsHandler_ReadOpen(ctx, handler, name);
+        settings->Pos = entry.Pos;
+        settings->Size = entry.Size;
+        settings->Collapsed = (entry.Collapsed != 0);
+        settings->IsChild = (entry.IsChild != 0);
+    }
+}
+
+static void WindowSettingsHandler_WriteBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, ImVector<char>* buf)
+{
+    ImGuiContext& g = *ctx;
+    WindowSettingsHandler_GatherAll(ctx);
+
+    buf->reserve(buf->Size + g.SettingsWindows.size()); // ballpark reserve
+    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
+    {
+        if (settings->WantDelete)
+            continue;
+        const char* name = settings->GetName();
+        ImGuiWindowSettingsBinary entry;
+        memset(&entry, 0, sizeof(entry));
+        entry.Pos = settings->Pos;
+        entry.Size = settings->Size;
+        entry.NameSize = (ImU32)strlen(name) + 1;
+        entry.Collapsed = settings->Collapsed ? 1 : 0;
+        entry.IsChild = settings->IsChild ? 1 : 0;
+        ImSettingsBinaryWrite(buf, &entry, sizeof(entry));
+        ImSettingsBinaryWrite(buf, name, entry.NameSize);
+        ImSettingsBinaryWritePadding(buf, entry.NameSize, 4);
     }
 }
 
@@ -13738,6 +15853,179 @@ static void SetPlatformImeDataFn_DefaultImpl(ImGuiViewport*, ImGuiPlatformImeDat
 
 #endif
 
+//-----------------------------------------------------------------------------
+// [SECTION] PROFILER
+//-----------------------------------------------------------------------------
+// - ProfilerNewFrame() [Internal]
+// - ProfilerZoneBegin() [Internal]
+// - ProfilerZoneEnd() [Internal]
+// - ProfilerExportChromeTraceToBuffer() [Internal]
+// - ProfilerExportChromeTrace() [Internal]
+//-----------------------------------------------------------------------------
+// Zones are recorded with IMGUI_PROFILER_ZONE() in the main phases of NewFrame(), Begin(), End(), EndFrame(), Render() and TableUpdateLayout().
+// Each frame stores its zones in a ring buffer of IMGUI_PROFILER_MAX_FRAMES frames. Buffers are reused so recording doesn't allocate once warmed up.
+// Times are in microseconds, which is the unit used by the Chrome trace_event format.
+//-----------------------------------------------------------------------------
+
+#ifdef IMGUI_ENABLE_PROFILER
+
+static double ProfilerGetTime(const ImGuiProfiler* profiler)
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now().time_since_epoch()).count() - profiler->TimeBase;
+}
+
+ImGuiProfilerScope::ImGuiProfilerScope(ImGuiContext* ctx, const char* name, const char* arg)
+{
+    Ctx = ctx;
+    Active = ImGui::ProfilerZoneBegin(ctx, name, arg);
+}
+
+ImGuiProfilerScope::~ImGuiProfilerScope()
+{
+    if (Active)
+        ImGui::ProfilerZoneEnd(Ctx);
+}
+
+// Called at the beginning of NewFrame(): complete the frame being recorded and start a new one.
+void ImGui::ProfilerNewFrame(ImGuiContext* ctx)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiProfiler* profiler = &g.DebugProfiler;
+    if (profiler->Recording)
+    {
+        // Close zones left open (e.g. Render() was not called)
+        while (profiler->ZonesStack.Size > 0)
+            ProfilerZoneEnd(ctx);
+        profiler->Frames[profiler->FramesIdx].FrameCount = g.FrameCount;
+        profiler->FramesIdx = (profiler->FramesIdx + 1) % IMGUI_PROFILER_MAX_FRAMES;
+        profiler->FramesCount = ImMin(profiler->FramesCount + 1, IMGUI_PROFILER_MAX_FRAMES - 1);
+    }
+
+    profiler->Recording = profiler->Enabled;
+    if (!profiler->Recording)
+        return;
+    if (profiler->Frames.Size == 0)
+    {
+        profiler->Frames.resize(IMGUI_PROFILER_MAX_FRAMES, ImGuiProfilerFrame());
+        profiler->TimeBase = ProfilerGetTime(profiler);
+    }
+    ImGuiProfilerFrame* frame = &profiler->Frames[profiler->FramesIdx];
+    frame->FrameCount = -1;
+    frame->StartTime = frame->EndTime = ProfilerGetTime(profiler);
+    frame->Zones.resize(0);
+    frame->Args.resize(0);
+}
+
+bool ImGui::ProfilerZoneBegin(ImGuiContext* ctx, const char* name, const char* arg)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiProfiler* profiler = &g.DebugProfiler;
+    if (!profiler->Recording)
+        return false;
+
+    ImGuiProfilerFrame* frame = &profiler->Frames[profiler->FramesIdx];
+    profiler->ZonesStack.push_back(frame->Zones.Size);
+    frame->Zones.resize(frame->Zones.Size + 1);
+    ImGuiProfilerZone* zone = &frame->Zones.back();
+    zone->Name = name;
+    zone->ArgOffset = -1;
+    zone->Depth = profiler->ZonesStack.Size - 1;
+    if (arg != NULL)
+    {
+        const int arg_len = (int)strlen(arg);
+        zone->ArgOffset = frame->Args.Size;
+        frame->Args.resize(frame->Args.Size + arg_len + 1);
+        memcpy(frame->Args.Data + zone->ArgOffset, arg, (size_t)arg_len + 1);
+    }
+    zone->StartTime = zone->EndTime = ProfilerGetTime(profiler);
+    return true;
+}
+
+void ImGui::ProfilerZoneEnd(ImGuiContext* ctx)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiProfiler* profiler = &g.DebugProfiler;
+    if (!profiler->Recording || profiler->ZonesStack.Size == 0)
+        return;
+
+    const double time = ProfilerGetTime(profiler);
+    ImGuiProfilerFrame* frame = &profiler->Frames[profiler->FramesIdx];
+    ImGuiProfilerZone* zone = &frame->Zones[profiler->ZonesStack.back()];
+    profiler->ZonesStack.pop_back();
+    zone->EndTime = time;
+    if (zone->Depth == 0)
+        frame->EndTime = time;
+}
+
+static void ProfilerAppendJsonString(ImGuiTextBuffer* buf, const char* str)
+{
+    buf->append("\"");
+    for (const char* p = str; *p; p++)
+    {
+        const char c = *p;
+        if (c == '"' || c == '\\')
+            buf->appendf("\\%c", c);
+        else if ((unsigned char)c < 0x20)
+            buf->appendf("\\u%04x", (unsigned int)c);
+        else
+            buf->append(p, p + 1);
+    }
+    buf->append("\"");
+}
+
+// Export completed frames, oldest first, in Chrome trace_event JSON format.
+// Each frame is output as a "Frame" event containing its zones. Zone arguments (window names) are output as "args":{"name":...}.
+void ImGui::ProfilerExportChromeTraceToBuffer(ImGuiContext* ctx, ImGuiTextBuffer* out_buf)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiProfiler* profiler = &g.DebugProfiler;
+    out_buf->append("{\"traceEvents\":[");
+    bool first = true;
+    for (int frame_offset = profiler->FramesCount - 1; frame_offset >= 0; frame_offset--)
+    {
+        const ImGuiProfilerFrame* frame = profiler->GetFrame(frame_offset);
+        out_buf->appendf("%s\n{\"name\":\"Frame %d\",\"cat\":\"frame\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":0}",
+            first ? "" : ",", frame->FrameCount, frame->StartTime, frame->EndTime - frame->StartTime);
+        first = false;
+        for (const ImGuiProfilerZone& zone : frame->Zones)
+        {
+            out_buf->append(",\n{\"name\":");
+            ProfilerAppendJsonString(out_buf, zone.Name);
+            out_buf->appendf(",\"cat\":\"imgui\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":0", zone.StartTime, zone.EndTime - zone.StartTime);
+            if (const char* arg = frame->GetArg(&zone))
+            {
+                out_buf->append(",\"args\":{\"name\":");
+                ProfilerAppendJsonString(out_buf, arg);
+                out_buf->append("}");
+            }
+            out_buf->append("}");
+        }
+    }
+    out_buf->append("\n],\"displayTimeUnit\":\"ms\"}\n");
+}
+
+bool ImGui::ProfilerExportChromeTrace(ImGuiContext* ctx, const char* filename)
+{
+    ImGuiTextBuffer buf;
+    ProfilerExportChromeTraceToBuffer(ctx, &buf);
+    ImFileHandle f = ImFileOpen(ctx, filename, "wb");
+    if (!f)
+        return false;
+    const bool write_ok = ImFileWrite(buf.c_str(), sizeof(char), (ImU64)buf.size(), f) == (ImU64)buf.size();
+    ImFileClose(f);
+    return write_ok;
+}
+
+#else
+
+void ImGui::ProfilerNewFrame(ImGuiContext*) {}
+bool ImGui::ProfilerZoneBegin(ImGuiContext*, const char*, const char*) { return false; }
+void ImGui::ProfilerZoneEnd(ImGuiContext*) {}
+void ImGui::ProfilerExportChromeTraceToBuffer(ImGuiContext*, ImGuiTextBuffer*) {}
+bool ImGui::ProfilerExportChromeTrace(ImGuiContext*, const char*) { return false; }
+
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
 //-----------------------------------------------------------------------------
 // [SECTION] METRICS/DEBUGGER WINDOW
 //-----------------------------------------------------------------------------
@@ -13752,6 +16040,7 @@ static void SetPlatformImeDataFn_DefaultImpl(ImGuiViewport*, ImGuiPlatformImeDat
 // - DebugNodeDrawCmdShowMeshAndBoundingBox() [Internal]
 // - DebugNodeFont() [Internal]
 // - DebugNodeFontGlyph() [Internal]
+// - DebugNodeProfiler() [Internal]
 // - DebugNodeStorage() [Internal]
 // - DebugNodeTabBar() [Internal]
 // - DebugNodeViewport() [Internal]
@@ -14081,10 +16370,10 @@ void ImGui::ShowMetricsWindow(ImGuiContext* ctx, bool* p_open)
         cfg->ShowTablesRects |= Combo(ctx, "##show_table_rects_type", &cfg->ShowTablesRectsType, trt_rects_names, TRT_Count, TRT_Count);
         if (cfg->ShowTablesRects && g.NavWindow != NULL)
         {
-            for (int table_n = 0; table_n < g.Tables.GetMapSize(); table_n++)
+            for (int table_n = 0; table_n < g.Tables.GetAliveCount(); table_n++)
             {
-                ImGuiTable* table = g.Tables.TryGetMapData(table_n);
-                if (table == NULL || table->LastFrameActive < g.FrameCount - 1 || (table->OuterWindow != g.NavWindow && table->InnerWindow != g.NavWindow))
+                ImGuiTable* table = g.Tables.GetAliveByPos(table_n);
+                if (table->LastFrameActive < g.FrameCount - 1 || (table->OuterWindow != g.NavWindow && table->InnerWindow != g.NavWindow))
                     continue;
 
                 BulletText(ctx, "Table 0x%08X (%d columns, in '%s')", table->ID, table->ColumnsCount, table->OuterWindow->Name);
@@ -14207,22 +16496,21 @@ void ImGui::ShowMetricsWindow(ImGuiContext* ctx, bool* p_open)
     // Details for TabBars
     if (TreeNode(ctx, "TabBars", "Tab Bars (%d)", g.TabBars.GetAliveCount()))
     {
-        for (int n = 0; n < g.TabBars.GetMapSize(); n++)
-            if (ImGuiTabBar* tab_bar = g.TabBars.TryGetMapData(n))
-            {
-                PushID(ctx, tab_bar);
-                DebugNodeTabBar(ctx, tab_bar, "TabBar");
-                PopID(ctx);
-            }
+        for (int n = 0; n < g.TabBars.GetAliveCount(); n++)
+        {
+            ImGuiTabBar* tab_bar = g.TabBars.GetAliveByPos(n);
+            PushID(ctx, tab_bar);
+            DebugNodeTabBar(ctx, tab_bar, "TabBar");
+            PopID(ctx);
+        }
         TreePop(ctx);
     }
 
     // Details for Tables
     if (TreeNode(ctx, "Tables", "Tables (%d)", g.Tables.GetAliveCount()))
     {
-        for (int n = 0; n < g.Tables.GetMapSize(); n++)
-            if (ImGuiTable* table = g.Tables.TryGetMapData(n))
-                DebugNodeTable(ctx, table);
+        for (int n = 0; n < g.Tables.GetAliveCount(); n++)
+            DebugNodeTable(ctx, g.Tables.GetAliveByPos(n));
         TreePop(ctx);
     }
 
@@ -14273,7 +16561,10 @@ void ImGui::ShowMetricsWindow(ImGuiContext* ctx, bool* p_open)
         else
             TextUnformatted(ctx, "<NULL>");
         Checkbox(ctx, "io.ConfigDebugIniSettings", &io.ConfigDebugIniSettings);
+        Checkbox(ctx, "io.ConfigIniSavingAsync", &io.ConfigIniSavingAsync);
         Text(ctx, "SettingsDirtyTimer %.2f", g.SettingsDirtyTimer);
+        if (g.SettingsWriter != NULL)
+            Text(ctx, "Writer thread: %s, %d completed, last %s", io.IniSavingInProgress ? "writing" : "idle", io.IniSavingCompletedCount, io.IniSavingFailed ? "failed" : "ok");
         if (TreeNode(ctx, "SettingsHandlers", "Settings handlers: (%d)", g.SettingsHandlers.Size))
         {
             for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
@@ -14320,8 +16611,24 @@ void ImGui::ShowMetricsWindow(ImGuiContext* ctx, bool* p_open)
         TreePop(ctx);
     }
 
+    // Profiler
+    if (TreeNode(ctx, "Profiler"))
+    {
+        DebugNodeProfiler(ctx, &g.DebugProfiler);
+        TreePop(ctx);
+    }
+
     if (TreeNode(ctx, "Inputs"))
     {
+#ifdef IMGUI_ENABLE_THREADED_INPUT_EVENTS
+        Text(ctx, "Threaded input events queue: size %d, overflowed %d times", IMGUI_INPUT_EVENTS_RING_SIZE, g.InputEventsRing->OverflowCount.load(std::memory_order_relaxed));
+#endif
+        Text(ctx, "Input events: %d queued, %d in trail, %d/%d in history", g.InputEventsQueue.Size, g.InputEventsTrail.Size, g.InputEventsHistoryCount, io.ConfigInputEventsHistorySize);
+        const float wakeup_time = GetNextWakeupTime(ctx);
+        if (wakeup_time == FLT_MAX)
+            Text(ctx, "Next wakeup: on input (%d settle frames left)", g.WakeupFramesLeft);
+        else
+            Text(ctx, "Next wakeup: %.3f sec (%d settle frames left)", wakeup_time, g.WakeupFramesLeft);
         Text(ctx, "KEYBOARD/GAMEPAD/MOUSE KEYS");
         {
             // We iterate both legacy native range and named ImGuiKey ranges, which is a little odd but this allows displaying the data for old/new backends.
@@ -14485,10 +16792,10 @@ void ImGui::ShowMetricsWindow(ImGuiContext* ctx, bool* p_open)
     // Overlay: Display Tables Rectangles
     if (cfg->ShowTablesRects)
     {
-        for (int table_n = 0; table_n < g.Tables.GetMapSize(); table_n++)
+        for (int table_n = 0; table_n < g.Tables.GetAliveCount(); table_n++)
         {
-            ImGuiTable* table = g.Tables.TryGetMapData(table_n);
-            if (table == NULL || table->LastFrameActive < g.FrameCount - 1)
+            ImGuiTable* table = g.Tables.GetAliveByPos(table_n);
+            if (table->LastFrameActive < g.FrameCount - 1)
                 continue;
             ImDrawList* draw_list = GetForegroundDrawList(ctx, table->OuterWindow);
             if (cfg->ShowTablesRectsType >= TRT_ColumnsRect)
@@ -14823,6 +17130,126 @@ void ImGui::DebugNodeFontGlyph(ImGuiContext* ctx, ImFont*, const ImFontGlyph* gl
     Text(ctx, "UV: (%.3f,%.3f)->(%.3f,%.3f)", glyph->U0, glyph->V0, glyph->U1, glyph->V1);
 }
 
+// [DEBUG] Display recorded frames of the profiler: frame durations, timeline of selected frame and total time per zone.
+void ImGui::DebugNodeProfiler(ImGuiContext* ctx, ImGuiProfiler* profiler)
+{
+#ifndef IMGUI_ENABLE_PROFILER
+    IM_UNUSED(profiler);
+    TextDisabled(ctx, "Add '#define IMGUI_ENABLE_PROFILER' in imconfig.h to record timing zones.");
+#else
+    ImGuiContext& g = *ctx;
+    Checkbox(ctx, "Record", &profiler->Enabled);
+    SameLine(ctx);
+    if (Button(ctx, "Export Chrome trace"))
+        ProfilerExportChromeTrace(ctx, "imgui_trace.json");
+    SameLine(ctx);
+    MetricsHelpMarker(ctx, "Write recorded frames to imgui_trace.json.\nOpen with chrome://tracing or https://ui.perfetto.dev");
+    const int frames_count = profiler->FramesCount;
+    if (frames_count == 0)
+    {
+        Text(ctx, "No frame recorded.");
+        return;
+    }
+
+    // Frame durations, oldest first. Click to select a frame.
+    float durations[IMGUI_PROFILER_MAX_FRAMES];
+    for (int n = 0; n < frames_count; n++)
+    {
+        const ImGuiProfilerFrame* frame = profiler->GetFrame(frames_count - 1 - n);
+        durations[n] = (float)((frame->EndTime - frame->StartTime) / 1000.0);
+    }
+    PlotHistogram(ctx, "##Frames", durations, frames_count, 0, "Frame durations (ms)", 0.0f, FLT_MAX, ImVec2(GetContentRegionAvail(ctx).x, 60.0f));
+    if (IsItemHovered(ctx) && IsMouseClicked(ctx, ImGuiMouseButton_Left))
+    {
+        const ImRect inner_bb(GetItemRectMin(ctx) + g.Style.FramePadding, GetItemRectMax(ctx) - g.Style.FramePadding);
+        const int n = (int)((g.IO.MousePos.x - inner_bb.Min.x) / inner_bb.GetWidth() * frames_count);
+        profiler->DisplayFrameOffset = frames_count - 1 - ImClamp(n, 0, frames_count - 1);
+    }
+    profiler->DisplayFrameOffset = ImClamp(profiler->DisplayFrameOffset, 0, frames_count - 1);
+    SliderInt(ctx, "Frames ago", &profiler->DisplayFrameOffset, 0, frames_count - 1);
+
+    const ImGuiProfilerFrame* frame = profiler->GetFrame(profiler->DisplayFrameOffset);
+    const double frame_duration = ImMax(frame->EndTime - frame->StartTime, 1.0);
+    Text(ctx, "Frame %d: %.3f ms, %d zones", frame->FrameCount, frame_duration / 1000.0, frame->Zones.Size);
+
+    // Timeline: one row per nesting level
+    int depth_max = 0;
+    for (const ImGuiProfilerZone& zone : frame->Zones)
+        depth_max = ImMax(depth_max, zone.Depth);
+    const float row_height = GetTextLineHeight(ctx) + 2.0f;
+    const ImVec2 pos = GetCursorScreenPos(ctx);
+    const ImRect bb(pos, pos + ImVec2(GetContentRegionAvail(ctx).x, row_height * (depth_max + 1)));
+    ItemSize(ctx, bb.GetSize());
+    if (ItemAdd(ctx, bb, 0))
+    {
+        ImDrawList* draw_list = GetWindowDrawList(ctx);
+        draw_list->AddRectFilled(bb.Min, bb.Max, GetColorU32(ctx, ImGuiCol_FrameBg));
+        const bool hovered = IsItemHovered(ctx);
+        const ImGuiProfilerZone* hovered_zone = NULL;
+        const double scale = bb.GetWidth() / frame_duration;
+        char label[64];
+        for (const ImGuiProfilerZone& zone : frame->Zones)
+        {
+            ImRect zone_bb;
+            zone_bb.Min.x = bb.Min.x + (float)((zone.StartTime - frame->StartTime) * scale);
+            zone_bb.Max.x = ImMax(bb.Min.x + (float)((zone.EndTime - frame->StartTime) * scale), zone_bb.Min.x + 1.0f);
+            zone_bb.Min.y = bb.Min.y + row_height * zone.Depth;
+            zone_bb.Max.y = zone_bb.Min.y + row_height - 1.0f;
+            draw_list->AddRectFilled(zone_bb.Min, zone_bb.Max, ImColor::HSV((ImHashStr(zone.Name) & 0xFF) / 255.0f, 0.50f, 0.55f));
+            if (zone_bb.GetWidth() > g.FontSize)
+            {
+                const char* arg = frame->GetArg(&zone);
+                ImFormatString(label, IM_ARRAYSIZE(label), "%s%s%s", zone.Name, arg ? ": " : "", arg ? arg : "");
+                RenderTextClipped(ctx, zone_bb.Min + ImVec2(2.0f, 1.0f), zone_bb.Max, label, NULL, NULL, ImVec2(0.0f, 0.0f), &zone_bb);
+            }
+            if (hovered && zone_bb.Contains(g.IO.MousePos))
+                hovered_zone = &zone;
+        }
+        if (hovered_zone != NULL)
+        {
+            const char* arg = frame->GetArg(hovered_zone);
+            SetTooltip(ctx, "%s%s%s\n%.3f ms (at +%.3f ms)", hovered_zone->Name, arg ? ": " : "", arg ? arg : "",
+                (hovered_zone->EndTime - hovered_zone->StartTime) / 1000.0, (hovered_zone->StartTime - frame->StartTime) / 1000.0);
+        }
+    }
+
+    // Total time and count per zone name, in order of first appearance
+    struct ZoneTotal { const char* Name; double Time; int Count; };
+    ImVector<ZoneTotal> totals;
+    for (const ImGuiProfilerZone& zone : frame->Zones)
+    {
+        ZoneTotal* total = NULL;
+        for (ZoneTotal& it : totals)
+            if (strcmp(it.Name, zone.Name) == 0)
+                total = &it;
+        if (total == NULL)
+        {
+            totals.push_back({ zone.Name, 0.0, 0 });
+            total = &totals.back();
+        }
+        total->Time += zone.EndTime - zone.StartTime;
+        total->Count++;
+    }
+    if (BeginTable(ctx, "##ZoneTotals", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+    {
+        TableSetupColumn(ctx, "Zone");
+        TableSetupColumn(ctx, "Count");
+        TableSetupColumn(ctx, "Total (ms)");
+        TableHeadersRow(ctx);
+        for (const ZoneTotal& total : totals)
+        {
+            TableNextColumn(ctx);
+            TextUnformatted(ctx, total.Name);
+            TableNextColumn(ctx);
+            Text(ctx, "%d", total.Count);
+            TableNextColumn(ctx);
+            Text(ctx, "%.3f", total.Time / 1000.0);
+        }
+        EndTable(ctx);
+    }
+#endif
+}
+
 // [DEBUG] Display contents of ImGuiStorage
 void ImGui::DebugNodeStorage(ImGuiContext* ctx, ImGuiStorage* storage, const char* label)
 {
@@ -15415,6 +17842,7 @@ void ImGui::DebugNodeColumns(ImGuiOldColumns*) {}
 void ImGui::DebugNodeDrawList(ImGuiWindow*, ImGuiViewportP*, const ImDrawList*, const char*) {}
 void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList*, const ImDrawList*, const ImDrawCmd*, bool, bool) {}
 void ImGui::DebugNodeFont(ImFont*) {}
+void ImGui::DebugNodeProfiler(ImGuiContext*, ImGuiProfiler*) {}
 void ImGui::DebugNodeStorage(ImGuiStorage*, const char*) {}
 void ImGui::DebugNodeTabBar(ImGuiTabBar*, const char*) {}
 void ImGui::DebugNodeWindow(ImGuiWindow*, const char*) {}
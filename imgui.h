@@ -39,7 +39,7 @@ Index of this file:
 // [SECTION] ImGuiStyle
 // [SECTION] ImGuiIO
 // [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload)
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiTextIndex, ImGuiTextDocument, ImGuiStorage, ImGuiListClipper, ImGuiPlotIndex, Math Operators, ImColor)
 // [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
 // [SECTION] Viewports (ImGuiViewportFlags, ImGuiViewport)
@@ -154,6 +154,10 @@ struct ImGuiIO;                     // Main configuration and I/O between your a
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiKeyData;                // Storage for ImGuiIO and IsKeyDown(), IsKeyPressed() etc functions.
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiListClipperHeights;     // Helper to store per-item heights for ImGuiListClipper::BeginVariableHeight()
+struct ImGuiGridClipper;            // Helper to manually clip large 2D grids of cells (e.g. thumbnails, spreadsheets)
+struct ImGuiTreeClipper;            // Helper to manually clip large trees (e.g. asset browsers, scene graphs)
+struct ImGuiTreeClipperIndex;       // Helper to store the flattened list of visible nodes for ImGuiTreeClipper
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
 struct ImGuiPlatformImeData;        // Platform IME data for io.SetPlatformImeDataFn() function.
@@ -162,8 +166,13 @@ struct ImGuiStorage;                // Helper for key->value storage
 struct ImGuiStyle;                  // Runtime data for styling/colors
 struct ImGuiTableSortSpecs;         // Sorting specifications for a table (often handling sort specs for a single column, occasionally more)
 struct ImGuiTableColumnSortSpecs;   // Sorting specification for one column of a table
+struct ImGuiTableSortPermutation;   // Helper to maintain a sorted permutation of rows for a sortable table, sorting incrementally/over multiple frames
+struct ImGuiPlotIndex;              // Helper to maintain a min/max decimation index over a large series of values for PlotLines()/PlotHistogram()
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
+struct ImGuiTextIndex;              // Helper to maintain a line index for a text buffer (e.g. for TextUnformattedIndexed())
+struct ImGuiTextDocument;           // Helper to store and edit large texts with InputTextMultiline() (gap buffer + line index + undo log)
+struct ImGuiLiteralID;              // Helper to hash a string literal label at compile time (for PushID(), GetID() and some widgets)
 struct ImGuiViewport;               // A Platform Window (always only one in 'master' branch), in the future may represent Platform Monitor
 
 // Enumerations
@@ -253,6 +262,9 @@ typedef int     (*ImGuiInputTextCallback)(ImGuiInputTextCallbackData* data);
 typedef void    (*ImGuiSizeCallback)(ImGuiSizeCallbackData* data);              // Callback function for ImGui::SetNextWindowSizeConstraints()
 typedef void*   (*ImGuiMemAllocFunc)(size_t sz, void* user_data);               // Function signature for ImGui::SetAllocatorFunctions()
 typedef void    (*ImGuiMemFreeFunc)(void* ptr, void* user_data);                // Function signature for ImGui::SetAllocatorFunctions()
+typedef int     (*ImGuiTreeClipperChildrenCountFunc)(int node, void* user_data);  // Callback function for ImGuiTreeClipper: return number of children of 'node' (-1 for the root)
+typedef int     (*ImGuiTreeClipperChildFunc)(int node, int child_n, void* user_data); // Callback function for ImGuiTreeClipper: return node handle (>= 0) of the n-th child of 'node' (-1 for the root)
+typedef int     (*ImGuiTableSortCompareFunc)(int row_a, int row_b, const ImGuiTableColumnSortSpecs* spec, void* user_data); // Callback function for ImGuiTableSortPermutation::Sort(): compare two rows on spec's column, as if ascending (<0, 0, >0)
 
 // ImVec2: 2D vector used to store positions, sizes etc. [Compile-time configurable type]
 // This is a frequently used type in the API. Consider using IM_VEC2_CLASS_EXTRA to create implicit cast from/to our preferred type.
@@ -494,13 +506,16 @@ namespace ImGui
     IMGUI_API void          PushID(ImGuiContext* ctx, const char* str_id_begin, const char* str_id_end);       // push string into the ID stack (will hash string).
     IMGUI_API void          PushID(ImGuiContext* ctx, const void* ptr_id);                                     // push pointer into the ID stack (will hash pointer).
     IMGUI_API void          PushID(ImGuiContext* ctx, int int_id);                                             // push integer into the ID stack (will hash integer).
+    IMGUI_API void          PushID(ImGuiContext* ctx, const ImGuiLiteralID& str_id);                           // push string literal into the ID stack (hashed at compile time). Same result as PushID(str_id.Str).
     IMGUI_API void          PopID(ImGuiContext* ctx);                                                        // pop from the ID stack.
     IMGUI_API ImGuiID       GetID(ImGuiContext* ctx, const char* str_id);                                      // calculate unique ID (hash of whole ID stack + given parameter). e.g. if you want to query into ImGuiStorage yourself
     IMGUI_API ImGuiID       GetID(ImGuiContext* ctx, const char* str_id_begin, const char* str_id_end);
     IMGUI_API ImGuiID       GetID(ImGuiContext* ctx, const void* ptr_id);
+    IMGUI_API ImGuiID       GetID(ImGuiContext* ctx, const ImGuiLiteralID& str_id);                            // same result as GetID(str_id.Str) without hashing the string
 
     // Widgets: Text
     IMGUI_API void          TextUnformatted(ImGuiContext* ctx, const char* text, const char* text_end = NULL); // raw text without formatting. Roughly equivalent to Text("%s", text) but: A) doesn't require null terminated string if 'text_end' is specified, B) it's faster, no memory copy is done, no buffer size limits, recommended for long chunks of text.
+    IMGUI_API void          TextUnformattedIndexed(ImGuiContext* ctx, const char* text, const char* text_end, ImGuiTextIndex* line_index); // raw text using a persistent line index: layout and render only visible lines, so cost doesn't depend on text size. Text is assumed to only be appended to (e.g. a log), call line_index->clear() if you modify existing contents.
     IMGUI_API void          Text(ImGuiContext* ctx, const char* fmt, ...)                                      IM_FMTARGS(2); // formatted text
     IMGUI_API void          TextV(ImGuiContext* ctx, const char* fmt, va_list args)                            IM_FMTLIST(2);
     IMGUI_API void          TextColored(ImGuiContext* ctx, const ImVec4& col, const char* fmt, ...)            IM_FMTARGS(3); // shortcut for PushStyleColor(ImGuiCol_Text, col); Text(fmt, ...); PopStyleColor();
@@ -509,6 +524,7 @@ namespace ImGui
     IMGUI_API void          TextDisabledV(ImGuiContext* ctx, const char* fmt, va_list args)                    IM_FMTLIST(2);
     IMGUI_API void          TextWrapped(ImGuiContext* ctx, const char* fmt, ...)                               IM_FMTARGS(2); // shortcut for PushTextWrapPos(0.0f); Text(fmt, ...); PopTextWrapPos();. Note that this won't work on an auto-resizing window if there's no other widgets to extend the window width, yoy may need to set a size using SetNextWindowSize().
     IMGUI_API void          TextWrappedV(ImGuiContext* ctx, const char* fmt, va_list args)                     IM_FMTLIST(2);
+    IMGUI_API void          TextWrappedUnformatted(ImGuiContext* ctx, const char* text, const char* text_end, ImGuiID text_id); // raw word-wrapped text identified by 'text_id' (e.g. GetID() or your own hash), so its cached wrapping layout is found without hashing the whole text every frame. Contents are assumed unchanged as long as 'text_id' is: change the ID (e.g. combine it with a version counter) when you modify the text.
     IMGUI_API void          LabelText(ImGuiContext* ctx, const char* label, const char* fmt, ...)              IM_FMTARGS(3); // display text+label aligned the same way as value+label widgets
     IMGUI_API void          LabelTextV(ImGuiContext* ctx, const char* label, const char* fmt, va_list args)    IM_FMTLIST(3);
     IMGUI_API void          BulletText(ImGuiContext* ctx, const char* fmt, ...)                                IM_FMTARGS(2); // shortcut for Bullet()+Text()
@@ -519,10 +535,12 @@ namespace ImGui
     // - Most widgets return true when the value has been changed or when pressed/selected
     // - You may also use one of the many IsItemXXX functions (e.g. IsItemActive, IsItemHovered, etc.) to query widget state.
     IMGUI_API bool          Button(ImGuiContext* ctx, const char* label, const ImVec2& size = ImVec2(0, 0));   // button
+    IMGUI_API bool          Button(ImGuiContext* ctx, const ImGuiLiteralID& label, const ImVec2& size = ImVec2(0, 0)); // button with label hashed at compile time
     IMGUI_API bool          SmallButton(ImGuiContext* ctx, const char* label);                                 // button with (FramePadding.y == 0) to easily embed within text
     IMGUI_API bool          InvisibleButton(ImGuiContext* ctx, const char* str_id, const ImVec2& size, ImGuiButtonFlags flags = 0); // flexible button behavior without the visuals, frequently useful to build custom behaviors using the public api (along with IsItemActive, IsItemHovered, etc.)
     IMGUI_API bool          ArrowButton(ImGuiContext* ctx, const char* str_id, ImGuiDir dir);                  // square button with an arrow shape
     IMGUI_API bool          Checkbox(ImGuiContext* ctx, const char* label, bool* v);
+    IMGUI_API bool          Checkbox(ImGuiContext* ctx, const ImGuiLiteralID& label, bool* v);
     IMGUI_API bool          CheckboxFlags(ImGuiContext* ctx, const char* label, int* flags, int flags_value);
     IMGUI_API bool          CheckboxFlags(ImGuiContext* ctx, const char* label, unsigned int* flags, unsigned int flags_value);
     IMGUI_API bool          RadioButton(ImGuiContext* ctx, const char* label, bool active);                    // use with e.g. if (RadioButton("one", my_value==1)) { my_value = 1; }
@@ -597,6 +615,7 @@ namespace ImGui
     // - Most of the ImGuiInputTextFlags flags are only useful for InputText() and not for InputFloatX, InputIntX, InputDouble etc.
     IMGUI_API bool          InputText(ImGuiContext* ctx, const char* label, char* buf, size_t buf_size, ImGuiInputTextFlags flags = 0, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
     IMGUI_API bool          InputTextMultiline(ImGuiContext* ctx, const char* label, char* buf, size_t buf_size, const ImVec2& size = ImVec2(0, 0), ImGuiInputTextFlags flags = 0, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
+    IMGUI_API bool          InputTextMultiline(ImGuiContext* ctx, const char* label, ImGuiTextDocument* doc, const ImVec2& size = ImVec2(0, 0), ImGuiInputTextFlags flags = 0); // edit a document in place, only visible lines are processed: cost doesn't depend on document size. Callback and password flags are not supported.
     IMGUI_API bool          InputTextWithHint(ImGuiContext* ctx, const char* label, const char* hint, char* buf, size_t buf_size, ImGuiInputTextFlags flags = 0, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
     IMGUI_API bool          InputFloat(ImGuiContext* ctx, const char* label, float* v, float step = 0.0f, float step_fast = 0.0f, const char* format = "%.3f", ImGuiInputTextFlags flags = 0);
     IMGUI_API bool          InputFloat2(ImGuiContext* ctx, const char* label, float v[2], const char* format = "%.3f", ImGuiInputTextFlags flags = 0);
@@ -623,6 +642,7 @@ namespace ImGui
     // Widgets: Trees
     // - TreeNode functions return true when the node is open, in which case you need to also call TreePop() when you are finished displaying the tree node contents.
     IMGUI_API bool          TreeNode(ImGuiContext* ctx, const char* label);
+    IMGUI_API bool          TreeNode(ImGuiContext* ctx, const ImGuiLiteralID& label);
     IMGUI_API bool          TreeNode(ImGuiContext* ctx, const char* str_id, const char* fmt, ...) IM_FMTARGS(3);   // helper variation to easily decorelate the id from the displayed string. Read the FAQ about why and how to use ID. to align arbitrary text at the same level as a TreeNode() you can use Bullet().
     IMGUI_API bool          TreeNode(ImGuiContext* ctx, const void* ptr_id, const char* fmt, ...) IM_FMTARGS(3);   // "
     IMGUI_API bool          TreeNodeV(ImGuiContext* ctx, const char* str_id, const char* fmt, va_list args) IM_FMTLIST(3);
@@ -644,6 +664,7 @@ namespace ImGui
     // - A selectable highlights when hovered, and can display another color when selected.
     // - Neighbors selectable extend their highlight bounds in order to leave no gap between them. This is so a series of selected Selectable appear contiguous.
     IMGUI_API bool          Selectable(ImGuiContext* ctx, const char* label, bool selected = false, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0)); // "bool selected" carry the selection state (read-only). Selectable() is clicked is returns true so you can modify your selection state. size.x==0.0: use remaining width, size.x>0.0: specify width. size.y==0.0: use label height, size.y>0.0: specify height
+    IMGUI_API bool          Selectable(ImGuiContext* ctx, const ImGuiLiteralID& label, bool selected = false, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0));
     IMGUI_API bool          Selectable(ImGuiContext* ctx, const char* label, bool* p_selected, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0));      // "bool* p_selected" point to the selection state (read-write), as a convenient helper.
 
     // Widgets: List Boxes
@@ -663,6 +684,8 @@ namespace ImGui
     IMGUI_API void          PlotLines(ImGuiContext* ctx, const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
     IMGUI_API void          PlotHistogram(ImGuiContext* ctx, const char* label, const float* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float));
     IMGUI_API void          PlotHistogram(ImGuiContext* ctx, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
+    IMGUI_API void          PlotLines(ImGuiContext* ctx, const char* label, const float* values, int values_count, ImGuiPlotIndex* index, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float));     // large series (e.g. millions of values): draw min/max per pixel in O(pixels). see ImGuiPlotIndex.
+    IMGUI_API void          PlotHistogram(ImGuiContext* ctx, const char* label, const float* values, int values_count, ImGuiPlotIndex* index, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float)); // large series (e.g. millions of values): draw min/max per pixel in O(pixels). see ImGuiPlotIndex.
 
     // Widgets: Value() Helpers.
     // - Those are merely shortcut to calling Text() with a format string. Output single value in "name: value" format (tip: freely declare more in your code to handle your types. you can add functions to the ImGui namespace)
@@ -792,6 +815,8 @@ namespace ImGui
     // - Functions args 'int column_n' treat the default value of -1 as the same as passing the current column index.
     IMGUI_API ImGuiTableSortSpecs*  TableGetSortSpecs(ImGuiContext* ctx);                        // get latest sort specs for the table (NULL if not sorting).  Lifetime: don't hold on this pointer over multiple frames or past any subsequent call to BeginTable().
     IMGUI_API int                   TableGetColumnCount(ImGuiContext* ctx);                      // return number of columns (value passed to BeginTable)
+    IMGUI_API int                   TableGetVisibleColumnCount(ImGuiContext* ctx);               // return number of columns for which TableSetColumnIndex() returns true this frame (not hidden and not clipped, or auto-fitting). With thousands of columns, iterate those instead of all columns.
+    IMGUI_API int                   TableGetVisibleColumnIndex(ImGuiContext* ctx, int visible_n);  // return column index of the n-th visible column, in display order (0 <= visible_n < TableGetVisibleColumnCount()).
     IMGUI_API int                   TableGetColumnIndex(ImGuiContext* ctx);                      // return current column index.
     IMGUI_API int                   TableGetRowIndex(ImGuiContext* ctx);                         // return current row index.
     IMGUI_API const char*           TableGetColumnName(ImGuiContext* ctx, int column_n = -1);      // return "" if column didn't have a name declared by TableSetupColumn(). Pass -1 to use current column.
@@ -903,6 +928,14 @@ namespace ImGui
     IMGUI_API void          SetStateStorage(ImGuiContext* ctx, ImGuiStorage* storage);                             // replace current window storage with our own (if you want to manipulate it yourself, typically clear subsection of it)
     IMGUI_API ImGuiStorage* GetStateStorage(ImGuiContext* ctx);
 
+    // Idle Utilities
+    // - Use to skip frames when nothing can change, e.g. block on OS events with a timeout instead of rendering at full rate. Call after Render()/EndFrame().
+    // - Only input events, dear imgui animations/timers and RequestWakeup() are taken into account: if your own code animates, call RequestWakeup().
+    // - io.DeltaTime should keep measuring real elapsed time (include the time spent waiting).
+    IMGUI_API bool          IsFrameNeeded(ImGuiContext* ctx);                                                    // == (GetNextWakeupTime() <= 0.0f). true if a new frame may render differently from the last one.
+    IMGUI_API float         GetNextWakeupTime(ImGuiContext* ctx);                                                // delay in seconds before next frame is needed. 0.0f = now, FLT_MAX = only when new inputs are submitted.
+    IMGUI_API void          RequestWakeup(ImGuiContext* ctx, float delay = 0.0f);                                // request a new frame after given delay in seconds (0.0f = next frame). Call from the thread calling NewFrame().
+
     // Text Utilities
     IMGUI_API ImVec2        CalcTextSize(ImGuiContext* ctx, const char* text, const char* text_end = NULL, bool hide_text_after_double_hash = false, float wrap_width = -1.0f);
 
@@ -960,6 +993,16 @@ namespace ImGui
     IMGUI_API void          SaveIniSettingsToDisk(ImGuiContext* ctx, const char* ini_filename);                    // this is automatically called (if io.IniFilename is not empty) a few seconds after any modification that should be reflected in the .ini file (and also by DestroyContext).
     IMGUI_API const char*   SaveIniSettingsToMemory(ImGuiContext* ctx, size_t* out_ini_size = NULL);               // return a zero-terminated string with the .ini data which you can save by your own mean. call when io.WantSaveIniSettings is set, then save data by your own mean and clear io.WantSaveIniSettings.
 
+    // Settings/Binary Utilities
+    // - Optional faster alternative to .ini data: one versioned chunk per settings handler, loaded without any text parsing.
+    // - Handlers which don't provide ReadBinaryFn/WriteBinaryFn (e.g. third-party ones) are stored as .ini text inside the container.
+    // - Automatic loading/saving always uses .ini data. To use binary data, set io.IniFilename = NULL, call LoadBinarySettingsFromDisk() before the first NewFrame(), and SaveBinarySettingsToDisk() when io.WantSaveIniSettings is set.
+    // - Convert by loading one format and saving the other, e.g. LoadBinarySettingsFromDisk() + SaveIniSettingsToDisk() to get a diffable .ini file.
+    IMGUI_API bool          LoadBinarySettingsFromDisk(ImGuiContext* ctx, const char* filename);                   // memory map file where supported. return false if the file couldn't be loaded or isn't a valid binary settings container.
+    IMGUI_API bool          LoadBinarySettingsFromMemory(ImGuiContext* ctx, const void* data, size_t data_size);   // data is not copied nor modified.
+    IMGUI_API void          SaveBinarySettingsToDisk(ImGuiContext* ctx, const char* filename);
+    IMGUI_API const void*   SaveBinarySettingsToMemory(ImGuiContext* ctx, size_t* out_data_size = NULL);           // return binary data which you can save by your own mean. valid until next call.
+
     // Debug Utilities
     // - Your main debugging friend is the ShowMetricsWindow() function, which is also accessible from Demo->Tools->Metrics Debugger
     IMGUI_API void          DebugTextEncoding(ImGuiContext* ctx, const char* text);
@@ -2057,6 +2100,7 @@ struct ImGuiIO
     float       DeltaTime;                      // = 1.0f/60.0f     // Time elapsed since last frame, in seconds. May change every frame.
     float       IniSavingRate;                  // = 5.0f           // Minimum time between saving positions/sizes to .ini file, in seconds.
     const char* IniFilename;                    // = "imgui.ini"    // Path to .ini file (important: default "imgui.ini" is relative to current working dir!). Set NULL to disable automatic .ini loading/saving or if you want to manually call LoadIniSettingsXXX() / SaveIniSettingsXXX() functions.
+    bool        ConfigIniSavingAsync;           // = false          // Automatic .ini saving only formats data on the main thread, a writer thread writes it to "<IniFilename>.tmp" and renames it over IniFilename. Requires '#define IMGUI_ENABLE_ASYNC_INI_SAVING' in imconfig.h, otherwise saving stays synchronous.
     const char* LogFilename;                    // = "imgui_log.txt"// Path to .log file (default parameter to ImGui::LogToFile when no file is specified).
     void*       UserData;                       // = NULL           // Store your own data.
 
@@ -2070,6 +2114,8 @@ struct ImGuiIO
     bool        MouseDrawCursor;                // = false          // Request ImGui to draw a mouse cursor for you (if you are on a platform without a mouse cursor). Cannot be easily renamed to 'io.ConfigXXX' because this is frequently used by backend implementations.
     bool        ConfigMacOSXBehaviors;          // = defined(__APPLE__) // OS X style: Text editing cursor movement using Alt instead of Ctrl, Shortcuts using Cmd/Super instead of Ctrl, Line/Text Start and End using Cmd+Arrows instead of Home/End, Double click selects by word instead of selecting whole text, Multi-selection in lists uses Cmd/Super instead of Ctrl.
     bool        ConfigInputTrickleEventQueue;   // = true           // Enable input queue trickling: some types of events submitted during the same frame (e.g. button down + up) will be spread over multiple frames, improving interactions with low framerates.
+    bool        ConfigInputCoalesceMouseEvents; // = true           // Merge consecutive mouse move (and consecutive mouse wheel) events of the same mouse source in the input queue, so the cost of processing inputs doesn't grow with device rate (e.g. 1000 Hz mice, pen tablets). Resulting inputs are the same. Use io.ConfigInputEventsHistorySize if you need every position.
+    int         ConfigInputEventsHistorySize;   // = 0              // Keep the last N input events (not merged, with timestamps) in a ring buffer, e.g. for drawing tools needing the full mouse/pen path. See GetInputEventsHistory() in imgui_internal.h and io.GetInputEventTimestampFn.
     bool        ConfigInputTextCursorBlink;     // = true           // Enable blinking cursor (optional as some users consider it to be distracting).
     bool        ConfigInputTextEnterKeepActive; // = false          // [BETA] Pressing Enter will keep item active and select contents (single-line only).
     bool        ConfigDragClickToInputText;     // = false          // [BETA] Enable turning DragXXX widgets into text input with a simple mouse click-release (without moving). Not desirable on devices without a keyboard.
@@ -2132,6 +2178,11 @@ struct ImGuiIO
     // (default to use native imm32 api on Windows)
     void        (*SetPlatformImeDataFn)(ImGuiViewport* viewport, ImGuiPlatformImeData* data);
 
+    // Optional: Timestamp input events (stored in ImGuiInputEvent::Timestamp, e.g. to compute pen velocity from io.ConfigInputEventsHistorySize data)
+    // (called by io.AddXXXEvent() functions, from the thread calling them. Return seconds in any time base, e.g. a monotonic clock or the OS event timestamp. Events have a 0.0 timestamp when not set)
+    double      (*GetInputEventTimestampFn)(void* user_data);
+    void*       InputEventTimestampUserData;
+
     // Optional: Platform locale
     ImWchar     PlatformLocaleDecimalPoint;     // '.'              // [Experimental] Configure decimal point e.g. '.' or ',' useful for some languages (e.g. German), generally pulled from *localeconv()->decimal_point
 
@@ -2140,6 +2191,8 @@ struct ImGuiIO
     //------------------------------------------------------------------
 
     // Input Functions
+    // - With '#define IMGUI_ENABLE_THREADED_INPUT_EVENTS' in imconfig.h, the AddXXX functions may be called from any thread (e.g. a dedicated input thread), they go through a lock-free queue drained by NewFrame().
+    //   SetAppAcceptingEvents() and ClearEventsQueue() still need to be called from the thread calling NewFrame(), and UTF-16 characters need to come from a single thread.
     IMGUI_API void  AddKeyEvent(ImGuiKey key, bool down);                   // Queue a new key down/up event. Key should be "translated" (as in, generally ImGuiKey_A matches the key end-user would use to emit an 'A' character)
     IMGUI_API void  AddKeyAnalogEvent(ImGuiKey key, bool down, float v);    // Queue a new key down/up event for analog values (e.g. ImGuiKey_Gamepad_ values). Dead-zones should be handled by the backend.
     IMGUI_API void  AddMousePosEvent(float x, float y);                     // Queue a mouse position update. Use -FLT_MAX,-FLT_MAX to signify no mouse (e.g. app not focused and not hovered)
@@ -2170,6 +2223,9 @@ struct ImGuiIO
     bool        WantTextInput;                      // Mobile/console: when set, you may display an on-screen keyboard. This is set by Dear ImGui when it wants textual keyboard input to happen (e.g. when a InputText widget is active).
     bool        WantSetMousePos;                    // MousePos has been altered, backend should reposition mouse on next frame. Rarely used! Set only when ImGuiConfigFlags_NavEnableSetMousePos flag is enabled.
     bool        WantSaveIniSettings;                // When manual .ini load/save is active (io.IniFilename == NULL), this will be set to notify your application that you can call SaveIniSettingsToMemory() and save yourself. Important: clear io.WantSaveIniSettings yourself after saving!
+    bool        IniSavingInProgress;                // When io.ConfigIniSavingAsync is used: .ini data is queued or being written by the writer thread. DestroyContext() waits for it to complete.
+    bool        IniSavingFailed;                    // When io.ConfigIniSavingAsync is used: last .ini file write failed (couldn't open, write or rename the file).
+    int         IniSavingCompletedCount;            // When io.ConfigIniSavingAsync is used: number of .ini file writes completed by the writer thread.
     bool        NavActive;                          // Keyboard/Gamepad navigation is currently allowed (will handle ImGuiKey_NavXXX events) = a window is focused and it doesn't use the ImGuiWindowFlags_NoNavInputs flag.
     bool        NavVisible;                         // Keyboard/Gamepad navigation is visible and allowed (will handle ImGuiKey_NavXXX events).
     float       Framerate;                          // Estimate of application framerate (rolling average over 60 frames, based on io.DeltaTime), in frame per second. Solely for convenience. Slow applications may not want to use a moving average or may want to reset underlying buffers occasionally.
@@ -2317,7 +2373,7 @@ struct ImGuiPayload
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiTextIndex, ImGuiTextDocument, ImGuiLiteralID, ImGuiStorage, ImGuiListClipper, ImGuiPlotIndex, Math Operators, ImColor)
 //-----------------------------------------------------------------------------
 
 // Helper: Unicode defines
@@ -2329,11 +2385,17 @@ struct ImGuiPayload
 #endif
 
 // Helper: Parse and apply text filters. In format "aaaaa[,bbbb][,ccccc]"
+// - For large lists (e.g. logs), use PassFilterMany() which tests a batch of texts into a bitmask.
+//   It is const and doesn't touch any context, so a very large batch may be split across your own worker threads
+//   (split at multiples of 32 texts so that each thread writes to distinct mask words).
+// - Incremental usage: 'if (filter.Draw(ctx)) filter.PassFilterMany(texts, NULL, count, mask, filter.BuiltAsRefinement);'
+//   only rescans texts which passed the previous filter when the user is narrowing it (e.g. typing more characters).
 struct ImGuiTextFilter
 {
     IMGUI_API           ImGuiTextFilter(const char* default_filter = "");
     IMGUI_API bool      Draw(ImGuiContext* ctx, const char* label = "Filter (inc,-exc)", float width = 0.0f);  // Helper calling InputText+Build
     IMGUI_API bool      PassFilter(const char* text, const char* text_end = NULL) const;
+    IMGUI_API int       PassFilterMany(const char* const* texts, const char* const* text_ends, int count, ImU32* inout_mask, bool refine = false) const; // Test 'count' texts, write result bits into inout_mask[(count+31)/32]. When 'refine' is set, only texts whose bit is already set are tested. Return number of passing texts.
     IMGUI_API void      Build();
     void                Clear()          { InputBuf[0] = 0; Build(); }
     bool                IsActive() const { return !Filters.empty(); }
@@ -2349,9 +2411,18 @@ struct ImGuiTextFilter
         bool            empty() const                   { return b == e; }
         IMGUI_API void  split(char separator, ImVector<ImGuiTextRange>* out) const;
     };
+    struct ImGuiTextPattern
+    {
+        int             Offset;                         // Offset in PatternsBuf[]
+        int             Len;
+        bool            Exclude;                        // Term was prefixed with '-'
+    };
     char                    InputBuf[256];
     ImVector<ImGuiTextRange>Filters;
     int                     CountGrep;
+    ImVector<ImGuiTextPattern> Patterns;                // Non-empty terms, in order, compiled by Build()
+    ImVector<char>          PatternsBuf;                // Upper-cased copy of every term
+    bool                    BuiltAsRefinement;          // Set by Build() when the new filter can only reject texts which passed the previous one (e.g. typing more characters into a term): previous PassFilterMany() results may be refined instead of recomputed.
 };
 
 // Helper: Growable text buffer for logging/accumulating text
@@ -2375,10 +2446,125 @@ struct ImGuiTextBuffer
     IMGUI_API void      appendfv(const char* fmt, va_list args) IM_FMTLIST(2);
 };
 
+// Helper: Maintain a line index for a text buffer.
+// - Used by TextUnformattedIndexed() to only layout and render visible lines of very large buffers.
+// - We don't own the text buffer, so we maintain EndOffset to allow appending to the index incrementally.
+struct ImGuiTextIndex
+{
+    ImVector<int>       LineOffsets;
+    int                 EndOffset;                                      // Because we don't own text buffer we need to maintain EndOffset (may bake in LineOffsets?)
+
+    ImGuiTextIndex()    { EndOffset = 0; }
+    void                clear()                                         { LineOffsets.clear(); EndOffset = 0; }
+    int                 size() const                                    { return LineOffsets.Size; }
+    const char*         get_line_begin(const char* base, int n) const   { return base + LineOffsets[n]; }
+    const char*         get_line_end(const char* base, int n) const     { return base + (n + 1 < LineOffsets.Size ? (LineOffsets[n + 1] - 1) : EndOffset); }
+    IMGUI_API void      append(const char* base, int old_size, int new_size);
+};
+
+// Helper: Text storage for editing large documents with InputTextMultiline(ctx, label, ImGuiTextDocument* doc).
+// - Text is stored as UTF-8 in a gap buffer: an edit costs O(edit size + distance to the previous edit), not O(document size).
+// - Line starts are stored with the same gap scheme (offsets before the gap are from the start of text, after the gap from the end of text),
+//   so edits only update the lines around them and position <> line lookups are O(log N).
+// - Cursor, selection and the undo log are stored in the document, so they persist while the widget is inactive. The undo log has no fixed limit, call ClearUndo() to release it.
+// - Positions are byte offsets in the UTF-8 text. Use GetText() to obtain the whole text as a zero-terminated string (e.g. to save it).
+struct ImGuiTextDocumentUndoRecord
+{
+    int                 Pos;                // Position of the edit
+    int                 DeletedLen;         // Number of bytes removed at Pos (stored at TextOffset in UndoText[])
+    int                 InsertedLen;        // Number of bytes inserted at Pos (stored after the deleted bytes)
+    int                 TextOffset;         // Offset in UndoText[]
+};
+
+struct ImGuiTextDocument
+{
+    ImVector<char>      Buf;                // Gap buffer. Text is Buf[0..GapBegin) followed by Buf[GapEnd..Buf.Size)
+    int                 GapBegin, GapEnd;
+    ImVector<int>       LineStarts;         // Gap buffer of line start positions. Entries before LineGapBegin are offsets from start of text, entries from LineGapEnd are offsets from end of text.
+    int                 LineGapBegin, LineGapEnd;
+    int                 Cursor;             // Cursor position
+    int                 SelectionAnchor;    // Other end of the selection (== Cursor when nothing is selected)
+    int                 Version;            // Incremented on every modification
+    ImVector<ImGuiTextDocumentUndoRecord> UndoRecords; // Records [0..UndoPos) can be undone, records [UndoPos..Size) can be redone.
+    ImVector<char>      UndoText;
+    int                 UndoPos;
+    bool                UndoMergeable;      // Next insertion right after the last record may extend it (set while typing)
+
+    // [Internal] Widget state
+    ImGuiID             ID;                 // ID of widget which last edited the document
+    float               ScrollX;
+    float               PreferredX;         // Horizontal position to preserve when moving up/down, < 0.0f if unset
+    float               CursorAnim;
+    bool                CursorFollow;
+
+    IMGUI_API ImGuiTextDocument();
+    IMGUI_API void      Clear();
+    IMGUI_API void      SetText(const char* text, const char* text_end = NULL);    // Replace whole text, reset cursor and clear undo log
+    int                 GetLength() const                   { return Buf.Size - (GapEnd - GapBegin); }
+    int                 GetLineCount() const                { return LineStarts.Size - (LineGapEnd - LineGapBegin); }
+    char                GetChar(int pos) const              { IM_ASSERT(pos >= 0 && pos < GetLength()); return Buf.Data[pos < GapBegin ? pos : pos + (GapEnd - GapBegin)]; }
+    int                 GetLineStart(int line) const        { IM_ASSERT(line >= 0 && line < GetLineCount()); return line < LineGapBegin ? LineStarts.Data[line] : GetLength() - LineStarts.Data[line + (LineGapEnd - LineGapBegin)]; }
+    int                 GetLineEnd(int line) const          { return (line + 1 < GetLineCount()) ? GetLineStart(line + 1) - 1 : GetLength(); } // Position of '\n' or end of text
+    IMGUI_API int       GetLineFromPos(int pos) const;
+    IMGUI_API const char* GetTextRange(int begin, int end);                         // Move the gap out of [begin..end) and return a pointer to it. Valid until next modification. Cost is O(min distance from gap).
+    IMGUI_API const char* GetText();                                                // Whole text, zero-terminated. Moves the gap to the end (O(N) after an edit).
+    IMGUI_API void      Replace(int pos, int delete_len, const char* text, const char* text_end = NULL); // Edit text and record it in the undo log. 'text' must not point inside the document.
+    void                Insert(int pos, const char* text, const char* text_end = NULL) { Replace(pos, 0, text, text_end); }
+    void                Delete(int pos, int len)            { Replace(pos, len, NULL, NULL); }
+    IMGUI_API bool      Undo();
+    IMGUI_API bool      Redo();
+    void                ClearUndo()                         { UndoRecords.clear(); UndoText.clear(); UndoPos = 0; UndoMergeable = false; }
+    bool                HasSelection() const                { return Cursor != SelectionAnchor; }
+    int                 GetSelectionStart() const           { return Cursor < SelectionAnchor ? Cursor : SelectionAnchor; }
+    int                 GetSelectionEnd() const             { return Cursor < SelectionAnchor ? SelectionAnchor : Cursor; }
+
+    // [Internal]
+    IMGUI_API void      ApplyReplace(int pos, int delete_len, const char* text, int text_len); // Edit text without recording undo
+    IMGUI_API void      MoveGap(int pos);
+    IMGUI_API void      MoveLineGap(int line);
+};
+
+// Helper: String literal label hashed at compile time, for PushID(), GetID() and some widgets.
+// - Stores the hash of the label without seed, which is combined with the ID stack without rehashing the string (cached per seed). Resulting ID is identical to using the string.
+// - Declare as constexpr to guarantee evaluation at compile time, e.g.:
+//     static constexpr ImGuiLiteralID ID_Apply("Apply");
+//     if (ImGui::Button(ctx, ID_Apply)) { ... }
+// - "###" operator is supported. Only the part after the last "###" is hashed, same as with ImHashStr().
+// - Only accepts const char arrays (e.g. string literals): mutable buffers are rejected at compile time. With C++20 the constructor is consteval.
+// - Labels are limited to IMGUI_LITERAL_ID_MAX_LEN characters, as compilers limit constexpr recursion depth (512 by default for GCC/Clang/MSVC).
+#ifndef IMGUI_LITERAL_ID_MAX_LEN
+#define IMGUI_LITERAL_ID_MAX_LEN    256
+#endif
+#if defined(__cpp_consteval) && (__cpp_consteval >= 201811L)
+#define IMGUI_LITERAL_ID_CTOR       consteval
+#else
+#define IMGUI_LITERAL_ID_CTOR       constexpr
+#endif
+struct ImGuiLiteralID
+{
+    const char*         Str;                                            // Zero-terminated label, used for display
+    int                 HashBegin;                                      // Offset of hashed part (after "###" reset, otherwise 0)
+    int                 HashLen;                                        // Length of hashed part
+    ImU32               Hash;                                           // CRC32 of hashed part, with initial value 0 and no final inversion (combined with seed at runtime)
+
+    template<int N>
+    explicit IMGUI_LITERAL_ID_CTOR ImGuiLiteralID(const char (&str)[N]) : Str(str), HashBegin(CalcHashBegin(str, 0, CalcLen(str, 0, N - 1), 0)), HashLen(CalcLen(str, 0, N - 1) - CalcHashBegin(str, 0, CalcLen(str, 0, N - 1), 0)), Hash(CalcCrc32(str, CalcHashBegin(str, 0, CalcLen(str, 0, N - 1), 0), CalcLen(str, 0, N - 1), 0)) { static_assert(N - 1 <= IMGUI_LITERAL_ID_MAX_LEN, "Label too long for ImGuiLiteralID, see IMGUI_LITERAL_ID_MAX_LEN."); }
+    template<int N>
+    ImGuiLiteralID(char (&str)[N]) = delete;                           // Mutable buffer: contents may change after hashing, use the const char* functions instead.
+
+    // [Internal] C++11 constexpr functions are limited to a single return statement, hence the recursion.
+    static constexpr int   CalcLen(const char* s, int i, int max_len)                   { return (i < max_len && s[i] != 0) ? CalcLen(s, i + 1, max_len) : i; }
+    static constexpr int   CalcHashBegin(const char* s, int i, int len, int last)       { return (i + 2 < len) ? CalcHashBegin(s, i + 1, len, (s[i] == '#' && s[i + 1] == '#' && s[i + 2] == '#') ? i : last) : last; }
+    static constexpr ImU32 CalcCrc32Bits(ImU32 crc, int bits)                           { return bits ? CalcCrc32Bits((crc >> 1) ^ ((crc & 1) ? 0xEDB88320u : 0u), bits - 1) : crc; }
+    static constexpr ImU32 CalcCrc32(const char* s, int i, int len, ImU32 crc)          { return (i < len) ? CalcCrc32(s, i + 1, len, CalcCrc32Bits(crc ^ (unsigned char)s[i], 8)) : crc; }
+};
+
 // Helper: Key->Value storage
 // Typically you don't have to worry about this since a storage is held within each Window.
 // We use it to e.g. store collapse state for a tree (Int 0/1)
 // This is optimized for efficient lookup (dichotomy into a contiguous buffer) and rare insertion (typically tied to user interactions aka max once a frame)
+// For very large storages (e.g. 100k+ tree nodes), call SetHashIndex(true) or '#define IMGUI_STORAGE_USE_HASH_INDEX' in imconfig.h to use an open-addressing hash index:
+// lookup and insertion are then O(1) on average, but Data[] is kept in insertion order instead of being sorted.
 // You can use it as custom user storage for temporary values. Declare your own storage if, for example:
 // - You want to manipulate the open/close state of a particular sub-tree in your interface (tree node uses Int 0/1 to store their state).
 // - You want to store custom debug data easily without adding or editing structures in your code (probably not efficient, but convenient)
@@ -2396,11 +2582,21 @@ struct ImGuiStorage
     };
 
     ImVector<ImGuiStoragePair>      Data;
+    bool                            UseHashIndex;       // Lookup via HashIndex[] instead of binary search, Data[] is unsorted. Use SetHashIndex() to change.
+    ImVector<int>                   HashIndex;          // [Internal] Open-addressing table (linear probing, power of two size) of indices into Data[] + 1, 0 for empty slots.
+    int                             HashIndexCount;     // [Internal] Number of Data[] entries stored in HashIndex[]. When != Data.Size (e.g. after modifying Data[] directly), Get***() fall back to a linear search and Set***()/Get***Ref() rebuild the index.
+
+#ifdef IMGUI_STORAGE_USE_HASH_INDEX
+    ImGuiStorage()      { UseHashIndex = true; HashIndexCount = 0; }
+#else
+    ImGuiStorage()      { UseHashIndex = false; HashIndexCount = 0; }
+#endif
 
     // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
+    //   They never modify the storage (including the hash index), so concurrent Get***() calls are safe as long as nothing writes to it.
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
-    void                Clear() { Data.clear(); }
+    void                Clear() { Data.clear(); HashIndex.clear(); HashIndexCount = 0; }
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -2420,7 +2616,10 @@ struct ImGuiStorage
     IMGUI_API void**    GetVoidPtrRef(ImGuiID key, void* default_val = NULL);
 
     // Advanced: for quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
+    // Also call this after modifying Data[] directly without changing its size, when using a hash index.
     IMGUI_API void      BuildSortByKey();
+    // Advanced: switch between sorted storage (default) and open-addressing hash index. Existing pairs are kept.
+    IMGUI_API void      SetHashIndex(bool enabled);
     // Obsolete: use on your own storage if you know only integer are being stored (open/close all tree nodes)
     IMGUI_API void      SetAllInt(int val);
 };
@@ -2454,6 +2653,7 @@ struct ImGuiListClipper
     float           ItemsHeight;        // [Internal] Height of item after a first step and item submission can calculate it
     float           StartPosY;          // [Internal] Cursor position at the time of Begin() or after table frozen rows are all processed
     void*           TempData;           // [Internal] Internal data
+    ImGuiListClipperHeights* ItemsHeights; // [Internal] Per-item heights when using BeginVariableHeight()
 
     // items_count: Use INT_MAX if you don't know how many items you have (in which case the cursor won't be advanced in the final step)
     // items_height: Use -1.0f to be calculated automatically on first step. Otherwise pass in the distance between your items, typically GetTextLineHeightWithSpacing() or GetFrameHeightWithSpacing().
@@ -2461,6 +2661,7 @@ struct ImGuiListClipper
     IMGUI_API ~ImGuiListClipper();
     IMGUI_API void  Begin(int items_count, float items_height = -1.0f);
     IMGUI_API void  End();             // Automatically called on the last call of Step() that returns false.
+    IMGUI_API void  BeginVariableHeight(int items_count, ImGuiListClipperHeights* heights); // Items may have different heights, stored in 'heights' which you need to persist. Heights of displayed items are measured and stored. Step() only returns one item at a time.
     IMGUI_API bool  Step();            // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those items.
 
     // Call IncludeItemByIndex() or IncludeItemsByIndex() *BEFORE* first call to Step() if you need a range of items to not be clipped, regardless of their visibility.
@@ -2475,6 +2676,189 @@ struct ImGuiListClipper
 #endif
 };
 
+// Helper: Per-item heights for ImGuiListClipper::BeginVariableHeight(), stored as a Fenwick tree (binary indexed tree) of prefix sums.
+// - Finding the item at a given offset, the offset of an item and updating the height of an item are all O(log N).
+// - Items which have never been submitted use DefaultHeight (if left to 0.0f, the clipper uses GetTextLineHeightWithSpacing()).
+// - You may also call SetItemHeight() yourself if you know the height of items in advance.
+// - Appending items is O(1) amortized per item, so the list can grow every frame (e.g. a log).
+struct ImGuiListClipperHeights
+{
+    ImVector<double>    Tree;           // [Internal] Tree[i] = sum of heights of items [i - (i & -i), i) (1-based). Tree[0] is unused.
+    float               DefaultHeight;  // Height of items which have never been measured
+
+    ImGuiListClipperHeights()           { DefaultHeight = 0.0f; }
+    void                Clear()         { Tree.clear(); }
+    int                 GetCount() const                { return Tree.Size > 0 ? Tree.Size - 1 : 0; }
+    double              GetTotalHeight() const          { return GetItemOffset(GetCount()); }
+    IMGUI_API void      Resize(int items_count);                        // New items use DefaultHeight
+    IMGUI_API void      SetItemHeight(int item_n, float height);
+    IMGUI_API float     GetItemHeight(int item_n) const;
+    IMGUI_API double    GetItemOffset(int item_n) const;                // Sum of heights of items [0, item_n)
+    IMGUI_API int       FindItemAtOffset(double offset) const;          // Item containing 'offset', clamped to [0, GetCount() - 1]
+};
+
+// Helper: Manually clip large 2D grids of evenly spaced cells (e.g. thumbnails browser, spreadsheet).
+// Computes the visible rows AND columns from the clip rectangle, so the cost is O(visible cells).
+// Usage:
+//   ImGuiGridClipper clipper(ctx);
+//   clipper.Begin(rows_count, columns_count, ImVec2(cell_width + spacing, cell_height + spacing));
+//   while (clipper.Step())
+//       for (int row = clipper.DisplayRowStart; row < clipper.DisplayRowEnd; row++)
+//           for (int column = clipper.DisplayColumnStart; column < clipper.DisplayColumnEnd; column++)
+//           {
+//               clipper.SeekCell(row, column); // Cells need to be positioned explicitly
+//               ImGui::Image(...);
+//           }
+// - Each Step() returns a rectangular block of cells. Blocks never overlap: a cell is only returned once per frame.
+// - Blocks other than the visible one are returned for keyboard/gamepad navigation and for items included with IncludeItemsByIndex().
+// - On the last step the cursor is moved below the grid and the content size is extended on both axes.
+// - This is not designed to be used inside tables: use ImGuiListClipper for table rows.
+struct ImGuiGridClipper
+{
+    ImGuiContext*   Ctx;                // Parent UI context
+    int             DisplayRowStart;    // First row to display, updated by each call to Step()
+    int             DisplayRowEnd;      // End of rows to display (exclusive)
+    int             DisplayColumnStart; // First column to display, updated by each call to Step()
+    int             DisplayColumnEnd;   // End of columns to display (exclusive)
+    int             RowsCount;          // [Internal] Number of rows
+    int             ColumnsCount;       // [Internal] Number of columns
+    ImVec2          CellSize;           // [Internal] Distance between cells
+    ImVec2          StartPos;           // [Internal] Cursor position at the time of Begin()
+    void*           TempData;           // [Internal] Internal data
+
+    // cell_size: distance between your cells, including spacing.
+    IMGUI_API ImGuiGridClipper(ImGuiContext* ctx = NULL);
+    IMGUI_API ~ImGuiGridClipper();
+    IMGUI_API void  Begin(int rows_count, int columns_count, const ImVec2& cell_size);
+    IMGUI_API void  End();              // Automatically called on the last call of Step() that returns false.
+    IMGUI_API bool  Step();             // Call until it returns false. The DisplayRowXXX/DisplayColumnXXX fields will be set and you can process/draw those cells.
+    IMGUI_API ImVec2 GetCellPos(int row, int column) const; // Screen position of a cell
+    IMGUI_API void  SeekCell(int row, int column);          // Move cursor to a cell, call before submitting it
+
+    // Call IncludeItemsByIndex() *BEFORE* first call to Step() if you need cells to not be clipped, regardless of their visibility.
+    // Item index is (row * columns_count + column), so a range may span multiple rows.
+    inline void     IncludeCell(int row, int column)                    { IncludeItemsByIndex(row * ColumnsCount + column, row * ColumnsCount + column + 1); }
+    IMGUI_API void  IncludeItemsByIndex(int item_begin, int item_end);  // item_end is exclusive.
+};
+
+// Helper: Manually clip large trees (e.g. asset browser, scene graph) of which only a few nodes are on screen.
+// The tree is described by two callbacks returning the children of a node, identified by your own handles (>= 0, -1 for the root).
+// A persistent ImGuiTreeClipperIndex stores the flattened list of visible nodes (rows): opening a node inserts the rows of
+// its visible descendants, closing it removes them, so a frame costs O(visible rows) instead of O(open nodes).
+// Usage:
+//   static ImGuiTreeClipperIndex tree_index;               // Persistent. Call tree_index.Invalidate() if your tree structure changed.
+//   ImGuiTreeClipper clipper(ctx);
+//   clipper.Begin("tree", &tree_index, MyChildrenCountFunc, MyChildFunc, &my_tree);
+//   while (clipper.Step())
+//       for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+//           clipper.TreeNode(row, my_tree.Nodes[clipper.GetRow(row).Node].Name);
+// - Open state is stored in the window StateStorage like TreeNode() does, using GetNodeID(). Nodes are not pushed on the ID stack.
+// - Left arrow on a closed node moves to its parent, Right arrow on an open node moves to its first child, even if they are clipped.
+// - Rows are all expected to have the same height (see ImGuiListClipper).
+struct ImGuiTreeClipperRow
+{
+    int             Node;               // Your node handle
+    int             Depth;              // 0 for children of the root
+    bool            IsOpen;
+    bool            IsLeaf;             // Node has no children
+};
+
+struct ImGuiTreeClipperIndex
+{
+    ImVector<ImGuiTreeClipperRow>   Rows;           // Visible nodes in display order. An open node is followed by the rows of its visible descendants.
+    ImGuiID                         ID;             // [Internal] ID of the tree the rows were built for
+    bool                            IsDirty;        // [Internal] Set by Invalidate(): rows are rebuilt by next Begin()
+    ImVector<int>                   BuildStack;     // [Internal]
+    ImVector<ImGuiTreeClipperRow>   BuildRows;      // [Internal]
+
+    ImGuiTreeClipperIndex()         { ID = 0; IsDirty = true; }
+    void            Invalidate()    { IsDirty = true; }
+    IMGUI_API int   FindParentRow(int row) const;   // Return row of the parent node, -1 for children of the root
+};
+
+struct ImGuiTreeClipper
+{
+    ImGuiContext*           Ctx;                // Parent UI context
+    int                     DisplayStart;       // First row to display, updated by each call to Step()
+    int                     DisplayEnd;         // End of rows to display (exclusive)
+    ImGuiTreeClipperIndex*  Index;              // [Internal] Flattened list of visible nodes
+    ImGuiTreeClipperChildrenCountFunc ChildrenCountFunc; // [Internal]
+    ImGuiTreeClipperChildFunc ChildFunc;        // [Internal]
+    void*                   UserData;           // [Internal]
+    ImGuiID                 ID;                 // [Internal] Seed for node IDs
+    ImGuiStorage*           Storage;            // [Internal] Storage for open state
+    float                   StartPosX;          // [Internal] Cursor position at the time of Begin()
+    ImGuiListClipper        ListClipper;        // [Internal] Clipping rows
+
+    IMGUI_API ImGuiTreeClipper(ImGuiContext* ctx = NULL);
+    IMGUI_API ~ImGuiTreeClipper();
+    IMGUI_API void  Begin(const char* str_id, ImGuiTreeClipperIndex* index, ImGuiTreeClipperChildrenCountFunc children_count_func, ImGuiTreeClipperChildFunc child_func, void* user_data = NULL);
+    IMGUI_API void  End();                      // Automatically called on the last call of Step() that returns false.
+    IMGUI_API bool  Step();                     // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those rows.
+    IMGUI_API bool  TreeNode(int row, const char* label, ImGuiTreeNodeFlags flags = 0); // Submit tree node for a row, indented by its depth. Return true when open. Opening/closing updates rows immediately.
+    IMGUI_API void  SetNodeOpen(int row, bool open);
+    IMGUI_API ImGuiID GetNodeID(int node) const;
+    const ImGuiTreeClipperRow& GetRow(int row) const { return Index->Rows[row]; }
+};
+
+// Helper: Maintain a sorted permutation of row indices for a sortable table, so large datasets are not re-sorted from scratch.
+// Usage:
+//   static ImGuiTableSortPermutation sorter;
+//   sorter.SetRowsCount(items.Size);                    // Reset to identity if the count changed
+//   if (ImGuiTableSortSpecs* sort_specs = ImGui::TableGetSortSpecs(ctx))
+//       if (sort_specs->SpecsDirty) { sorter.SetSortSpecs(sort_specs); sort_specs->SpecsDirty = false; }
+//   sorter.Sort(MyCompareFunc, &items, 500000);         // Perform at most ~500k comparisons this frame (0 = sort to completion)
+//   [...] display items[sorter.Indices[row_n]] for each row_n
+// - The sort is stable: ties are broken on row index, so the resulting order only depends on the specs and the data.
+// - When only the direction of one sort column changed, the previous order is reused in O(N) comparisons.
+//   When sort columns are added or removed after an unchanged prefix, only runs of rows that are equal on that prefix are sorted again.
+// - With a comparisons budget, sorting is spread over multiple frames and Indices[] keeps the previous order until completion.
+// - Call Invalidate() when your data changed. Does not use the ImGui context (may run on a worker thread if you synchronize access to Indices[]).
+struct ImGuiTableSortPermutation
+{
+    ImVector<int>                       Indices;        // Display order -> row index. Only updated when a sort completes.
+    ImVector<ImGuiTableColumnSortSpecs> Specs;          // Requested sort specs (copied by SetSortSpecs())
+    ImVector<ImGuiTableColumnSortSpecs> SortedSpecs;    // Sort specs Indices[] is currently sorted with
+    bool                                IsDataDirty;    // Set by Invalidate(): next Sort() sorts from scratch
+    int                                 LastSortCompares; // Number of rows comparisons performed by the last completed sort (for stats)
+
+    // [Internal] state of in-progress sort
+    int                                 JobPhase;       // 0: none, 1: scan runs (refine), 2: scan runs (reverse direction), 3: merge sort segments
+    int                                 JobKey;         // Phase 1: keys in common prefix. Phase 2: index of reversed key. Phase 3: first key to compare.
+    int                                 JobPos, JobRunStart, JobSegment, JobWidth, JobMergeI, JobMergeJ, JobMergeK;
+    int                                 JobCompares;
+    ImVector<int>                       JobWork;        // Permutation being sorted
+    ImVector<int>                       JobTemp;        // Merge/scan output
+    ImVector<int>                       JobSegments;    // [begin, end) pairs of independent ranges to sort in phase 3, or sub-run starts in phase 2
+
+    IMGUI_API ImGuiTableSortPermutation();
+    IMGUI_API void  Clear();
+    IMGUI_API void  SetRowsCount(int rows_count);       // Reset Indices[] to identity when count changes
+    IMGUI_API void  SetSortSpecs(const ImGuiTableSortSpecs* sort_specs);
+    IMGUI_API bool  Sort(ImGuiTableSortCompareFunc compare_func, void* user_data, int max_compares = 0); // Return true when Indices[] changed
+    void            Invalidate()                        { IsDataDirty = true; JobPhase = 0; }
+    bool            IsSorting() const                   { return JobPhase != 0; }
+};
+
+// Helper: Maintain a min/max decimation index (mipmap) over a series of values, for PlotLines()/PlotHistogram() with very large series.
+// - Usage: keep one index per series, pass it every frame along with the values: PlotLines(ctx, "Signal", values, values_count, &index);
+//   The plot then draws the (min, max) envelope of the values covered by each pixel column, and computes its automatic scale and tooltip from
+//   the index: the cost is O(pixels) instead of O(values), and peaks are never skipped.
+// - Levels[n] stores (min, max) of each complete block of 16^(n+1) values. NaN values are ignored.
+//   The (min, max) of any range of values is obtained by reading at most ~30 entries per level.
+// - We don't own the values, so we maintain Count to index appended values incrementally (amortized O(1) per value).
+//   Values already indexed must not be modified: call Clear() if they are. The index is cleared automatically if the number of values decreases.
+struct ImGuiPlotIndex
+{
+    ImVector<ImVec2>    Levels[7];          // (min, max) of blocks of 16, 256, 4096... values
+    int                 Count;              // Number of values indexed
+
+    ImGuiPlotIndex()    { Count = 0; }
+    void                Clear()             { for (int n = 0; n < IM_ARRAYSIZE(Levels); n++) Levels[n].clear(); Count = 0; }
+    IMGUI_API void      Update(float (*values_getter)(void* data, int idx), void* data, int values_count);                              // Index values [Count, values_count)
+    IMGUI_API ImVec2    GetRangeMinMax(float (*values_getter)(void* data, int idx), void* data, int idx_begin, int idx_end) const;     // Return (min, max) of indexed values [idx_begin, idx_end). (FLT_MAX, -FLT_MAX) if there are none or only NaN.
+};
+
 // Helpers: ImVec2/ImVec4 operators
 // - It is important that we are keeping those disabled by default so they don't leak in user space.
 // - This is in order to allow user enabling implicit cast operators between ImVec2/ImVec4 and their own types (using IM_VEC2_CLASS_EXTRA in imconfig.h)
@@ -2911,10 +3295,11 @@ struct ImFontAtlasCustomRect
 // Flags for ImFontAtlas build
 enum ImFontAtlasFlags_
 {
-    ImFontAtlasFlags_None               = 0,
-    ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
-    ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
-    ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_None                   = 0,
+    ImFontAtlasFlags_NoPowerOfTwoHeight     = 1 << 0,   // Don't round the height to next power of two
+    ImFontAtlasFlags_NoMouseCursors         = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
+    ImFontAtlasFlags_NoBakedLines           = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_SignedDistanceField    = 1 << 3,   // Rasterize glyphs as signed distance fields (alpha 0.5 = glyph edge) so a font baked once stays sharp at any scale. Requires backend support: draw commands using the atlas TexSdfID must be rendered with a distance-field shader (see imgui_impl_opengl3.cpp). Implies ImFontAtlasFlags_NoBakedLines.
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -2955,10 +3340,12 @@ struct ImFontAtlas
     // Building in RGBA32 format is provided for convenience and compatibility, but note that unless you manually manipulate or copy color data into
     // the texture (e.g. when using the AddCustomRect*** api), then the RGB pixels emitted will always be white (~75% of memory/bandwidth waste.
     IMGUI_API bool              Build();                    // Build pixels data. This is called automatically for you by the GetTexData*** functions.
+    IMGUI_API bool              BuildIncremental();         // Pack custom rects added since last build into the existing texture (growing its height if needed) without re-rasterizing fonts. Changed regions are appended to TexDirtyRects[]. Falls back to Build() when the atlas can't be updated in place.
     IMGUI_API void              GetTexDataAsAlpha8(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel = NULL);  // 1 byte per-pixel
     IMGUI_API void              GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel = NULL);  // 4 bytes-per-pixel
     bool                        IsBuilt() const             { return Fonts.Size > 0 && TexReady; } // Bit ambiguous: used to detect when user didn't build texture but effectively we should check TexID != 0 except that would be backend dependent...
     void                        SetTexID(ImTextureID id)    { TexID = id; }
+    ImTextureID                 GetGlyphsTexID() const      { return (TexSdfID != (ImTextureID)NULL) ? TexSdfID : TexID; } // Texture ID used by text and shapes, see TexSdfID.
 
     //-------------------------------------------
     // Glyph Ranges
@@ -2984,6 +3371,8 @@ struct ImFontAtlas
 
     // You can request arbitrary rectangles to be packed into the atlas, for your own purposes.
     // - After calling Build(), you can query the rectangle position and render your pixels.
+    // - Rectangles added after the atlas is built can be packed with BuildIncremental(), which keeps existing glyphs in place.
+    //   Upload the regions listed in TexDirtyRects[] (or the whole texture if its size changed), then clear the list.
     // - If you render colored output, set 'atlas->TexPixelsUseColors = true' as this may help some backends decide of prefered texture format.
     // - You can also request your rectangles to be mapped as font glyph (given a font + Unicode point),
     //   so you can render e.g. custom colorful icons and use them as regular glyphs.
@@ -3003,8 +3392,10 @@ struct ImFontAtlas
 
     ImFontAtlasFlags            Flags;              // Build flags (see ImFontAtlasFlags_)
     ImTextureID                 TexID;              // User data to refer to the texture once it has been uploaded to user's graphic systems. It is passed back to you during rendering via the ImDrawCmd structure.
+    ImTextureID                 TexSdfID;           // [ImFontAtlasFlags_SignedDistanceField] Optional second identifier for the same texture, set by backend. Used by text and shapes draw commands so only those are rendered with a distance-field shader, while Image(TexID) and software mouse cursors keep using TexID.
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0 (will also need to set AntiAliasedLinesUseTex = false).
+    int                         TexSdfSpread;       // Distance in pixels encoded on each side of glyph outlines when using ImFontAtlasFlags_SignedDistanceField. Defaults to 4. Larger values allow more downscaling and outline/glow effects at the cost of texture space.
     bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert.
     void*                       UserData;           // Store your own atlas related user-data (if e.g. you have multiple font atlas).
 
@@ -3022,6 +3413,7 @@ struct ImFontAtlas
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      ConfigData;         // Configuration data
     ImVec4                      TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];  // UVs for baked anti-aliased lines
+    ImVector<ImVec4>            TexDirtyRects;      // Texture regions (x1, y1, x2, y2 in pixels) modified by BuildIncremental(). Backend may upload those sub-regions then clear the list. A region covering the whole texture is pushed when the texture grows.
 
     // [Internal] Font builder
     const ImFontBuilderIO*      FontBuilderIO;      // Opaque interface to a font builder (default to stb_truetype, can be changed to use FreeType by defining IMGUI_ENABLE_FREETYPE).
@@ -3030,23 +3422,31 @@ struct ImFontAtlas
     // [Internal] Packing data
     int                         PackIdMouseCursors; // Custom texture rectangle ID for white pixel and mouse cursors
     int                         PackIdLines;        // Custom texture rectangle ID for baked anti-aliased lines
+    void*                       PackContext;        // Rectangle packer state (skyline) retained after Build() for BuildIncremental(). Freed by ClearTexData().
 
     // [Obsolete]
     //typedef ImFontAtlasCustomRect    CustomRect;         // OBSOLETED in 1.72+
     //typedef ImFontGlyphRangesBuilder GlyphRangesBuilder; // OBSOLETED in 1.67+
 };
 
+// ImFont::IndexAdvanceX[] and ImFont::IndexLookup[] are stored in pages of 256 codepoints, so that merging a few glyphs from a far
+// away Unicode plane (e.g. emojis) doesn't allocate an entry for every codepoint below them. ImFont::IndexPages[] maps a codepoint
+// page (c >> IM_FONT_INDEX_PAGE_SHIFT) to its slot in those arrays. Slot 0 is always allocated and holds fallback values, unused pages point to it.
+#define IM_FONT_INDEX_PAGE_SHIFT    8
+#define IM_FONT_INDEX_PAGE_SIZE     (1 << IM_FONT_INDEX_PAGE_SHIFT)
+
 // Font runtime data and rendering
 // ImFontAtlas automatically loads a default embedded font for you when you call GetTexDataAsAlpha8() or GetTexDataAsRGBA32().
 struct ImFont
 {
-    // Members: Hot ~20/24 bytes (for CalcTextSize)
-    ImVector<float>             IndexAdvanceX;      // 12-16 // out //            // Sparse. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this this info, and are often bottleneck in large UI).
+    // Members: Hot ~32/40 bytes (for CalcTextSize)
+    ImVector<ImU16>             IndexPages;         // 12-16 // out //            // Codepoint page -> page slot in IndexAdvanceX[]/IndexLookup[]. Sized to the highest loaded codepoint page.
+    ImVector<float>             IndexAdvanceX;      // 12-16 // out //            // Sparse, paged. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this this info, and are often bottleneck in large UI).
     float                       FallbackAdvanceX;   // 4     // out // = FallbackGlyph->AdvanceX
     float                       FontSize;           // 4     // in  //            // Height of characters/line, set during loading (don't change after loading)
 
     // Members: Hot ~28/40 bytes (for CalcTextSize + render loop)
-    ImVector<ImWchar>           IndexLookup;        // 12-16 // out //            // Sparse. Index glyphs by Unicode code-point.
+    ImVector<ImWchar>           IndexLookup;        // 12-16 // out //            // Sparse, paged. Index glyphs by Unicode code-point.
     ImVector<ImFontGlyph>       Glyphs;             // 12-16 // out //            // All glyphs.
     const ImFontGlyph*          FallbackGlyph;      // 4-8   // out // = FindGlyph(FontFallbackChar)
 
@@ -3070,7 +3470,7 @@ struct ImFont
     IMGUI_API ~ImFont();
     IMGUI_API const ImFontGlyph*FindGlyph(ImWchar c) const;
     IMGUI_API const ImFontGlyph*FindGlyphNoFallback(ImWchar c) const;
-    float                       GetCharAdvance(ImWchar c) const     { return ((int)c < IndexAdvanceX.Size) ? IndexAdvanceX[(int)c] : FallbackAdvanceX; }
+    float                       GetCharAdvance(ImWchar c) const     { const unsigned int page_n = (unsigned int)c >> IM_FONT_INDEX_PAGE_SHIFT; return (page_n < (unsigned int)IndexPages.Size) ? IndexAdvanceX.Data[((unsigned int)IndexPages.Data[page_n] << IM_FONT_INDEX_PAGE_SHIFT) | (c & (IM_FONT_INDEX_PAGE_SIZE - 1))] : FallbackAdvanceX; }
     bool                        IsLoaded() const                    { return ContainerAtlas != NULL; }
     const char*                 GetDebugName() const                { return ConfigData ? ConfigData->Name : "<unknown>"; }
 
@@ -3084,7 +3484,7 @@ struct ImFont
     // [Internal] Don't use!
     IMGUI_API void              BuildLookupTable();
     IMGUI_API void              ClearOutputData();
-    IMGUI_API void              GrowIndex(int new_size);
+    IMGUI_API void              GrowIndex(int new_size);            // Grow IndexPages[] to cover codepoints [0..new_size). Pages are allocated on demand when a codepoint is indexed.
     IMGUI_API void              AddGlyph(const ImFontConfig* src_cfg, ImWchar c, float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float advance_x);
     IMGUI_API void              AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst = true); // Makes 'dst' character/glyph points to 'src' character/glyph. Currently needs to be called AFTER fonts have been built.
     IMGUI_API void              SetGlyphVisible(ImWchar c, bool visible);
@@ -445,6 +445,7 @@ void ImGui::ShowDemoWindow(ImGuiContext* ctx, bool* p_open)
             if (io.ConfigFlags & ImGuiConfigFlags_NoMouse)
             {
                 // The "NoMouse" option can get us stuck with a disabled mouse! Let's provide an alternative way to fix it:
+                ImGui::RequestWakeup(ctx, 0.20f - fmodf((float)ImGui::GetTime(ctx), 0.20f)); // Let idling applications know we are blinking
                 if (fmodf((float)ImGui::GetTime(ctx), 0.40f) < 0.20f)
                 {
                     ImGui::SameLine(ctx);
@@ -806,6 +807,7 @@ static void ShowDemoWindowWidgets(ImGuiContext* ctx)
             static float arr[] = { 0.6f, 0.1f, 1.0f, 0.5f, 0.92f, 0.1f, 0.2f };
             ImGui::PlotLines(ctx, "Curve", arr, IM_ARRAYSIZE(arr));
             ImGui::Text(ctx, "Sin(time) = %f", sinf((float)ImGui::GetTime(ctx)));
+            ImGui::RequestWakeup(ctx); // Animated contents: request next frame (see GetNextWakeupTime())
             ImGui::EndTooltip(ctx);
         }
 
@@ -824,6 +826,7 @@ static void ShowDemoWindowWidgets(ImGuiContext* ctx)
         else if (always_on == 2 && ImGui::BeginTooltip(ctx))
         {
             ImGui::ProgressBar(ctx, sinf((float)ImGui::GetTime(ctx)) * 0.5f + 0.5f, ImVec2(ImGui::GetFontSize(ctx) * 25, 0.0f));
+            ImGui::RequestWakeup(ctx);
             ImGui::EndTooltip(ctx);
         }
 
@@ -982,6 +985,38 @@ static void ShowDemoWindowWidgets(ImGuiContext* ctx)
                 ImGui::Indent(ctx, ImGui::GetTreeNodeToLabelSpacing(ctx));
             ImGui::TreePop(ctx);
         }
+
+        IMGUI_DEMO_MARKER("Widgets/Tree Nodes/Large tree, with clipper");
+        if (ImGui::TreeNode(ctx, "Large tree, with clipper"))
+        {
+            HelpMarker(ctx,
+                "ImGuiTreeClipper only submits the visible rows of a tree, "
+                "using a flattened list of open nodes updated when opening/closing nodes.\n"
+                "Here a tree of 500000 nodes where each node has up to 8 children.\n"
+                "Use Left/Right arrows to move to parent/first child.");
+            struct LargeTree
+            {
+                // Implicit tree: children of node N are nodes N*8+1 to N*8+8. The root (-1) has a single child: node 0.
+                static int ChildrenCount(int node, void*)      { int first_child = node * 8 + 1; return (node == -1) ? 1 : (first_child >= 500000) ? 0 : (500000 - first_child < 8) ? 500000 - first_child : 8; }
+                static int Child(int node, int child_n, void*) { return (node == -1) ? 0 : node * 8 + 1 + child_n; }
+            };
+            static ImGuiTreeClipperIndex tree_index;
+            ImGui::Text(ctx, "%d visible rows", tree_index.Rows.Size);
+            if (ImGui::BeginChild(ctx, "##large_tree", ImVec2(0.0f, ImGui::GetFontSize(ctx) * 20.0f), ImGuiChildFlags_Border))
+            {
+                ImGuiTreeClipper clipper(ctx);
+                clipper.Begin("tree", &tree_index, LargeTree::ChildrenCount, LargeTree::Child);
+                while (clipper.Step())
+                    for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+                    {
+                        char label[32];
+                        sprintf(label, "Node %d", clipper.GetRow(row).Node);
+                        clipper.TreeNode(row, label, ImGuiTreeNodeFlags_SpanAvailWidth);
+                    }
+            }
+            ImGui::EndChild(ctx);
+            ImGui::TreePop(ctx);
+        }
         ImGui::TreePop(ctx);
     }
 
@@ -1409,7 +1444,10 @@ static void ShowDemoWindowWidgets(ImGuiContext* ctx)
             const float time = (float)ImGui::GetTime(ctx);
             const bool winning_state = memchr(selected, 0, sizeof(selected)) == NULL; // If all cells are selected...
             if (winning_state)
+            {
                 ImGui::PushStyleVar(ctx, ImGuiStyleVar_SelectableTextAlign, ImVec2(0.5f + 0.5f * cosf(time * 2.0f), 0.5f + 0.5f * sinf(time * 3.0f)));
+                ImGui::RequestWakeup(ctx);
+            }
 
             for (int y = 0; y < 4; y++)
                 for (int x = 0; x < 4; x++)
@@ -1491,6 +1529,34 @@ static void ShowDemoWindowWidgets(ImGuiContext* ctx)
             ImGui::TreePop(ctx);
         }
 
+        IMGUI_DEMO_MARKER("Widgets/Text Input/Large document");
+        if (ImGui::TreeNode(ctx, "Large document"))
+        {
+            // ImGuiTextDocument owns the text (UTF-8 gap buffer + line index + undo log) and is edited in place.
+            // Cost of a frame or a keystroke doesn't depend on the size of the document.
+            static ImGuiTextDocument doc;
+            static int lines_count = 0;
+            HelpMarker(ctx, "InputTextMultiline() with a ImGuiTextDocument only measures and renders visible lines, edits don't touch the rest of the text and the undo log has no size limit.");
+            bool generate = (lines_count == 0);
+            if (ImGui::Button(ctx, "1k lines")) { lines_count = 1000; generate = true; }
+            ImGui::SameLine(ctx);
+            if (ImGui::Button(ctx, "100k lines")) { lines_count = 100000; generate = true; }
+            ImGui::SameLine(ctx);
+            if (ImGui::Button(ctx, "1M lines (~80 MB)")) { lines_count = 1000000; generate = true; }
+            if (generate)
+            {
+                lines_count = IM_MAX(lines_count, 1000);
+                ImGuiTextBuffer buf;
+                buf.reserve(lines_count * 80);
+                for (int n = 0; n < lines_count; n++)
+                    buf.appendf("%08d: The quick brown fox jumps over the lazy dog. Lorem ipsum dolor sit amet.\n", n);
+                doc.SetText(buf.begin(), buf.end());
+            }
+            ImGui::Text(ctx, "%d bytes, %d lines, cursor %d, undo records %d/%d (%d bytes)", doc.GetLength(), doc.GetLineCount(), doc.Cursor, doc.UndoPos, doc.UndoRecords.Size, doc.UndoText.Size);
+            ImGui::InputTextMultiline(ctx, "##document", &doc, ImVec2(-FLT_MIN, ImGui::GetTextLineHeight(ctx) * 16), ImGuiInputTextFlags_AllowTabInput);
+            ImGui::TreePop(ctx);
+        }
+
         IMGUI_DEMO_MARKER("Widgets/Text Input/Filtered Text Input");
         if (ImGui::TreeNode(ctx, "Filtered Text Input"))
         {
@@ -1829,6 +1895,8 @@ static void ShowDemoWindowWidgets(ImGuiContext* ctx)
             phase += 0.10f * values_offset;
             refresh_time += 1.0f / 60.0f;
         }
+        if (animate)
+            ImGui::RequestWakeup(ctx, (float)(refresh_time - ImGui::GetTime(ctx)));
 
         // Plots can display overlay texts
         // (in this example, we will display an average value)
@@ -1859,6 +1927,44 @@ static void ShowDemoWindowWidgets(ImGuiContext* ctx)
         float (*func)(void*, int) = (func_type == 0) ? Funcs::Sin : Funcs::Saw;
         ImGui::PlotLines(ctx, "Lines", func, NULL, display_count, 0, NULL, -1.0f, 1.0f, ImVec2(0, 80));
         ImGui::PlotHistogram(ctx, "Histogram", func, NULL, display_count, 0, NULL, -1.0f, 1.0f, ImVec2(0, 80));
+
+        // Plot very large series with an index
+        // The index stores min/max of blocks of values, so the plot only reads a few entries per pixel column.
+        // Values appended since last frame are indexed incrementally. Peaks are never skipped, unlike when sampling one value per column.
+        IMGUI_DEMO_MARKER("Widgets/Plotting/Large series");
+        ImGui::SeparatorText(ctx, "Large series (with ImGuiPlotIndex)");
+        static ImVector<float> large_values;
+        static ImGuiPlotIndex large_index;
+        static bool large_stream = false;
+        int large_append_count = 0;
+        if (ImGui::Button(ctx, "Generate 1M"))  { large_values.resize(0); large_index.Clear(); large_append_count = 1000000; }
+        ImGui::SameLine(ctx);
+        if (ImGui::Button(ctx, "Generate 10M")) { large_values.resize(0); large_index.Clear(); large_append_count = 10000000; } // Values were replaced: clear index
+        ImGui::SameLine(ctx);
+        ImGui::Checkbox(ctx, "Stream 10k values/frame", &large_stream);
+        ImGui::SameLine(ctx);
+        if (ImGui::Button(ctx, "Clear"))
+            large_values.clear(); // Index is cleared automatically when values count decreases
+        if (large_stream && animate && large_values.Size < 50000000)
+            large_append_count += 10000;
+        if (large_append_count > 0)
+        {
+            for (int n = 0; n < large_append_count; n++)
+            {
+                const int i = large_values.Size;
+                float v = sinf(i * 0.00002f) * 0.5f + (float)(((unsigned int)i * 7919u) % 1000u) * 0.0002f; // Slow wave + noise
+                if ((i % 250007) == 0)
+                    v += 1.0f;                                                              // Rare single-value spikes
+                large_values.push_back(v);
+            }
+        }
+        ImGui::PlotLines(ctx, "Lines##large", large_values.Data, large_values.Size, &large_index, NULL, FLT_MAX, FLT_MAX, ImVec2(0, 80));
+        ImGui::PlotHistogram(ctx, "Histogram##large", large_values.Data, large_values.Size, &large_index, NULL, FLT_MAX, FLT_MAX, ImVec2(0, 80));
+        int large_index_levels = 0;
+        for (int n = 0; n < IM_ARRAYSIZE(large_index.Levels); n++)
+            if (large_index.Levels[n].Size > 0)
+                large_index_levels++;
+        ImGui::Text(ctx, "%d values, %d index levels", large_values.Size, large_index_levels);
         ImGui::Separator(ctx);
 
         // Animate a simple progress bar
@@ -1869,6 +1975,7 @@ static void ShowDemoWindowWidgets(ImGuiContext* ctx)
             progress += progress_dir * 0.4f * ImGui::GetIO(ctx).DeltaTime;
             if (progress >= +1.1f) { progress = +1.1f; progress_dir *= -1.0f; }
             if (progress <= -0.1f) { progress = -0.1f; progress_dir *= -1.0f; }
+            ImGui::RequestWakeup(ctx);
         }
 
         // Typically we would use ImVec2(-1.0f,0.0f) or ImVec2(-FLT_MIN,0.0f) to use all available width,
@@ -3545,6 +3652,37 @@ static void ShowDemoWindowLayout(ImGuiContext* ctx)
         ImGui::TreePop(ctx);
     }
 
+    IMGUI_DEMO_MARKER("Layout/Grid Clipper");
+    if (ImGui::TreeNode(ctx, "Grid Clipper"))
+    {
+        static int rows_count = 100000;
+        static int columns_count = 1000;
+        ImGui::SetNextItemWidth(ctx, ImGui::GetFontSize(ctx) * 12);
+        ImGui::DragInt(ctx, "rows", &rows_count, 100.0f, 0, 10000000);
+        ImGui::SetNextItemWidth(ctx, ImGui::GetFontSize(ctx) * 12);
+        ImGui::DragInt(ctx, "columns", &columns_count, 10.0f, 0, 100000);
+        HelpMarker(ctx, "ImGuiGridClipper computes visible rows and columns, so only visible cells are submitted. Cells can be navigated with keyboard/gamepad.");
+
+        const ImVec2 cell_size(ImGui::GetFontSize(ctx) * 4.0f, ImGui::GetFrameHeight(ctx));
+        const ImVec2 cell_spacing = ImGui::GetStyle(ctx).ItemSpacing;
+        if (ImGui::BeginChild(ctx, "##grid", ImVec2(0.0f, ImGui::GetFontSize(ctx) * 20.0f), ImGuiChildFlags_Border, ImGuiWindowFlags_HorizontalScrollbar))
+        {
+            ImGuiGridClipper clipper(ctx);
+            clipper.Begin(rows_count, columns_count, ImVec2(cell_size.x + cell_spacing.x, cell_size.y + cell_spacing.y));
+            while (clipper.Step())
+                for (int row = clipper.DisplayRowStart; row < clipper.DisplayRowEnd; row++)
+                    for (int column = clipper.DisplayColumnStart; column < clipper.DisplayColumnEnd; column++)
+                    {
+                        char label[32];
+                        sprintf(label, "%d,%d", row, column);
+                        clipper.SeekCell(row, column);
+                        ImGui::Button(ctx, label, cell_size);
+                    }
+        }
+        ImGui::EndChild(ctx);
+        ImGui::TreePop(ctx);
+    }
+
     IMGUI_DEMO_MARKER("Layout/Overlap Mode");
     if (ImGui::TreeNode(ctx, "Overlap Mode"))
     {
@@ -4739,6 +4877,50 @@ static void ShowDemoWindowTables(ImGuiContext* ctx)
             }
             ImGui::EndTable(ctx);
         }
+
+        ImGui::Spacing(ctx);
+        ImGui::TextUnformatted(ctx, "Many columns + ScrollX");
+        ImGui::SameLine(ctx);
+        HelpMarker(ctx,
+            "Only visible columns are given draw channels, so tables can have thousands of columns.\n"
+            "Use TableGetVisibleColumnCount()/TableGetVisibleColumnIndex() to only submit the columns in view, "
+            "combined with ImGuiListClipper for rows.");
+        static int columns_count = 5000;
+        PushStyleCompact(ctx);
+        ImGui::SetNextItemWidth(ctx, TEXT_BASE_WIDTH * 30);
+        ImGui::SliderInt(ctx, "columns_count", &columns_count, 1, 20000);
+        PopStyleCompact(ctx);
+        const ImGuiTableFlags flags3 = ImGuiTableFlags_ScrollX | ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_Resizable | ImGuiTableFlags_NoSavedSettings;
+        if (ImGui::BeginTable(ctx, "table_many_columns", columns_count, flags3, outer_size))
+        {
+            ImGui::TableSetupScrollFreeze(ctx, 1, 1);
+            ImGui::TableSetupColumn(ctx, "Line #", ImGuiTableColumnFlags_WidthFixed, TEXT_BASE_WIDTH * 8);
+            for (int column = 1; column < columns_count; column++)
+                ImGui::TableSetupColumn(ctx, NULL, ImGuiTableColumnFlags_WidthFixed, TEXT_BASE_WIDTH * 10);
+            ImGui::TableNextRow(ctx, ImGuiTableRowFlags_Headers);
+            for (int visible_n = 0; visible_n < ImGui::TableGetVisibleColumnCount(ctx); visible_n++)
+            {
+                const int column = ImGui::TableGetVisibleColumnIndex(ctx, visible_n);
+                ImGui::TableSetColumnIndex(ctx, column);
+                char label[32];
+                sprintf(label, "Col %d", column);
+                ImGui::TableHeader(ctx, label);
+            }
+            ImGuiListClipper clipper(ctx);
+            clipper.Begin(1000);
+            while (clipper.Step())
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+                {
+                    ImGui::TableNextRow(ctx);
+                    for (int visible_n = 0; visible_n < ImGui::TableGetVisibleColumnCount(ctx); visible_n++)
+                    {
+                        const int column = ImGui::TableGetVisibleColumnIndex(ctx, visible_n);
+                        ImGui::TableSetColumnIndex(ctx, column);
+                        ImGui::Text(ctx, "%d,%d", column, row);
+                    }
+                }
+            ImGui::EndTable(ctx);
+        }
         ImGui::TreePop(ctx);
     }
 
@@ -5578,6 +5760,71 @@ static void ShowDemoWindowTables(ImGuiContext* ctx)
                 }
             ImGui::EndTable(ctx);
         }
+
+        // Large dataset: sort a permutation of row indices instead of the data, spread over multiple frames.
+        ImGui::Spacing(ctx);
+        ImGui::TextUnformatted(ctx, "Large dataset with ImGuiTableSortPermutation");
+        ImGui::SameLine(ctx);
+        HelpMarker(ctx,
+            "ImGuiTableSortPermutation keeps a sorted permutation of row indices. "
+            "Flipping the direction of a column or Shift+Clicking to add a secondary column reuses the previous order.\n"
+            "Here sorting is limited to 200k comparisons per frame: the previous order is displayed until sorting completes.");
+        struct LargeDataset
+        {
+            static int Compare(int row_a, int row_b, const ImGuiTableColumnSortSpecs* spec, void* user_data)
+            {
+                const ImVector<int>* columns = (const ImVector<int>*)user_data;
+                const int a = columns[spec->ColumnIndex][row_a], b = columns[spec->ColumnIndex][row_b];
+                return (a > b) - (a < b);
+            }
+        };
+        static ImVector<int> large_columns[3];
+        static ImGuiTableSortPermutation sorter;
+        if (large_columns[0].Size == 0)
+            for (int column = 0; column < 3; column++)
+            {
+                large_columns[column].resize(1000000);
+                for (int row_n = 0; row_n < large_columns[column].Size; row_n++)
+                    large_columns[column][row_n] = (int)(((unsigned int)row_n * 2654435761u + (unsigned int)column * 40503u) % (column == 0 ? 10u : column == 1 ? 1000u : 1000000u));
+            }
+        sorter.SetRowsCount(large_columns[0].Size);
+        if (ImGui::BeginTable(ctx, "table_sorting_large", 4, flags | ImGuiTableFlags_SortMulti, ImVec2(0.0f, TEXT_BASE_HEIGHT * 10), 0.0f))
+        {
+            ImGui::TableSetupColumn(ctx, "A (10 values)", ImGuiTableColumnFlags_DefaultSort);
+            ImGui::TableSetupColumn(ctx, "B (1000 values)");
+            ImGui::TableSetupColumn(ctx, "C");
+            ImGui::TableSetupColumn(ctx, "Row", ImGuiTableColumnFlags_NoSort);
+            ImGui::TableSetupScrollFreeze(ctx, 0, 1);
+            ImGui::TableHeadersRow(ctx);
+            if (ImGuiTableSortSpecs* sort_specs = ImGui::TableGetSortSpecs(ctx))
+                if (sort_specs->SpecsDirty)
+                {
+                    sorter.SetSortSpecs(sort_specs);
+                    sort_specs->SpecsDirty = false;
+                }
+            sorter.Sort(LargeDataset::Compare, large_columns, 200000);
+
+            ImGuiListClipper clipper(ctx);
+            clipper.Begin(sorter.Indices.Size);
+            while (clipper.Step())
+                for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+                {
+                    const int data_n = sorter.Indices[row_n];
+                    ImGui::TableNextRow(ctx);
+                    for (int column = 0; column < 3; column++)
+                    {
+                        ImGui::TableNextColumn(ctx);
+                        ImGui::Text(ctx, "%d", large_columns[column][data_n]);
+                    }
+                    ImGui::TableNextColumn(ctx);
+                    ImGui::Text(ctx, "%d", data_n);
+                }
+            ImGui::EndTable(ctx);
+        }
+        if (sorter.IsSorting())
+            ImGui::Text(ctx, "Sorting... (%d comparisons so far)", sorter.JobCompares);
+        else
+            ImGui::Text(ctx, "Last sort: %d comparisons", sorter.LastSortCompares);
         ImGui::TreePop(ctx);
     }
 
@@ -7646,14 +7893,18 @@ static void ShowExampleAppLongText(ImGuiContext* ctx, bool* p_open)
 
     static int test_type = 0;
     static ImGuiTextBuffer log;
+    static ImGuiTextIndex log_index;
+    static ImGuiListClipperHeights log_heights;
     static int lines = 0;
     ImGui::Text(ctx, "Printing unusually long amount of text.");
     ImGui::Combo(ctx, "Test type", &test_type,
         "Single call to TextUnformatted()\0"
         "Multiple calls to Text(), clipped\0"
-        "Multiple calls to Text(), not clipped (slow)\0");
+        "Multiple calls to Text(), not clipped (slow)\0"
+        "Single call to TextUnformattedIndexed()\0"
+        "Multiple calls to Text() with variable height, clipped\0");
     ImGui::Text(ctx, "Buffer contents: %d lines, %d bytes", lines, log.size());
-    if (ImGui::Button(ctx, "Clear")) { log.clear(); lines = 0; }
+    if (ImGui::Button(ctx, "Clear")) { log.clear(); log_index.clear(); log_heights.Clear(); lines = 0; }
     ImGui::SameLine(ctx);
     if (ImGui::Button(ctx, "Add 1000 lines"))
     {
@@ -7687,6 +7938,27 @@ static void ShowExampleAppLongText(ImGuiContext* ctx, bool* p_open)
             ImGui::Text(ctx, "%i The quick brown fox jumps over the lazy dog", i);
         ImGui::PopStyleVar(ctx);
         break;
+    case 3:
+        // Single call to TextUnformattedIndexed() with a big buffer: the line index is updated as we append to the buffer,
+        // so only visible lines are processed (whereas TextUnformatted() needs to scan the whole buffer every frame).
+        ImGui::TextUnformattedIndexed(ctx, log.begin(), log.end(), &log_index);
+        break;
+    case 4:
+        {
+            // Every 10th item is taller: heights are measured by the clipper as items get displayed, and stored in a prefix-sum
+            // index so that seeking to the first visible item stays O(log N) and the scrollbar converges to the exact size.
+            ImGuiListClipper clipper(ctx);
+            clipper.BeginVariableHeight(lines, &log_heights);
+            while (clipper.Step())
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+                {
+                    if ((i % 10) == 0)
+                        ImGui::Text(ctx, "%i The quick brown fox\njumps over\nthe lazy dog", i);
+                    else
+                        ImGui::Text(ctx, "%i The quick brown fox jumps over the lazy dog", i);
+                }
+            break;
+        }
     }
     ImGui::EndChild(ctx);
     ImGui::End(ctx);
@@ -7938,6 +8210,7 @@ static void ShowExampleAppWindowTitles(ImGuiContext* ctx, bool*)
     // Using "###" to display a changing title but keep a static identifier "AnimatedTitle"
     char buf[128];
     sprintf(buf, "Animated title %c %d###AnimatedTitle", "|/-\\"[(int)(ImGui::GetTime(ctx) / 0.25f) & 3], ImGui::GetFrameCount(ctx));
+    ImGui::RequestWakeup(ctx, 0.25f - fmodf((float)ImGui::GetTime(ctx), 0.25f));
     ImGui::SetNextWindowPos(ctx, ImVec2(base_pos.x + 100, base_pos.y + 300), ImGuiCond_FirstUseEver);
     ImGui::Begin(ctx, buf);
     ImGui::Text(ctx, "This window has a changing title.");
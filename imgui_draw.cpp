@@ -733,7 +733,7 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         const bool use_texture = (Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f) && (AA_SIZE == 1.0f);
 
         // We should never hit this, because NewFrame() doesn't set ImDrawListFlags_AntiAliasedLinesUseTex unless ImFontAtlasFlags_NoBakedLines is off
-        IM_ASSERT_PARANOID(!use_texture || !(_Data->Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedLines));
+        IM_ASSERT_PARANOID(!use_texture || !(_Data->Font->ContainerAtlas->Flags & (ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_SignedDistanceField)));
 
         const int idx_count = use_texture ? (count * 6) : (thick_line ? count * 18 : count * 12);
         const int vtx_count = use_texture ? (points_count * 2) : (thick_line ? points_count * 4 : points_count * 3);
@@ -1624,7 +1624,7 @@ void ImDrawList::AddText(const ImFont* font, float font_size, const ImVec2& pos,
     if (font_size == 0.0f)
         font_size = _Data->FontSize;
 
-    IM_ASSERT(font->ContainerAtlas->TexID == _CmdHeader.TextureId);  // Use high-level ImGui::PushFont() or low-level ImDrawList::PushTextureId() to change font.
+    IM_ASSERT(font->ContainerAtlas->GetGlyphsTexID() == _CmdHeader.TextureId);  // Use high-level ImGui::PushFont() or low-level ImDrawList::PushTextureId() to change font.
 
     ImVec4 clip_rect = _CmdHeader.ClipRect;
     if (cpu_fine_clip_rect)
@@ -2067,10 +2067,18 @@ static const ImVec2 FONT_ATLAS_DEFAULT_TEX_CURSOR_DATA[ImGuiMouseCursor_COUNT][3
     { ImVec2(109,0),ImVec2(13,15), ImVec2( 6, 7) }, // ImGuiMouseCursor_NotAllowed
 };
 
+// Rectangle packer state retained after building, so that BuildIncremental() can keep packing into the same skyline.
+struct ImFontAtlasPackContext
+{
+    stbrp_context           Context;
+    ImVector<stbrp_node>    Nodes;
+};
+
 ImFontAtlas::ImFontAtlas()
 {
     memset(this, 0, sizeof(*this));
     TexGlyphPadding = 1;
+    TexSdfSpread = 4;
     PackIdMouseCursors = PackIdLines = -1;
 }
 
@@ -2110,9 +2118,13 @@ void    ImFontAtlas::ClearTexData()
         IM_FREE(TexPixelsAlpha8);
     if (TexPixelsRGBA32)
         IM_FREE(TexPixelsRGBA32);
+    if (PackContext)
+        IM_DELETE((ImFontAtlasPackContext*)PackContext);
     TexPixelsAlpha8 = NULL;
     TexPixelsRGBA32 = NULL;
     TexPixelsUseColors = false;
+    PackContext = NULL;
+    TexDirtyRects.clear();
     // Important: we leave TexReady untouched
 }
 
@@ -2384,6 +2396,80 @@ bool    ImFontAtlas::Build()
     return builder_io->FontBuilder_Build(this);
 }
 
+static bool ImFontAtlasBuildFull(ImFontAtlas* atlas)
+{
+    if (!atlas->Build())
+        return false;
+    atlas->TexDirtyRects.push_back(ImVec4(0.0f, 0.0f, (float)atlas->TexWidth, (float)atlas->TexHeight));
+    return true;
+}
+
+// Pack custom rectangles which were added after the last build into the retained skyline, without touching existing glyphs.
+// - When packed rectangles don't fit the current texture, its height is doubled (as many times as needed) and the whole texture is marked dirty.
+// - When in-place packing isn't possible (atlas not built, fonts added, texture data cleared, builder not retaining its packer state,
+//   or a rectangle doesn't fit the texture width), we fall back to a full Build().
+bool    ImFontAtlas::BuildIncremental()
+{
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasPackContext* pack = (ImFontAtlasPackContext*)PackContext;
+    if (!IsBuilt() || pack == NULL || (TexPixelsAlpha8 == NULL && TexPixelsRGBA32 == NULL))
+        return ImFontAtlasBuildFull(this);
+
+    ImVector<stbrp_rect> pack_rects;
+    for (int i = 0; i < CustomRects.Size; i++)
+        if (!CustomRects[i].IsPacked())
+        {
+            stbrp_rect r = {};
+            r.id = i;
+            r.w = CustomRects[i].Width + TexGlyphPadding;
+            r.h = CustomRects[i].Height + TexGlyphPadding;
+            pack_rects.push_back(r);
+        }
+    if (pack_rects.Size == 0)
+        return true;
+
+    // On failure the retained state is partially modified, but the full Build() discards it anyway.
+    stbrp_pack_rects(&pack->Context, pack_rects.Data, pack_rects.Size);
+    int required_height = TexHeight;
+    for (const stbrp_rect& r : pack_rects)
+    {
+        if (!r.was_packed)
+            return ImFontAtlasBuildFull(this);
+        required_height = ImMax(required_height, r.y + r.h);
+    }
+    if (required_height > TexHeight)
+    {
+        int new_height = TexHeight;
+        if (Flags & ImFontAtlasFlags_NoPowerOfTwoHeight)
+            new_height = required_height + 1; // Same as full build
+        else
+            while (new_height < required_height)
+                new_height *= 2;
+        ImFontAtlasBuildGrowTexture(this, new_height);
+    }
+
+    const int padding = TexGlyphPadding; // Same as ImFontAtlasBuildPackCustomRects()
+    for (const stbrp_rect& r : pack_rects)
+    {
+        ImFontAtlasCustomRect* user_rect = &CustomRects[r.id];
+        user_rect->X = (unsigned short)(r.x + padding);
+        user_rect->Y = (unsigned short)(r.y + padding);
+        TexDirtyRects.push_back(ImVec4((float)user_rect->X, (float)user_rect->Y, (float)(user_rect->X + user_rect->Width), (float)(user_rect->Y + user_rect->Height)));
+
+        // Register custom rectangle glyphs (same as ImFontAtlasBuildFinish())
+        if (user_rect->Font == NULL || user_rect->GlyphID == 0)
+            continue;
+        IM_ASSERT(user_rect->Font->ContainerAtlas == this);
+        ImVec2 uv0, uv1;
+        CalcCustomRectUV(user_rect, &uv0, &uv1);
+        user_rect->Font->AddGlyph(NULL, (ImWchar)user_rect->GlyphID, user_rect->GlyphOffset.x, user_rect->GlyphOffset.y, user_rect->GlyphOffset.x + user_rect->Width, user_rect->GlyphOffset.y + user_rect->Height, uv0.x, uv0.y, uv1.x, uv1.y, user_rect->GlyphAdvanceX);
+    }
+    for (ImFont* font : Fonts)
+        if (font->DirtyLookupTables)
+            font->BuildLookupTable();
+    return true;
+}
+
 void    ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_brighten_factor)
 {
     for (unsigned int i = 0; i < 256; i++)
@@ -2440,6 +2526,52 @@ static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>*
                     out->push_back((int)(((it - it_begin) << 5) + bit_n));
 }
 
+// Render glyphs of one source font as signed distance fields into their packed rectangles, and fill the stbtt_packedchar
+// data the same way stbtt_PackFontRangesRenderIntoRects() does, so stbtt_GetPackedQuad() can be used unchanged afterward.
+static void ImFontAtlasBuildRenderSdfGlyphs(ImFontAtlas* atlas, ImFontBuildSrcData* src_tmp, const ImFontConfig& cfg)
+{
+    const float scale = (cfg.SizePixels > 0.0f) ? stbtt_ScaleForPixelHeight(&src_tmp->FontInfo, cfg.SizePixels * cfg.RasterizerDensity) : stbtt_ScaleForMappingEmToPixels(&src_tmp->FontInfo, -cfg.SizePixels * cfg.RasterizerDensity);
+    const int padding = atlas->TexGlyphPadding;
+    const int spread = atlas->TexSdfSpread;
+    const unsigned char on_edge_value = 128;
+    const float pixel_dist_scale = 127.0f / (float)spread; // Use the full [0..255] range over [-spread..+spread] pixels
+    for (int glyph_i = 0; glyph_i < src_tmp->GlyphsCount; glyph_i++)
+    {
+        stbrp_rect* r = &src_tmp->Rects[glyph_i];
+        stbtt_packedchar* pc = &src_tmp->PackedChars[glyph_i];
+        if (!r->was_packed)
+            continue;
+        const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp->FontInfo, src_tmp->GlyphsList[glyph_i]);
+        int advance, lsb;
+        stbtt_GetGlyphHMetrics(&src_tmp->FontInfo, glyph_index_in_font, &advance, &lsb);
+
+        int w = 0, h = 0, x_off = 0, y_off = 0;
+        unsigned char* sdf_pixels = stbtt_GetGlyphSDF(&src_tmp->FontInfo, scale, glyph_index_in_font, spread, on_edge_value, pixel_dist_scale, &w, &h, &x_off, &y_off);
+        const int dst_x = r->x + padding;
+        const int dst_y = r->y + padding;
+        if (sdf_pixels != NULL)
+        {
+            IM_ASSERT(w + padding <= r->w && h + padding <= r->h);
+            for (int y = 0; y < h; y++)
+                memcpy(atlas->TexPixelsAlpha8 + (dst_y + y) * atlas->TexWidth + dst_x, sdf_pixels + y * w, (size_t)w);
+            stbtt_FreeSDF(sdf_pixels, src_tmp->FontInfo.userdata);
+        }
+        else
+        {
+            w = h = x_off = y_off = 0; // Empty glyph (e.g. space)
+        }
+        pc->x0 = (unsigned short)dst_x;
+        pc->y0 = (unsigned short)dst_y;
+        pc->x1 = (unsigned short)(dst_x + w);
+        pc->y1 = (unsigned short)(dst_y + h);
+        pc->xadvance = scale * advance;
+        pc->xoff = (float)x_off;
+        pc->yoff = (float)y_off;
+        pc->xoff2 = (float)(x_off + w);
+        pc->yoff2 = (float)(y_off + h);
+    }
+}
+
 static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 {
     IM_ASSERT(atlas->ConfigData.Size > 0);
@@ -2447,7 +2579,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     ImFontAtlasBuildInit(atlas);
 
     // Clear atlas
-    atlas->TexID = (ImTextureID)NULL;
+    atlas->TexID = atlas->TexSdfID = (ImTextureID)NULL;
     atlas->TexWidth = atlas->TexHeight = 0;
     atlas->TexUvScale = ImVec2(0.0f, 0.0f);
     atlas->TexUvWhitePixel = ImVec2(0.0f, 0.0f);
@@ -2551,6 +2683,8 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     memset(buf_packedchars.Data, 0, (size_t)buf_packedchars.size_in_bytes());
 
     // 4. Gather glyphs sizes so we can pack them in our virtual canvas.
+    const bool use_sdf = (atlas->Flags & ImFontAtlasFlags_SignedDistanceField) != 0;
+    IM_ASSERT((!use_sdf || (atlas->TexSdfSpread > 0 && atlas->TexSdfSpread < 128)) && "Invalid TexSdfSpread value!");
     int total_surface = 0;
     int buf_rects_out_n = 0;
     int buf_packedchars_out_n = 0;
@@ -2583,9 +2717,20 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
             int x0, y0, x1, y1;
             const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
             IM_ASSERT(glyph_index_in_font != 0);
-            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
-            src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
-            src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
+            if (use_sdf)
+            {
+                // Distance fields are rendered without oversampling, with TexSdfSpread extra pixels on each side (this matches the box computed by stbtt_GetGlyphSDF)
+                stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale, scale, 0, 0, &x0, &y0, &x1, &y1);
+                const int spread = (x0 != x1 && y0 != y1) ? atlas->TexSdfSpread * 2 : 0;
+                src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + spread + padding);
+                src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + spread + padding);
+            }
+            else
+            {
+                stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
+                src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
+                src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
+            }
             total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
         }
     }
@@ -2622,6 +2767,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
             if (src_tmp.Rects[glyph_i].was_packed)
                 atlas->TexHeight = ImMax(atlas->TexHeight, src_tmp.Rects[glyph_i].y + src_tmp.Rects[glyph_i].h);
     }
+    ImFontAtlasBuildRetainPackContext(atlas, spc.pack_info, spc.nodes);
 
     // 7. Allocate texture
     atlas->TexHeight = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (atlas->TexHeight + 1) : ImUpperPowerOfTwo(atlas->TexHeight);
@@ -2639,10 +2785,13 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         if (src_tmp.GlyphsCount == 0)
             continue;
 
-        stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
+        if (use_sdf)
+            ImFontAtlasBuildRenderSdfGlyphs(atlas, &src_tmp, cfg);
+        else
+            stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
 
-        // Apply multiply operator
-        if (cfg.RasterizerMultiply != 1.0f)
+        // Apply multiply operator (not applicable to distance fields, where alpha encodes a distance rather than a coverage)
+        if (cfg.RasterizerMultiply != 1.0f && !use_sdf)
         {
             unsigned char multiply_table[256];
             ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
@@ -2753,22 +2902,108 @@ void ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opa
     ImVector<stbrp_rect> pack_rects;
     pack_rects.resize(user_rects.Size);
     memset(pack_rects.Data, 0, (size_t)pack_rects.size_in_bytes());
+    const int padding = atlas->TexGlyphPadding; // Same as glyphs and BuildIncremental(): rectangle is placed at (x + padding, y + padding)
     for (int i = 0; i < user_rects.Size; i++)
     {
-        pack_rects[i].w = user_rects[i].Width;
-        pack_rects[i].h = user_rects[i].Height;
+        pack_rects[i].w = user_rects[i].Width + padding;
+        pack_rects[i].h = user_rects[i].Height + padding;
     }
     stbrp_pack_rects(pack_context, &pack_rects[0], pack_rects.Size);
     for (int i = 0; i < pack_rects.Size; i++)
         if (pack_rects[i].was_packed)
         {
-            user_rects[i].X = (unsigned short)pack_rects[i].x;
-            user_rects[i].Y = (unsigned short)pack_rects[i].y;
-            IM_ASSERT(pack_rects[i].w == user_rects[i].Width && pack_rects[i].h == user_rects[i].Height);
+            user_rects[i].X = (unsigned short)(pack_rects[i].x + padding);
+            user_rects[i].Y = (unsigned short)(pack_rects[i].y + padding);
+            IM_ASSERT(pack_rects[i].w == user_rects[i].Width + padding && pack_rects[i].h == user_rects[i].Height + padding);
             atlas->TexHeight = ImMax(atlas->TexHeight, pack_rects[i].y + pack_rects[i].h);
         }
 }
 
+// Keep a copy of the packer state so BuildIncremental() can add rectangles without disturbing existing ones.
+// stbrp nodes are linked by pointers, which we remap into our own storage (including the two 'extra' nodes embedded in the context).
+void ImFontAtlasBuildRetainPackContext(ImFontAtlas* atlas, void* stbrp_context_opaque, void* stbrp_nodes)
+{
+    const stbrp_context* src_ctx = (const stbrp_context*)stbrp_context_opaque;
+    const stbrp_node* src_nodes = (const stbrp_node*)stbrp_nodes;
+    IM_ASSERT(src_ctx != NULL && src_nodes != NULL && atlas->PackContext == NULL);
+
+    ImFontAtlasPackContext* pack = IM_NEW(ImFontAtlasPackContext)();
+    pack->Context = *src_ctx;
+    pack->Nodes.resize(src_ctx->num_nodes);
+    memcpy(pack->Nodes.Data, src_nodes, (size_t)pack->Nodes.size_in_bytes());
+
+    struct Remap
+    {
+        static stbrp_node* Node(stbrp_node* p, const stbrp_context* src_ctx, const stbrp_node* src_nodes, ImFontAtlasPackContext* dst)
+        {
+            if (p == NULL)
+                return NULL;
+            if (p >= &src_ctx->extra[0] && p < &src_ctx->extra[2])
+                return &dst->Context.extra[p - &src_ctx->extra[0]];
+            IM_ASSERT(p >= src_nodes && p < src_nodes + dst->Nodes.Size);
+            return &dst->Nodes.Data[p - src_nodes];
+        }
+    };
+    pack->Context.active_head = Remap::Node(src_ctx->active_head, src_ctx, src_nodes, pack);
+    pack->Context.free_head = Remap::Node(src_ctx->free_head, src_ctx, src_nodes, pack);
+    for (int n = 0; n < 2; n++)
+        pack->Context.extra[n].next = Remap::Node(src_ctx->extra[n].next, src_ctx, src_nodes, pack);
+    for (stbrp_node& node : pack->Nodes)
+        node.next = Remap::Node(node.next, src_ctx, src_nodes, pack);
+    atlas->PackContext = pack;
+}
+
+// Grow texture height, preserving existing pixels. V coordinates of existing glyphs and helpers are recalculated for the new height.
+// All atlas V coordinates are on pixel edges or pixel centers, so we recover the pixel position (rounded to a half pixel) instead of
+// scaling the float value, which would accumulate error when growing by a non power of two factor (ImFontAtlasFlags_NoPowerOfTwoHeight).
+static inline float ImFontAtlasBuildRemapV(float v, int old_height, int new_height)
+{
+    return ImFloor(v * old_height * 2.0f + 0.5f) * 0.5f / new_height;
+}
+
+void ImFontAtlasBuildGrowTexture(ImFontAtlas* atlas, int new_height)
+{
+    const int old_height = atlas->TexHeight;
+    IM_ASSERT(new_height > old_height);
+    const size_t old_pixels_count = (size_t)atlas->TexWidth * old_height;
+    const size_t new_pixels_count = (size_t)atlas->TexWidth * new_height;
+    if (atlas->TexPixelsAlpha8)
+    {
+        unsigned char* new_pixels = (unsigned char*)IM_ALLOC(new_pixels_count);
+        memcpy(new_pixels, atlas->TexPixelsAlpha8, old_pixels_count);
+        memset(new_pixels + old_pixels_count, 0, new_pixels_count - old_pixels_count);
+        IM_FREE(atlas->TexPixelsAlpha8);
+        atlas->TexPixelsAlpha8 = new_pixels;
+    }
+    if (atlas->TexPixelsRGBA32)
+    {
+        unsigned int* new_pixels = (unsigned int*)IM_ALLOC(new_pixels_count * 4);
+        memcpy(new_pixels, atlas->TexPixelsRGBA32, old_pixels_count * 4);
+        memset(new_pixels + old_pixels_count, 0, (new_pixels_count - old_pixels_count) * 4);
+        IM_FREE(atlas->TexPixelsRGBA32);
+        atlas->TexPixelsRGBA32 = new_pixels;
+    }
+    atlas->TexHeight = new_height;
+    atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
+
+    for (ImFont* font : atlas->Fonts)
+        for (ImFontGlyph& glyph : font->Glyphs)
+        {
+            glyph.V0 = ImFontAtlasBuildRemapV(glyph.V0, old_height, new_height);
+            glyph.V1 = ImFontAtlasBuildRemapV(glyph.V1, old_height, new_height);
+        }
+    atlas->TexUvWhitePixel.y = ImFontAtlasBuildRemapV(atlas->TexUvWhitePixel.y, old_height, new_height);
+    for (ImVec4& uv_lines : atlas->TexUvLines)
+    {
+        uv_lines.y = ImFontAtlasBuildRemapV(uv_lines.y, old_height, new_height);
+        uv_lines.w = ImFontAtlasBuildRemapV(uv_lines.w, old_height, new_height);
+    }
+
+    // Whole texture needs to be uploaded again
+    atlas->TexDirtyRects.resize(0);
+    atlas->TexDirtyRects.push_back(ImVec4(0.0f, 0.0f, (float)atlas->TexWidth, (float)atlas->TexHeight));
+}
+
 void ImFontAtlasBuildRender8bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned char in_marker_pixel_value)
 {
     IM_ASSERT(x >= 0 && x + w <= atlas->TexWidth);
@@ -2831,7 +3066,7 @@ static void ImFontAtlasBuildRenderDefaultTexData(ImFontAtlas* atlas)
 
 static void ImFontAtlasBuildRenderLinesTexData(ImFontAtlas* atlas)
 {
-    if (atlas->Flags & ImFontAtlasFlags_NoBakedLines)
+    if (atlas->Flags & (ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_SignedDistanceField))
         return;
 
     // This generates a triangular shape in the texture, with the various line widths stacked on top of each other to allow interpolation between them
@@ -2903,7 +3138,7 @@ void ImFontAtlasBuildInit(ImFontAtlas* atlas)
     // The +2 here is to give space for the end caps, whilst height +1 is to accommodate the fact we have a zero-width row
     if (atlas->PackIdLines < 0)
     {
-        if (!(atlas->Flags & ImFontAtlasFlags_NoBakedLines))
+        if (!(atlas->Flags & (ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_SignedDistanceField)))
             atlas->PackIdLines = atlas->AddCustomRectRegular(IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 2, IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1);
     }
 }
@@ -3274,6 +3509,7 @@ void    ImFont::ClearOutputData()
     FontSize = 0.0f;
     FallbackAdvanceX = 0.0f;
     Glyphs.clear();
+    IndexPages.clear();
     IndexAdvanceX.clear();
     IndexLookup.clear();
     FallbackGlyph = NULL;
@@ -3283,6 +3519,23 @@ void    ImFont::ClearOutputData()
     MetricsTotalSurface = 0;
 }
 
+// Return offset of codepoint 'c' within IndexAdvanceX[]/IndexLookup[], allocating its page if needed.
+// New pages are initialized as unused (-1). GrowIndex() must have been called to cover 'c'.
+static int ImFontIndexGetOffsetAlloc(ImFont* font, ImWchar c)
+{
+    const int page_n = (int)(c >> IM_FONT_INDEX_PAGE_SHIFT);
+    IM_ASSERT(page_n < font->IndexPages.Size);
+    if (font->IndexPages[page_n] == 0)
+    {
+        const int slot_n = font->IndexLookup.Size >> IM_FONT_INDEX_PAGE_SHIFT;
+        IM_ASSERT(slot_n > 0 && slot_n <= 0xFFFF);
+        font->IndexAdvanceX.resize(font->IndexAdvanceX.Size + IM_FONT_INDEX_PAGE_SIZE, -1.0f);
+        font->IndexLookup.resize(font->IndexLookup.Size + IM_FONT_INDEX_PAGE_SIZE, (ImWchar)-1);
+        font->IndexPages[page_n] = (ImU16)slot_n;
+    }
+    return ((int)font->IndexPages[page_n] << IM_FONT_INDEX_PAGE_SHIFT) | (c & (IM_FONT_INDEX_PAGE_SIZE - 1));
+}
+
 static ImWchar FindFirstExistingGlyph(ImFont* font, const ImWchar* candidate_chars, int candidate_chars_count)
 {
     for (int n = 0; n < candidate_chars_count; n++)
@@ -3300,6 +3553,7 @@ void ImFont::BuildLookupTable()
     // Build lookup table
     IM_ASSERT(Glyphs.Size > 0 && "Font has not loaded glyph!");
     IM_ASSERT(Glyphs.Size < 0xFFFF); // -1 is reserved
+    IndexPages.clear();
     IndexAdvanceX.clear();
     IndexLookup.clear();
     DirtyLookupTables = false;
@@ -3308,8 +3562,9 @@ void ImFont::BuildLookupTable()
     for (int i = 0; i < Glyphs.Size; i++)
     {
         int codepoint = (int)Glyphs[i].Codepoint;
-        IndexAdvanceX[codepoint] = Glyphs[i].AdvanceX;
-        IndexLookup[codepoint] = (ImWchar)i;
+        const int index_offset = ImFontIndexGetOffsetAlloc(this, (ImWchar)codepoint);
+        IndexAdvanceX[index_offset] = Glyphs[i].AdvanceX;
+        IndexLookup[index_offset] = (ImWchar)i;
 
         // Mark 4K page as used
         const int page_n = codepoint / 4096;
@@ -3326,8 +3581,9 @@ void ImFont::BuildLookupTable()
         tab_glyph = *FindGlyph((ImWchar)' ');
         tab_glyph.Codepoint = '\t';
         tab_glyph.AdvanceX *= IM_TABSIZE;
-        IndexAdvanceX[(int)tab_glyph.Codepoint] = (float)tab_glyph.AdvanceX;
-        IndexLookup[(int)tab_glyph.Codepoint] = (ImWchar)(Glyphs.Size - 1);
+        const int index_offset = ImFontIndexGetOffsetAlloc(this, (ImWchar)tab_glyph.Codepoint);
+        IndexAdvanceX[index_offset] = (float)tab_glyph.AdvanceX;
+        IndexLookup[index_offset] = (ImWchar)(Glyphs.Size - 1);
     }
 
     // Mark special glyphs as not visible (note that AddGlyph already mark as non-visible glyphs with zero-size polygons)
@@ -3348,7 +3604,7 @@ void ImFont::BuildLookupTable()
         }
     }
     FallbackAdvanceX = FallbackGlyph->AdvanceX;
-    for (int i = 0; i < max_codepoint + 1; i++)
+    for (int i = 0; i < IndexAdvanceX.Size; i++)
         if (IndexAdvanceX[i] < 0.0f)
             IndexAdvanceX[i] = FallbackAdvanceX;
 
@@ -3397,10 +3653,16 @@ void ImFont::SetGlyphVisible(ImWchar c, bool visible)
 void ImFont::GrowIndex(int new_size)
 {
     IM_ASSERT(IndexAdvanceX.Size == IndexLookup.Size);
-    if (new_size <= IndexLookup.Size)
+    if (IndexLookup.Size == 0)
+    {
+        // Allocate slot 0 (shared by all unused pages)
+        IndexAdvanceX.resize(IM_FONT_INDEX_PAGE_SIZE, -1.0f);
+        IndexLookup.resize(IM_FONT_INDEX_PAGE_SIZE, (ImWchar)-1);
+    }
+    const int new_pages_count = (new_size + IM_FONT_INDEX_PAGE_SIZE - 1) >> IM_FONT_INDEX_PAGE_SHIFT;
+    if (new_pages_count <= IndexPages.Size)
         return;
-    IndexAdvanceX.resize(new_size, -1.0f);
-    IndexLookup.resize(new_size, (ImWchar)-1);
+    IndexPages.resize(new_pages_count, 0);
 }
 
 // x0/y0/x1/y1 are offset from the character upper-left layout position, in pixels. Therefore x0/y0 are often fairly close to zero.
@@ -3453,23 +3715,30 @@ void ImFont::AddGlyph(const ImFontConfig* cfg, ImWchar codepoint, float x0, floa
 void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
 {
     IM_ASSERT(IndexLookup.Size > 0);    // Currently this can only be called AFTER the font has been built, aka after calling ImFontAtlas::GetTexDataAs*() function.
-    unsigned int index_size = (unsigned int)IndexLookup.Size;
+    const unsigned int pages_count = (unsigned int)IndexPages.Size;
+    const bool dst_in_index = (unsigned int)(dst >> IM_FONT_INDEX_PAGE_SHIFT) < pages_count;
+    const bool src_in_index = (unsigned int)(src >> IM_FONT_INDEX_PAGE_SHIFT) < pages_count;
 
-    if (dst < index_size && IndexLookup.Data[dst] == (ImWchar)-1 && !overwrite_dst) // 'dst' already exists
+    if (dst_in_index && FindGlyphNoFallback(dst) == NULL && !overwrite_dst) // 'dst' already exists
         return;
-    if (src >= index_size && dst >= index_size) // both 'dst' and 'src' don't exist -> no-op
+    if (!src_in_index && !dst_in_index) // both 'dst' and 'src' don't exist -> no-op
         return;
 
+    const int src_offset = src_in_index ? (((int)IndexPages.Data[src >> IM_FONT_INDEX_PAGE_SHIFT] << IM_FONT_INDEX_PAGE_SHIFT) | (src & (IM_FONT_INDEX_PAGE_SIZE - 1))) : -1;
+    const ImWchar src_lookup = src_in_index ? IndexLookup.Data[src_offset] : (ImWchar)-1;
+    const float src_advance_x = src_in_index ? IndexAdvanceX.Data[src_offset] : 1.0f;
     GrowIndex(dst + 1);
-    IndexLookup[dst] = (src < index_size) ? IndexLookup.Data[src] : (ImWchar)-1;
-    IndexAdvanceX[dst] = (src < index_size) ? IndexAdvanceX.Data[src] : 1.0f;
+    const int dst_offset = ImFontIndexGetOffsetAlloc(this, dst);
+    IndexLookup[dst_offset] = src_lookup;
+    IndexAdvanceX[dst_offset] = src_advance_x;
 }
 
 const ImFontGlyph* ImFont::FindGlyph(ImWchar c) const
 {
-    if (c >= (size_t)IndexLookup.Size)
+    const unsigned int page_n = (unsigned int)c >> IM_FONT_INDEX_PAGE_SHIFT;
+    if (page_n >= (unsigned int)IndexPages.Size)
         return FallbackGlyph;
-    const ImWchar i = IndexLookup.Data[c];
+    const ImWchar i = IndexLookup.Data[((unsigned int)IndexPages.Data[page_n] << IM_FONT_INDEX_PAGE_SHIFT) | (c & (IM_FONT_INDEX_PAGE_SIZE - 1))];
     if (i == (ImWchar)-1)
         return FallbackGlyph;
     return &Glyphs.Data[i];
@@ -3477,9 +3746,10 @@ const ImFontGlyph* ImFont::FindGlyph(ImWchar c) const
 
 const ImFontGlyph* ImFont::FindGlyphNoFallback(ImWchar c) const
 {
-    if (c >= (size_t)IndexLookup.Size)
+    const unsigned int page_n = (unsigned int)c >> IM_FONT_INDEX_PAGE_SHIFT;
+    if (page_n >= (unsigned int)IndexPages.Size)
         return NULL;
-    const ImWchar i = IndexLookup.Data[c];
+    const ImWchar i = IndexLookup.Data[((unsigned int)IndexPages.Data[page_n] << IM_FONT_INDEX_PAGE_SHIFT) | (c & (IM_FONT_INDEX_PAGE_SIZE - 1))];
     if (i == (ImWchar)-1)
         return NULL;
     return &Glyphs.Data[i];
@@ -3498,7 +3768,9 @@ static inline const char* CalcWordWrapNextLineStartA(const char* text, const cha
 // Simple word-wrapping for English, not full-featured. Please submit failing cases!
 // This will return the next location to wrap from. If no wrapping if necessary, this will fast-forward to e.g. text_end.
 // FIXME: Much possible improvements (don't cut things like "word !", "word!!!" but cut within "word,,,,", more sensible support for punctuations, support for Unicode punctuations, etc.)
-const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const char* text_end, float wrap_width) const
+// - Optionally report the unscaled widths which the wrapping decision depended on (see ImGuiTextWrapLine).
+//   This allows word-wrap layouts to tell whether a line would wrap at the same location for another wrap width, without scanning it again.
+static inline const char* ImFontCalcWordWrapPositionEx(const ImFont* font, float scale, const char* text, const char* text_end, float wrap_width, ImGuiTextWrapLine* out_line)
 {
     // For references, possible wrap point marked with ^
     //  "aaa bbb, ccc,ddd. eee   fff. ggg!"
@@ -3519,6 +3791,10 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
     const char* word_end = text;
     const char* prev_word_end = NULL;
     bool inside_word = true;
+    float fit_width = 0.0f;
+
+    // Scaled widths accumulated in same order as CalcTextSizeA() so reported line width is identical
+    float advance = 0.0f, word_end_advance = 0.0f, prev_word_end_advance = 0.0f;
 
     const char* s = text;
     IM_ASSERT(text_end != NULL);
@@ -3536,6 +3812,7 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
             if (c == '\n')
             {
                 line_width = word_width = blank_width = 0.0f;
+                advance = 0.0f;
                 inside_word = true;
                 s = next_s;
                 continue;
@@ -3547,7 +3824,9 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
             }
         }
 
-        const float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX);
+        const float char_width = font->GetCharAdvance((ImWchar)c);
+        const float prev_advance = advance;
+        advance += char_width * scale;
         if (ImCharIsBlankW(c))
         {
             if (inside_word)
@@ -3555,6 +3834,7 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
                 line_width += blank_width;
                 blank_width = 0.0f;
                 word_end = s;
+                word_end_advance = prev_advance;
             }
             blank_width += char_width;
             inside_word = false;
@@ -3565,10 +3845,12 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
             if (inside_word)
             {
                 word_end = next_s;
+                word_end_advance = advance;
             }
             else
             {
                 prev_word_end = word_end;
+                prev_word_end_advance = word_end_advance;
                 line_width += word_width + blank_width;
                 word_width = blank_width = 0.0f;
             }
@@ -3580,22 +3862,49 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
         // We ignore blank width at the end of the line (they can be skipped)
         if (line_width + word_width > wrap_width)
         {
+            if (out_line)
+            {
+                out_line->BreakWidth = line_width + word_width;
+                out_line->BreakWordWidth = word_width;
+            }
+
             // Words that cannot possibly fit within an entire line will be cut anywhere.
+            advance = prev_advance;
             if (word_width < wrap_width)
+            {
                 s = prev_word_end ? prev_word_end : word_end;
+                advance = prev_word_end ? prev_word_end_advance : word_end_advance;
+            }
             break;
         }
+        fit_width = ImMax(fit_width, line_width + word_width);
 
         s = next_s;
     }
+    if (out_line)
+    {
+        out_line->Width = advance;
+        out_line->FitWidth = fit_width;
+        if (s == text_end)
+            out_line->BreakWidth = out_line->BreakWordWidth = FLT_MAX;
+    }
 
     // Wrap_width is too small to fit anything. Force displaying 1 character to minimize the height discontinuity.
     // +1 may not be a character start point in UTF-8 but it's ok because caller loops use (text >= word_wrap_eol).
     if (s == text && text < text_end)
+    {
+        if (out_line)
+            out_line->Width = out_line->FitWidth = FLT_MAX; // Never reuse, let caller measure
         return s + 1;
+    }
     return s;
 }
 
+const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const char* text_end, float wrap_width) const
+{
+    return ImFontCalcWordWrapPositionEx(this, scale, text, text_end, wrap_width, NULL);
+}
+
 ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining) const
 {
     if (!text_end)
@@ -3652,7 +3961,7 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
                 continue;
         }
 
-        const float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX) * scale;
+        const float char_width = GetCharAdvance((ImWchar)c) * scale;
         if (line_width + char_width >= max_width)
         {
             s = prev_s;
@@ -3674,6 +3983,32 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
     return text_size;
 }
 
+// Word-wrap a single paragraph (no '\n' within [paragraph_begin, paragraph_end)) and append its lines, with offsets relative to 'text'.
+// This follows the same logic as the word-wrapping paths of CalcTextSizeA() and RenderText(), which treat each paragraph independently.
+void ImFontCalcWrapLines(const ImFont* font, float size, float wrap_width, const char* text, const char* paragraph_begin, const char* paragraph_end, ImVector<ImGuiTextWrapLine>* out_lines)
+{
+    const float scale = size / font->FontSize;
+    const char* s = paragraph_begin;
+    do
+    {
+        ImGuiTextWrapLine line;
+        const char* line_end = ImFontCalcWordWrapPositionEx(font, scale, s, paragraph_end, wrap_width, &line);
+        while (line_end < paragraph_end && (*line_end & 0xC0) == 0x80) // Forced wrap may land within a UTF-8 sequence
+            line_end++;
+        line.Begin = (int)(s - text);
+        line.End = (int)(line_end - text);
+        if (line.Width == FLT_MAX)
+            line.Width = font->CalcTextSizeA(size, FLT_MAX, 0.0f, s, line_end).x;
+        out_lines->push_back(line);
+
+        // Wrapping skips upcoming blanks
+        s = line_end;
+        while (s < paragraph_end && ImCharIsBlankA(*s))
+            s++;
+    }
+    while (s < paragraph_end);
+}
+
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, ImWchar c) const
 {
@@ -59,6 +59,13 @@ Index of this file:
 #include <immintrin.h>
 #endif
 
+// Enable ARMv8 CRC32 instructions if available (used by ImHashData/ImHashStr, same output as the table based code)
+// (x86 SSE 4.2 crc32 instruction uses a different polynomial (CRC-32C) and would change every ID, so it is not used)
+#if defined(__ARM_FEATURE_CRC32) && !defined(IMGUI_DISABLE_ARM_CRC32)
+#define IMGUI_ENABLE_ARM_CRC32
+#include <arm_acle.h>
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (push)
@@ -125,9 +132,11 @@ struct ImGuiContextHook;            // Hook for extensions like ImGuiTestEngine
 struct ImGuiDataVarInfo;            // Variable information (e.g. to avoid style variables from an enum)
 struct ImGuiDataTypeInfo;           // Type information associated to a ImGuiDataType enum
 struct ImGuiGroupData;              // Stacked storage data for BeginGroup()/EndGroup()
+struct ImGuiInputEventRing;         // Lock-free queue of input events submitted from other threads (only defined in imgui.cpp)
 struct ImGuiInputTextState;         // Internal state of the currently focused/edited text input box
 struct ImGuiInputTextDeactivateData;// Short term storage to backup text of a deactivating InputText() while another is stealing active id
 struct ImGuiLastItemData;           // Status storage for last submitted items
+struct ImGuiLiteralIDSeedShift;     // Cached CRC32 seed shift used to combine a ImGuiLiteralID with the ID stack
 struct ImGuiLocEntry;               // A localization entry.
 struct ImGuiMenuColumns;            // Simple column measurement, currently used for MenuItem() only
 struct ImGuiNavItemData;            // Result of a gamepad/keyboard directional navigation move query result
@@ -138,7 +147,9 @@ struct ImGuiNextItemData;           // Storage for SetNextItem** functions
 struct ImGuiOldColumnData;          // Storage data for a single column for legacy Columns() api
 struct ImGuiOldColumns;             // Storage data for a columns set for legacy Columns() api
 struct ImGuiPopupData;              // Storage for current popup stack
+struct ImGuiProfiler;               // Storage for the frame profiler (see IMGUI_ENABLE_PROFILER)
 struct ImGuiSettingsHandler;        // Storage for one type registered in the .ini file
+struct ImGuiSettingsWriter;         // Writer thread for io.ConfigIniSavingAsync (only defined in imgui.cpp)
 struct ImGuiStackSizes;             // Storage of stack sizes for debugging/asserting
 struct ImGuiStyleMod;               // Stacked style modifier, backup of modified data so we can restore it
 struct ImGuiTabBar;                 // Storage for a tab bar
@@ -149,6 +160,7 @@ struct ImGuiTableInstanceData;      // Storage for one instance of a same table
 struct ImGuiTableTempData;          // Temporary storage for one table (one per table in the stack), shared between tables.
 struct ImGuiTableSettings;          // Storage for a table .ini settings
 struct ImGuiTableColumnsSettings;   // Storage for a column .ini settings
+struct ImGuiTextWrapLayout;         // Cached word-wrapping layout for a block of text
 struct ImGuiTypingSelectState;      // Storage for GetTypingSelectRequest()
 struct ImGuiTypingSelectRequest;    // Storage for GetTypingSelectRequest() (aimed to be public)
 struct ImGuiWindow;                 // Storage for one window
@@ -235,6 +247,23 @@ namespace ImStb
 #define IMGUI_DEBUG_LOG_CLIPPER(...)    do { if (g.DebugLogFlags & ImGuiDebugLogFlags_EventClipper)     IMGUI_DEBUG_LOG(__VA_ARGS__); } while (0)
 #define IMGUI_DEBUG_LOG_IO(...)         do { if (g.DebugLogFlags & ImGuiDebugLogFlags_EventIO)          IMGUI_DEBUG_LOG(__VA_ARGS__); } while (0)
 
+// Profiler timing zones for Metrics->Profiler. Zone is closed at the end of the enclosing C++ scope.
+// Use IMGUI_PROFILER_ZONE_BEGIN()/IMGUI_PROFILER_ZONE_END() to time a section of a function without adding a scope.
+// Name must be a literal/persistent string, argument is copied (e.g. window name). Zones cannot span a NewFrame() call.
+#ifdef IMGUI_ENABLE_PROFILER
+#define IMGUI_PROFILER_CONCAT_(_A, _B)              _A##_B
+#define IMGUI_PROFILER_CONCAT(_A, _B)               IMGUI_PROFILER_CONCAT_(_A, _B)
+#define IMGUI_PROFILER_ZONE(_CTX, _NAME)            ImGuiProfilerScope IMGUI_PROFILER_CONCAT(profiler_zone_, __LINE__)(_CTX, _NAME)
+#define IMGUI_PROFILER_ZONE_ARG(_CTX, _NAME, _ARG)  ImGuiProfilerScope IMGUI_PROFILER_CONCAT(profiler_zone_, __LINE__)(_CTX, _NAME, _ARG)
+#define IMGUI_PROFILER_ZONE_BEGIN(_CTX, _NAME)      ImGui::ProfilerZoneBegin(_CTX, _NAME)
+#define IMGUI_PROFILER_ZONE_END(_CTX)               ImGui::ProfilerZoneEnd(_CTX)
+#else
+#define IMGUI_PROFILER_ZONE(_CTX, _NAME)            ((void)0)
+#define IMGUI_PROFILER_ZONE_ARG(_CTX, _NAME, _ARG)  ((void)0)
+#define IMGUI_PROFILER_ZONE_BEGIN(_CTX, _NAME)      ((void)0)
+#define IMGUI_PROFILER_ZONE_END(_CTX)               ((void)0)
+#endif
+
 // Static Asserts
 #define IM_STATIC_ASSERT(_COND)         static_assert(_COND, "")
 
@@ -341,7 +370,6 @@ namespace ImStb
 // - Helper: ImSpan<>, ImSpanAllocator<>
 // - Helper: ImPool<>
 // - Helper: ImChunkStream<>
-// - Helper: ImGuiTextIndex
 //-----------------------------------------------------------------------------
 
 // Helpers: Hashing
@@ -411,6 +439,7 @@ static inline bool          ImFileClose(ImFileHandle)
 static inline ImU64         ImFileGetSize(ImFileHandle)                             { return (ImU64)-1; }
 static inline ImU64         ImFileRead(void*, ImU64, ImU64, ImFileHandle)           { return 0; }
 static inline ImU64         ImFileWrite(const void*, ImU64, ImU64, ImFileHandle)    { return 0; }
+static inline bool          ImFileRename(const char*, const char*)                  { return false; }
 #endif
 #ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
 typedef FILE* ImFileHandle;
@@ -419,10 +448,13 @@ IMGUI_API bool              ImFileClose(ImFileHandle file);
 IMGUI_API ImU64             ImFileGetSize(ImFileHandle file);
 IMGUI_API ImU64             ImFileRead(void* data, ImU64 size, ImU64 count, ImFileHandle file);
 IMGUI_API ImU64             ImFileWrite(const void* data, ImU64 size, ImU64 count, ImFileHandle file);
+IMGUI_API bool              ImFileRename(const char* old_filename, const char* new_filename);  // Replace new_filename if it exists, atomically where supported
 #else
 #define IMGUI_DISABLE_TTY_FUNCTIONS // Can't use stdout, fflush if we are not using default file functions
 #endif
 IMGUI_API void*             ImFileLoadToMemory(ImGuiContext* ctx, const char* filename, const char* mode, size_t* out_file_size = NULL, int padding_bytes = 0);
+IMGUI_API void*             ImFileMapToMemory(ImGuiContext* ctx, const char* filename, size_t* out_file_size);  // Read-only. Memory mapped where supported, otherwise loaded with ImFileLoadToMemory(). Release with ImFileUnmapFromMemory().
+IMGUI_API void              ImFileUnmapFromMemory(void* data, size_t data_size);
 
 // Helpers: Maths
 IM_MSVC_RUNTIME_CHECKS_OFF
@@ -661,33 +693,57 @@ struct ImSpanAllocator
 // Helper: ImPool<>
 // Basic keyed storage for contiguous instances, slow/amortized insertion, O(1) indexable, O(Log N) queries by ID over a dense/hot buffer,
 // Honor constructor/destructor. Add/remove invalidate all pointers. Indexes have the same lifetime as the associated object.
+// - Handles (ImPoolHandle) store an index + generation, so using a handle to a removed object can be detected (TryGetByHandle() returns NULL).
+// - A dense list of alive indices is maintained (swap-remove in O(1)) so iterating alive items doesn't need to walk the map:
+//     for (int n = 0; n < pool.GetAliveCount(); n++) { T* t = pool.GetAliveByPos(n); ... }
+//   Iterate backward if you are removing items while iterating: the last alive item is moved into the removed position.
 typedef int ImPoolIdx;
+struct ImPoolHandle
+{
+    ImPoolIdx       Index;
+    ImU32           Generation;
+    ImPoolHandle()  { Index = -1; Generation = 0; }
+    bool operator==(const ImPoolHandle& rhs) const { return Index == rhs.Index && Generation == rhs.Generation; }
+    bool operator!=(const ImPoolHandle& rhs) const { return Index != rhs.Index || Generation != rhs.Generation; }
+};
+
 template<typename T>
 struct ImPool
 {
-    ImVector<T>     Buf;        // Contiguous data
-    ImGuiStorage    Map;        // ID->Index
-    ImPoolIdx       FreeIdx;    // Next free idx to use
-    ImPoolIdx       AliveCount; // Number of active/alive items (for display purpose)
+    ImVector<T>         Buf;        // Contiguous data
+    ImGuiStorage        Map;        // ID->Index
+    ImPoolIdx           FreeIdx;    // Next free idx to use
+    ImVector<ImPoolIdx> AliveIdx;   // Indices of alive items, unordered
+    ImVector<int>       AlivePos;   // [Buf.Size] Position of item in AliveIdx[], -1 if not alive
+    ImVector<ImU32>     Generations;// [>= Buf.Size] Incremented when an item is removed. Kept (and incremented) by Clear() so old handles stay invalid.
 
-    ImPool()    { FreeIdx = AliveCount = 0; }
+    ImPool()    { FreeIdx = 0; }
     ~ImPool()   { Clear(); }
     T*          GetByKey(ImGuiID key)               { int idx = Map.GetInt(key, -1); return (idx != -1) ? &Buf[idx] : NULL; }
     T*          GetByIndex(ImPoolIdx n)             { return &Buf[n]; }
     ImPoolIdx   GetIndex(const T* p) const          { IM_ASSERT(p >= Buf.Data && p < Buf.Data + Buf.Size); return (ImPoolIdx)(p - Buf.Data); }
     T*          GetOrAddByKey(ImGuiID key)          { int* p_idx = Map.GetIntRef(key, -1); if (*p_idx != -1) return &Buf[*p_idx]; *p_idx = FreeIdx; return Add(); }
     bool        Contains(const T* p) const          { return (p >= Buf.Data && p < Buf.Data + Buf.Size); }
-    void        Clear()                             { for (int n = 0; n < Map.Data.Size; n++) { int idx = Map.Data[n].val_i; if (idx != -1) Buf[idx].~T(); } Map.Clear(); Buf.clear(); FreeIdx = AliveCount = 0; }
-    T*          Add()                               { int idx = FreeIdx; if (idx == Buf.Size) { Buf.resize(Buf.Size + 1); FreeIdx++; } else { FreeIdx = *(int*)&Buf[idx]; } IM_PLACEMENT_NEW(&Buf[idx]) T(); AliveCount++; return &Buf[idx]; }
+    void        Clear()                             { for (ImPoolIdx idx : AliveIdx) Buf[idx].~T(); Map.Clear(); Buf.clear(); AliveIdx.clear(); AlivePos.clear(); for (ImU32& gen : Generations) gen++; FreeIdx = 0; }
+    T*          Add()                               { int idx = FreeIdx; if (idx == Buf.Size) { Buf.resize(Buf.Size + 1); AlivePos.push_back(-1); if (Generations.Size < Buf.Size) Generations.push_back(0); FreeIdx++; } else { FreeIdx = *(int*)&Buf[idx]; } IM_PLACEMENT_NEW(&Buf[idx]) T(); AlivePos[idx] = AliveIdx.Size; AliveIdx.push_back(idx); return &Buf[idx]; }
     void        Remove(ImGuiID key, const T* p)     { Remove(key, GetIndex(p)); }
-    void        Remove(ImGuiID key, ImPoolIdx idx)  { Buf[idx].~T(); *(int*)&Buf[idx] = FreeIdx; FreeIdx = idx; Map.SetInt(key, -1); AliveCount--; }
-    void        Reserve(int capacity)               { Buf.reserve(capacity); Map.Data.reserve(capacity); }
+    void        Remove(ImGuiID key, ImPoolIdx idx)  { Buf[idx].~T(); *(int*)&Buf[idx] = FreeIdx; FreeIdx = idx; Map.SetInt(key, -1); RemoveAlive(idx); Generations[idx]++; }
+    void        Reserve(int capacity)               { Buf.reserve(capacity); Map.Data.reserve(capacity); AliveIdx.reserve(capacity); AlivePos.reserve(capacity); Generations.reserve(capacity); }
+    void        RemoveAlive(ImPoolIdx idx)          { int pos = AlivePos[idx]; IM_ASSERT(pos != -1); ImPoolIdx last_idx = AliveIdx.back(); AliveIdx[pos] = last_idx; AlivePos[last_idx] = pos; AliveIdx.pop_back(); AlivePos[idx] = -1; } // Swap-remove from alive list
+
+    // Generational handles: stay valid until the item is removed, and can be tested for staleness
+    ImPoolHandle GetHandle(const T* p) const        { ImPoolHandle h; h.Index = GetIndex(p); h.Generation = Generations[h.Index]; return h; }
+    T*          TryGetByHandle(ImPoolHandle h)      { if (h.Index < 0 || h.Index >= Buf.Size || Generations[h.Index] != h.Generation || AlivePos[h.Index] == -1) return NULL; return &Buf[h.Index]; }
 
-    // To iterate a ImPool: for (int n = 0; n < pool.GetMapSize(); n++) if (T* t = pool.TryGetMapData(n)) { ... }
-    // Can be avoided if you know .Remove() has never been called on the pool, or AliveCount == GetMapSize()
-    int         GetAliveCount() const               { return AliveCount; }      // Number of active/alive items in the pool (for display purpose)
+    // Dense iteration over alive items
+    int         GetAliveCount() const               { return AliveIdx.Size; }   // Number of active/alive items in the pool
+    T*          GetAliveByPos(int n)                { return &Buf[AliveIdx[n]]; }
+    ImPoolIdx   GetAliveIndexByPos(int n) const     { return AliveIdx[n]; }
+
+    // To iterate a ImPool via its map: for (int n = 0; n < pool.GetMapSize(); n++) if (T* t = pool.TryGetMapData(n)) { ... }
+    // Prefer iterating with GetAliveCount()/GetAliveByPos() which doesn't need to skip removed items.
     int         GetBufSize() const                  { return Buf.Size; }
-    int         GetMapSize() const                  { return Map.Data.Size; }   // It is the map we need iterate to find valid items, since we don't have "alive" storage anywhere
+    int         GetMapSize() const                  { return Map.Data.Size; }   // Map also contains removed items (idx == -1)
     T*          TryGetMapData(ImPoolIdx n)          { int idx = Map.Data[n].val_i; if (idx == -1) return NULL; return GetByIndex(idx); }
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     int         GetSize()                           { return GetMapSize(); } // For ImPlot: should use GetMapSize() from (IMGUI_VERSION_NUM >= 18304)
@@ -717,20 +773,6 @@ struct ImChunkStream
     void    swap(ImChunkStream<T>& rhs) { rhs.Buf.swap(Buf); }
 };
 
-// Helper: ImGuiTextIndex<>
-// Maintain a line index for a text buffer. This is a strong candidate to be moved into the public API.
-struct ImGuiTextIndex
-{
-    ImVector<int>   LineOffsets;
-    int             EndOffset = 0;                          // Because we don't own text buffer we need to maintain EndOffset (may bake in LineOffsets?)
-
-    void            clear()                                 { LineOffsets.clear(); EndOffset = 0; }
-    int             size()                                  { return LineOffsets.Size; }
-    const char*     get_line_begin(const char* base, int n) { return base + LineOffsets[n]; }
-    const char*     get_line_end(const char* base, int n)   { return base + (n + 1 < LineOffsets.Size ? (LineOffsets[n + 1] - 1) : EndOffset); }
-    void            append(const char* base, int old_size, int new_size);
-};
-
 //-----------------------------------------------------------------------------
 // [SECTION] ImDrawList support
 //-----------------------------------------------------------------------------
@@ -1022,6 +1064,43 @@ enum ImGuiDataTypePrivate_
     ImGuiDataType_ID,
 };
 
+// Line of a word-wrapped text layout. Offsets are relative to start of text.
+struct ImGuiTextWrapLine
+{
+    int         Begin;              // Offset of first character (after skipping blanks following a wrap point)
+    int         End;                // Offset past last character (excluding '\n')
+    float       Width;              // Width of line in pixels (at the font size used for the layout)
+    float       FitWidth;           // Unscaled width tested by the wrapping logic right before the break. The line would wrap earlier for a smaller wrap width.
+    float       BreakWidth;         // Unscaled width which triggered the break (FLT_MAX if none). The line would wrap later for a wrap width >= this.
+    float       BreakWordWidth;     // Unscaled width of word being cut at the break (decides cutting at word boundary or anywhere)
+};
+
+// Cached word-wrapping layout for a block of text (line break offsets and widths)
+// - Computed once per (text, font, font size, window) then reused across frames for both measuring and rendering.
+// - When only the wrap width changes, lines whose wrapping decision is unaffected by the new width are kept, others are wrapped again.
+struct ImGuiTextWrapLayout
+{
+    ImGuiID     ID;                 // Hash of caller-provided text ID (or order of submission in window), font, font size and window
+    ImGuiID     TextHash;           // Hash of text contents to detect changes, 0 when identified by a caller-provided text ID
+    int         LastFrameUsed;
+    int         TextLen;
+    float       WrapWidth;
+    ImVec2      Size;               // Same value as CalcTextSize(text, ..., wrap_width)
+    ImVector<ImGuiTextWrapLine> Lines;
+
+    ImGuiTextWrapLayout()           { ID = TextHash = 0; LastFrameUsed = -1; TextLen = 0; WrapWidth = 0.0f; }
+};
+
+// Cached CRC32 register (~Seed) advanced by Len zero bytes (see GetIDWithSeed())
+struct ImGuiLiteralIDSeedShift
+{
+    ImGuiID     Seed;
+    int         Len;                // -1 when unused
+    ImU32       Shift;
+
+    ImGuiLiteralIDSeedShift()       { Seed = 0; Len = -1; Shift = 0; }
+};
+
 // Stacked color modifier, backup of modified data so we can restore it
 struct ImGuiColorMod
 {
@@ -1097,6 +1176,14 @@ struct IMGUI_API ImGuiInputTextDeactivatedState
     ImGuiInputTextDeactivatedState()    { memset(this, 0, sizeof(*this)); }
     void    ClearFreeMemory()           { ID = 0; TextA.clear(); }
 };
+
+// Line of a multi-line InputText(), stored in ImGuiInputTextState::Lines[] to render and measure only the visible lines.
+struct ImGuiInputTextLine
+{
+    int                     StartW;                 // Offset of first character in TextW[]
+    int                     StartA;                 // Offset of first character in UTF-8 text (TextA[] or user buffer)
+};
+
 // Internal state of the currently focused/edited text input box
 // For a given item ID, access with ImGui::GetInputTextState()
 struct IMGUI_API ImGuiInputTextState
@@ -1116,10 +1203,12 @@ struct IMGUI_API ImGuiInputTextState
     bool                    SelectedAllMouseLock;   // after a double-click to select all, we ignore further mouse drags to update selection
     bool                    Edited;                 // edited this frame
     ImGuiInputTextFlags     Flags;                  // copy of InputText() flags. may be used to check if e.g. ImGuiInputTextFlags_Password is set.
+    ImVector<ImGuiInputTextLine> Lines;             // [Multi-line] cached line index, built on demand then updated around edits. Lines.Size is the line count.
+    bool                    LinesValid;             // [Multi-line] Lines[] is in sync with TextW[]. Cleared whenever TextW[] is rewritten outside of stb_textedit.
 
     ImGuiInputTextState()                   { memset(this, 0, sizeof(*this)); }
-    void        ClearText()                 { CurLenW = CurLenA = 0; TextW[0] = 0; TextA[0] = 0; CursorClamp(); }
-    void        ClearFreeMemory()           { TextW.clear(); TextA.clear(); InitialTextA.clear(); }
+    void        ClearText()                 { CurLenW = CurLenA = 0; TextW[0] = 0; TextA[0] = 0; LinesValid = false; CursorClamp(); }
+    void        ClearFreeMemory()           { TextW.clear(); TextA.clear(); InitialTextA.clear(); Lines.clear(); LinesValid = false; }
     int         GetUndoAvailCount() const   { return Stb.undostate.undo_point; }
     int         GetRedoAvailCount() const   { return IMSTB_TEXTEDIT_UNDOSTATECOUNT - Stb.undostate.redo_point; }
     void        OnKeyPressed(int key);      // Cannot be inline because we call in code in stb_textedit.h implementation
@@ -1343,7 +1432,8 @@ struct ImGuiInputEvent
 {
     ImGuiInputEventType             Type;
     ImGuiInputSource                Source;
-    ImU32                           EventId;        // Unique, sequential increasing integer to identify an event (if you need to correlate them to other data).
+    ImU32                           EventId;        // Unique, sequential increasing integer to identify an event (if you need to correlate them to other data). Merged mouse events take the EventId of the last one.
+    double                          Timestamp;      // Value returned by io.GetInputEventTimestampFn() when the event was submitted, 0.0 if not set.
     union
     {
         ImGuiInputEventMousePos     MousePos;       // if Type == ImGuiInputEventType_MousePos
@@ -1482,10 +1572,36 @@ struct ImGuiListClipperData
     float                           LossynessOffset;
     int                             StepNo;
     int                             ItemsFrozen;
+    int                             MeasureItem;        // Variable height: item returned by last Step(), to be measured on next Step() (-1 if none)
+    float                           MeasureStartY;      // Variable height: cursor position when MeasureItem was returned
     ImVector<ImGuiListClipperRange> Ranges;
 
     ImGuiListClipperData()          { memset(this, 0, sizeof(*this)); }
-    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; Ranges.resize(0); }
+    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; MeasureItem = -1; MeasureStartY = 0.0f; Ranges.resize(0); }
+};
+
+// Block of cells for ImGuiGridClipper. Max are exclusive.
+struct ImGuiGridClipperBlock
+{
+    int     RowMin, RowMax;
+    int     ColumnMin, ColumnMax;
+
+    ImGuiGridClipperBlock()         { RowMin = RowMax = ColumnMin = ColumnMax = 0; }
+    ImGuiGridClipperBlock(int row_min, int row_max, int column_min, int column_max) { RowMin = row_min; RowMax = row_max; ColumnMin = column_min; ColumnMax = column_max; }
+    bool    IsEmpty() const         { return RowMin >= RowMax || ColumnMin >= ColumnMax; }
+};
+
+// Temporary grid clipper data, buffers shared/reused between instances
+struct ImGuiGridClipperData
+{
+    ImGuiGridClipper*               GridClipper;
+    ImVec2                          LossynessOffset;
+    int                             StepNo;
+    ImVector<ImGuiGridClipperBlock> Blocks;             // Blocks included by user, then made disjoint on first step
+    ImVector<ImGuiGridClipperBlock> BlocksTemp;
+
+    ImGuiGridClipperData()          { GridClipper = NULL; StepNo = 0; }
+    void                            Reset(ImGuiGridClipper* clipper) { GridClipper = clipper; StepNo = 0; Blocks.resize(0); }
 };
 
 //-----------------------------------------------------------------------------
@@ -1728,11 +1844,48 @@ struct ImGuiWindowSettings
     bool        IsChild;
     bool        WantApply;      // Set when loaded from .ini data (to enable merging/loading .ini data into an already running context)
     bool        WantDelete;     // Set to invalidate/delete the settings entry
+    bool        IsDirty;        // Set when data changed since last written to .ini, otherwise the cached text at IniOffset is reused
+    int         IniOffset;      // Offset of last written text in g.SettingsWindowsIniCache
+    int         IniSize;        // Size of last written text (0 if never written)
 
     ImGuiWindowSettings()       { memset(this, 0, sizeof(*this)); }
     char* GetName()             { return (char*)(this + 1); }
 };
 
+// Binary settings container, see SaveBinarySettingsToMemory()
+// - Header (ImGuiSettingsBinaryHeader), followed by one chunk per settings handler which had data.
+// - Chunk (ImGuiSettingsBinaryChunk), followed by 'Size' bytes of handler data, padded to 8 bytes.
+// - Data is stored in native byte order: a container written with another byte order is rejected on load (magic won't match).
+#define IMGUI_SETTINGS_BINARY_MAGIC     0x53474D49  // "IMGS"
+#define IMGUI_SETTINGS_BINARY_VERSION   1
+
+enum ImGuiSettingsBinaryChunkFlags_
+{
+    ImGuiSettingsBinaryChunkFlags_None  = 0,
+    ImGuiSettingsBinaryChunkFlags_Text  = 1 << 0,   // Chunk contains .ini text (from WriteAllFn), for handlers which don't have a WriteBinaryFn
+};
+
+struct ImGuiSettingsBinaryHeader
+{
+    ImU32       Magic;          // IMGUI_SETTINGS_BINARY_MAGIC
+    ImU32       Version;        // IMGUI_SETTINGS_BINARY_VERSION
+    ImU32       ChunksCount;
+    ImU32       DataSize;       // Total size, including this header
+};
+
+struct ImGuiSettingsBinaryChunk
+{
+    ImGuiID     TypeHash;       // == ImGuiSettingsHandler::TypeHash
+    ImU32       Version;        // == ImGuiSettingsHandler::BinaryVersion when written, 0 for text chunks
+    ImU32       Flags;          // ImGuiSettingsBinaryChunkFlags_
+    ImU32       Size;           // Size of data following this header, excluding padding
+};
+
+// Helpers for ImGuiSettingsHandler::WriteBinaryFn/ReadBinaryFn
+static inline void ImSettingsBinaryWrite(ImVector<char>* buf, const void* data, size_t data_size)                   { const int off = buf->Size; buf->resize(off + (int)data_size); memcpy(buf->Data + off, data, data_size); }
+static inline void ImSettingsBinaryWritePadding(ImVector<char>* buf, size_t data_size, size_t align)                { for (size_t n = data_size; n < IM_MEMALIGN(data_size, align); n++) buf->push_back(0); }
+static inline bool ImSettingsBinaryRead(const char** p, const char* p_end, void* out_data, size_t data_size)        { if ((size_t)(p_end - *p) < data_size) return false; memcpy(out_data, *p, data_size); *p += data_size; return true; }
+
 struct ImGuiSettingsHandler
 {
     const char* TypeName;       // Short description stored in .ini file. Disallowed characters: '[' ']'
@@ -1743,6 +1896,9 @@ struct ImGuiSettingsHandler
     void        (*ReadLineFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, void* entry, const char* line); // Read: Called for every line of text within an ini entry
     void        (*ApplyAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler);                                // Read: Called after reading (in registration order)
     void        (*WriteAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* out_buf);      // Write: Output every entries into 'out_buf'
+    void        (*ReadBinaryFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, int version, const void* data, size_t data_size); // Read: Called with data written by WriteBinaryFn (optional). 'data' is only valid during the call and may be unaligned.
+    void        (*WriteBinaryFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImVector<char>* out_buf);   // Write: Append every entries into 'out_buf' (optional, otherwise WriteAllFn output is stored as text in binary containers)
+    int         BinaryVersion;  // Version of data written by WriteBinaryFn, given back to ReadBinaryFn
     void*       UserData;
 
     ImGuiSettingsHandler() { memset(this, 0, sizeof(*this)); }
@@ -1850,6 +2006,57 @@ struct ImGuiIDStackTool
     ImGuiIDStackTool()      { memset(this, 0, sizeof(*this)); CopyToClipboardLastTime = -FLT_MAX; }
 };
 
+// Frame profiler (only recording when IMGUI_ENABLE_PROFILER is defined)
+#define IMGUI_PROFILER_MAX_FRAMES       120         // Number of frames kept in ImGuiProfiler::Frames[] ring buffer
+
+struct ImGuiProfilerZone
+{
+    const char*             Name;                       // Literal/persistent string
+    int                     ArgOffset;                  // Offset of copied argument in ImGuiProfilerFrame::Args[], -1 if none
+    int                     Depth;                      // Nesting level, 0 for top-level zones
+    double                  StartTime;                  // In microseconds since ImGuiProfiler::TimeBase
+    double                  EndTime;
+};
+
+struct ImGuiProfilerFrame
+{
+    int                     FrameCount;                 // Value of g.FrameCount for this frame, -1 if not recorded
+    double                  StartTime;                  // Start of NewFrame(), in microseconds since ImGuiProfiler::TimeBase
+    double                  EndTime;                    // End of last top-level zone (generally Render())
+    ImVector<ImGuiProfilerZone> Zones;                  // In begin order: child zones follow their parent
+    ImVector<char>          Args;                       // Zero-terminated arguments
+
+    ImGuiProfilerFrame()    { FrameCount = -1; StartTime = EndTime = 0.0; }
+    const char*             GetArg(const ImGuiProfilerZone* zone) const { return (zone->ArgOffset >= 0) ? Args.Data + zone->ArgOffset : NULL; }
+};
+
+struct ImGuiProfiler
+{
+    bool                    Enabled;                    // Record frames. Changes are applied on next NewFrame().
+    bool                    Recording;                  // Recording current frame
+    int                     FramesIdx;                  // Frame being recorded in Frames[]. Most recent completed frame is the one before.
+    int                     FramesCount;                // Number of completed frames in Frames[]
+    int                     DisplayFrameOffset;         // Metrics: frame to display, 0 = most recent
+    double                  TimeBase;
+    ImVector<ImGuiProfilerFrame> Frames;                // Ring buffer of IMGUI_PROFILER_MAX_FRAMES frames, allocated on first recorded frame
+    ImVector<int>           ZonesStack;                 // Indices of open zones in current frame
+
+    ImGuiProfiler()         { Enabled = true; Recording = false; FramesIdx = FramesCount = DisplayFrameOffset = 0; TimeBase = 0.0; }
+    ImGuiProfilerFrame*     GetFrame(int offset)        { IM_ASSERT(offset >= 0 && offset < FramesCount); return &Frames[(FramesIdx - 1 - offset + IMGUI_PROFILER_MAX_FRAMES) % IMGUI_PROFILER_MAX_FRAMES]; }
+};
+
+#ifdef IMGUI_ENABLE_PROFILER
+// Helper for IMGUI_PROFILER_ZONE()
+struct IMGUI_API ImGuiProfilerScope
+{
+    ImGuiContext*           Ctx;
+    bool                    Active;
+
+    ImGuiProfilerScope(ImGuiContext* ctx, const char* name, const char* arg = NULL);
+    ~ImGuiProfilerScope();
+};
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] Generic context hooks
 //-----------------------------------------------------------------------------
@@ -1872,6 +2079,9 @@ struct ImGuiContextHook
 // [SECTION] ImGuiContext (main Dear ImGui context)
 //-----------------------------------------------------------------------------
 
+// Idle frames (see GetNextWakeupTime())
+#define IMGUI_WAKEUP_SETTLE_FRAMES      3   // Frames to keep running after processing inputs, as some state changes are only visible after a frame or two.
+
 struct ImGuiContext
 {
     bool                    Initialized;
@@ -1895,9 +2105,15 @@ struct ImGuiContext
 
     // Inputs
     ImVector<ImGuiInputEvent> InputEventsQueue;                 // Input events which will be trickled/written into IO structure.
-    ImVector<ImGuiInputEvent> InputEventsTrail;                 // Past input events processed in NewFrame(). This is to allow domain-specific application to access e.g mouse/pen trail.
+    ImVector<ImGuiInputEvent> InputEventsTrail;                 // Past input events processed in NewFrame(). This is to allow domain-specific application to access e.g mouse/pen trail. Mouse events may be merged (see io.ConfigInputCoalesceMouseEvents), use InputEventsHistory[] for the full path.
+    ImVector<ImGuiInputEvent> InputEventsHistory;               // Ring buffer of last io.ConfigInputEventsHistorySize input events, before merging. Use GetInputEventsHistory() to access.
+    int                     InputEventsHistoryHead;             // Index of next write in InputEventsHistory[]
+    int                     InputEventsHistoryCount;            // Number of valid events in InputEventsHistory[]
     ImGuiMouseSource        InputEventsNextMouseSource;
     ImU32                   InputEventsNextEventId;
+    ImGuiInputEventRing*    InputEventsRing;                    // Lock-free queue written by io.AddXXXEvent() functions when IMGUI_ENABLE_THREADED_INPUT_EVENTS is defined, drained into InputEventsQueue by NewFrame()
+    double                  WakeupTime;                         // Value of g.Time at which a new frame was requested with RequestWakeup(). FLT_MAX when none.
+    int                     WakeupFramesLeft;                   // Number of frames to run after processing inputs before allowing to idle (some state changes take a frame or two to be visible)
 
     // Windows state
     ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
@@ -1973,6 +2189,10 @@ struct ImGuiContext
     ImGuiNextWindowData     NextWindowData;                     // Storage for SetNextWindow** functions
     bool                    DebugShowGroupRects;
 
+    // Literal IDs (see ImGuiLiteralID)
+    const ImGuiLiteralID*   NextItemLiteralID;                  // Set by widgets overloads taking a ImGuiLiteralID label, consumed by next ImGuiWindow::GetID() call on the same string.
+    ImGuiLiteralIDSeedShift LiteralIDSeedShifts[256];           // Direct-mapped cache indexed by (seed, length). Combined with ImGuiLiteralID::Hash to obtain same ID as ImHashStr().
+
     // Shared stacks
     ImGuiCol                    DebugFlashStyleColorIdx;        // (Keep close to ColorStack to share cache line)
     ImVector<ImGuiColorMod>     ColorStack;                     // Stack for PushStyleColor()/PopStyleColor() - inherited by Begin()
@@ -2073,6 +2293,12 @@ struct ImGuiContext
     // Clipper
     int                             ClipperTempDataStacked;
     ImVector<ImGuiListClipperData>  ClipperTempData;
+    int                             GridClipperTempDataStacked;
+    ImVector<ImGuiGridClipperData>  GridClipperTempData;
+
+    // Text
+    ImPool<ImGuiTextWrapLayout>     TextWrapLayouts;            // Cached word-wrap layouts, garbage collected when not used during previous frame
+    ImVector<ImGuiTextWrapLine>     TextWrapLinesTemp;          // Temporary storage for CalcTextWrapLayout()
 
     // Tables
     ImGuiTable*                     CurrentTable;
@@ -2140,9 +2366,15 @@ struct ImGuiContext
     bool                    SettingsLoaded;
     float                   SettingsDirtyTimer;                 // Save .ini Settings to memory when time reaches zero
     ImGuiTextBuffer         SettingsIniData;                    // In memory .ini settings
+    ImVector<char>          SettingsBinaryData;                 // In memory binary settings (output of SaveBinarySettingsToMemory())
     ImVector<ImGuiSettingsHandler>      SettingsHandlers;       // List of .ini settings handlers
     ImChunkStream<ImGuiWindowSettings>  SettingsWindows;        // ImGuiWindow .ini settings entries
     ImChunkStream<ImGuiTableSettings>   SettingsTables;         // ImGuiTable .ini settings entries
+    ImGuiStorage                        SettingsWindowsById;    // Map ID -> offset into SettingsWindows[] (hash indexed)
+    ImGuiStorage                        SettingsTablesById;     // Map ID -> offset into SettingsTables[] (hash indexed)
+    ImGuiTextBuffer                     SettingsWindowsIniCache; // Text of [Window] entries from last write, reused for entries which are not dirty
+    ImGuiTextBuffer                     SettingsTablesIniCache; // Text of [Table] entries from last write, reused for entries which are not dirty
+    ImGuiSettingsWriter*                SettingsWriter;         // Writer thread for io.ConfigIniSavingAsync, created on first use
     ImVector<ImGuiContextHook>          Hooks;                  // Hooks for extensions (e.g. test engine)
     ImGuiID                             HookIdNext;             // Next available HookId
 
@@ -2180,6 +2412,7 @@ struct ImGuiContext
     ImGuiMetricsConfig      DebugMetricsConfig;
     ImGuiIDStackTool        DebugIDStackTool;
     ImGuiDebugAllocInfo     DebugAllocInfo;
+    ImGuiProfiler           DebugProfiler;                      // Only recording with IMGUI_ENABLE_PROFILER
 
     // Misc
     float                   FramerateSecPerFrame[60];           // Calculate estimate of framerate for user over the last 60 frames..
@@ -2211,6 +2444,10 @@ struct ImGuiContext
 
         InputEventsNextMouseSource = ImGuiMouseSource_Mouse;
         InputEventsNextEventId = 1;
+        InputEventsRing = NULL;
+        InputEventsHistoryHead = InputEventsHistoryCount = 0;
+        WakeupTime = FLT_MAX;
+        WakeupFramesLeft = IMGUI_WAKEUP_SETTLE_FRAMES;
 
         WindowsActiveCount = 0;
         CurrentWindow = NULL;
@@ -2257,6 +2494,8 @@ struct ImGuiContext
         CurrentFocusScopeId = 0;
         CurrentItemFlags = ImGuiItemFlags_None;
         DebugShowGroupRects = false;
+
+        NextItemLiteralID = NULL;
         BeginMenuCount = 0;
 
         NavWindow = NULL;
@@ -2306,6 +2545,8 @@ struct ImGuiContext
         memset(DragDropPayloadBufLocal, 0, sizeof(DragDropPayloadBufLocal));
 
         ClipperTempDataStacked = 0;
+        GridClipperTempDataStacked = 0;
+        TextWrapLayouts.Map.SetHashIndex(true); // Many insertions/removals every frame
 
         CurrentTable = NULL;
         TablesTempDataStacked = 0;
@@ -2340,6 +2581,9 @@ struct ImGuiContext
 
         SettingsLoaded = false;
         SettingsDirtyTimer = 0.0f;
+        SettingsWriter = NULL;
+        SettingsWindowsById.SetHashIndex(true);
+        SettingsTablesById.SetHashIndex(true);
         HookIdNext = 0;
 
         memset(LocalizationTable, 0, sizeof(LocalizationTable));
@@ -2418,6 +2662,7 @@ struct IMGUI_API ImGuiWindowTempData
     ImVec2                  MenuBarOffset;          // MenuBarOffset.x is sort of equivalent of a per-layer CursorPos.x, saved/restored as we switch to the menu bar. The only situation when MenuBarOffset.y is > 0 if when (SafeAreaPadding.y > FramePadding.y), often used on TVs.
     ImGuiMenuColumns        MenuColumns;            // Simplified columns storage for menu items measurement
     int                     TreeDepth;              // Current tree depth.
+    int                     TextWrapLayoutCount;    // Number of CalcTextWrapLayout() calls without a text ID in this window this frame (identifies their layouts).
     ImU32                   TreeJumpToParentOnPopMask; // Store a copy of !g.NavIdIsAlive for TreeDepth 0..31.. Could be turned into a ImU64 if necessary.
     ImVector<ImGuiWindow*>  ChildWindows;
     ImGuiStorage*           StateStorage;           // Current persistent per-window storage (store e.g. tree node open/close state)
@@ -2641,9 +2886,8 @@ struct IMGUI_API ImGuiTabBar
 //-----------------------------------------------------------------------------
 
 #define IM_COL32_DISABLE                IM_COL32(0,0,0,1)   // Special sentinel code which cannot be used as a regular color.
-#define IMGUI_TABLE_MAX_COLUMNS         512                 // May be further lifted
+#define IMGUI_TABLE_MAX_COLUMNS         32767               // Limited by ImGuiTableColumnIdx. Only visible columns are given draw channels, see TableSetupDrawChannels().
 
-// Our current column maximum is 64 but we may raise that in the future.
 typedef ImS16 ImGuiTableColumnIdx;
 typedef ImU16 ImGuiTableDrawChannelIdx;
 
@@ -2741,6 +2985,7 @@ struct IMGUI_API ImGuiTable
     ImSpan<ImGuiTableColumn>    Columns;                    // Point within RawData[]
     ImSpan<ImGuiTableColumnIdx> DisplayOrderToIndex;        // Point within RawData[]. Store display order of columns (when not reordered, the values are 0...Count-1)
     ImSpan<ImGuiTableCellData>  RowCellData;                // Point within RawData[]. Store cells background requests for current row.
+    ImSpan<ImGuiTableColumnIdx> OutputColumns;              // Point within RawData[]. Columns requesting output this frame (visible or auto-fitting), in display order. Only the first OutputColumnsCount entries are valid.
     ImBitArrayPtr               EnabledMaskByDisplayOrder;  // Column DisplayOrder -> IsEnabled map
     ImBitArrayPtr               EnabledMaskByIndex;         // Column Index -> IsEnabled map (== not hidden by user/api) in a format adequate for iterating column without touching cold data
     ImBitArrayPtr               VisibleMaskByIndex;         // Column Index -> IsVisibleX|IsVisibleY map (== not hidden by user/api && not hidden by scrolling/cliprect)
@@ -2802,6 +3047,8 @@ struct IMGUI_API ImGuiTable
     ImGuiTableColumnIdx         SortSpecsCount;
     ImGuiTableColumnIdx         ColumnsEnabledCount;        // Number of enabled columns (<= ColumnsCount)
     ImGuiTableColumnIdx         ColumnsEnabledFixedCount;   // Number of enabled columns (<= ColumnsCount)
+    ImGuiTableColumnIdx         ColumnsVisibleCount;        // Number of visible columns (<= ColumnsEnabledCount), each of them is given its own draw channel(s)
+    ImGuiTableColumnIdx         OutputColumnsCount;         // Number of valid entries in OutputColumns[]
     ImGuiTableColumnIdx         DeclColumnsCount;           // Count calls to TableSetupColumn()
     ImGuiTableColumnIdx         AngledHeadersCount;         // Count columns with angled headers
     ImGuiTableColumnIdx         HoveredColumnBody;          // Index of column whose visible region is being hovered. Important: == ColumnsCount when hovering empty region after the right-most column!
@@ -2909,6 +3156,9 @@ struct ImGuiTableSettings
     ImGuiTableColumnIdx         ColumnsCount;
     ImGuiTableColumnIdx         ColumnsCountMax;        // Maximum number of columns this settings instance can store, we can recycle a settings instance with lower number of columns but not higher
     bool                        WantApply;              // Set when loaded from .ini data (to enable merging/loading .ini data into an already running context)
+    bool                        IsDirty;                // Set when data changed since last written to .ini, otherwise the cached text at IniOffset is reused
+    int                         IniOffset;              // Offset of last written text in g.SettingsTablesIniCache
+    int                         IniSize;                // Size of last written text (0 if never written)
 
     ImGuiTableSettings()        { memset(this, 0, sizeof(*this)); }
     ImGuiTableColumnSettings*   GetColumnSettings()     { return (ImGuiTableColumnSettings*)(this + 1); }
@@ -3029,6 +3279,7 @@ namespace ImGui
     IMGUI_API void          PushOverrideID(ImGuiContext* ctx, ImGuiID id);     // Push given value as-is at the top of the ID stack (whereas PushID combines old and new hashes)
     IMGUI_API ImGuiID       GetIDWithSeed(ImGuiContext* ctx, const char* str_id_begin, const char* str_id_end, ImGuiID seed);
     IMGUI_API ImGuiID       GetIDWithSeed(ImGuiContext* ctx, int n, ImGuiID seed);
+    IMGUI_API ImGuiID       GetIDWithSeed(ImGuiContext* ctx, const ImGuiLiteralID& str_id, ImGuiID seed);
 
     // Basic Helpers for widget code
     IMGUI_API void          ItemSize(ImGuiContext* ctx, const ImVec2& size, float text_baseline_y = -1.0f);
@@ -3115,6 +3366,8 @@ namespace ImGui
     inline bool             IsGamepadKey(ImGuiKey key)                                  { return key >= ImGuiKey_Gamepad_BEGIN && key < ImGuiKey_Gamepad_END; }
     inline bool             IsMouseKey(ImGuiKey key)                                    { return key >= ImGuiKey_Mouse_BEGIN && key < ImGuiKey_Mouse_END; }
     inline bool             IsAliasKey(ImGuiKey key)                                    { return key >= ImGuiKey_Aliases_BEGIN && key < ImGuiKey_Aliases_END; }
+    IMGUI_API int           GetInputEventsHistoryCount(ImGuiContext* ctx);                          // Number of events in history (up to io.ConfigInputEventsHistorySize)
+    IMGUI_API const ImGuiInputEvent* GetInputEventsHistory(ImGuiContext* ctx, int n);               // n = 0 is oldest event. Use EventId to find events you haven't seen yet.
     inline ImGuiKeyChord    ConvertShortcutMod(ImGuiContext* ctx, ImGuiKeyChord key_chord)                 { ImGuiContext& g = *ctx; IM_ASSERT_PARANOID(key_chord & ImGuiMod_Shortcut); return (key_chord & ~ImGuiMod_Shortcut) | (g.IO.ConfigMacOSXBehaviors ? ImGuiMod_Super : ImGuiMod_Ctrl); }
     inline ImGuiKey         ConvertSingleModFlagToKey(ImGuiContext* ctx, ImGuiKey key)
     {
@@ -3309,6 +3562,8 @@ namespace ImGui
     // NB: All position are in absolute pixels coordinates (we are never using window coordinates internally)
     IMGUI_API void          RenderText(ImGuiContext* ctx, ImVec2 pos, const char* text, const char* text_end = NULL, bool hide_text_after_hash = true);
     IMGUI_API void          RenderTextWrapped(ImGuiContext* ctx, ImVec2 pos, const char* text, const char* text_end, float wrap_width);
+    IMGUI_API ImGuiTextWrapLayout* CalcTextWrapLayout(ImGuiContext* ctx, const char* text, const char* text_end, float wrap_width, ImGuiID text_id = 0);
+    IMGUI_API void          RenderTextWrapLayout(ImGuiContext* ctx, ImVec2 pos, const char* text, const ImGuiTextWrapLayout* layout);
     IMGUI_API void          RenderTextClipped(ImGuiContext* ctx, const ImVec2& pos_min, const ImVec2& pos_max, const char* text, const char* text_end, const ImVec2* text_size_if_known, const ImVec2& align = ImVec2(0, 0), const ImRect* clip_rect = NULL);
     IMGUI_API void          RenderTextClippedEx(ImGuiContext* ctx, ImDrawList* draw_list, const ImVec2& pos_min, const ImVec2& pos_max, const char* text, const char* text_end, const ImVec2* text_size_if_known, const ImVec2& align = ImVec2(0, 0), const ImRect* clip_rect = NULL);
     IMGUI_API void          RenderTextEllipsis(ImGuiContext* ctx, ImDrawList* draw_list, const ImVec2& pos_min, const ImVec2& pos_max, float clip_max_x, float ellipsis_max_x, const char* text, const char* text_end, const ImVec2* text_size_if_known);
@@ -3328,7 +3583,7 @@ namespace ImGui
     IMGUI_API void          RenderRectFilledWithHole(ImDrawList* draw_list, const ImRect& outer, const ImRect& inner, ImU32 col, float rounding);
 
     // Widgets
-    IMGUI_API void          TextEx(ImGuiContext* ctx, const char* text, const char* text_end = NULL, ImGuiTextFlags flags = 0);
+    IMGUI_API void          TextEx(ImGuiContext* ctx, const char* text, const char* text_end = NULL, ImGuiTextFlags flags = 0, ImGuiID wrap_text_id = 0); // wrap_text_id: see CalcTextWrapLayout()
     IMGUI_API bool          ButtonEx(ImGuiContext* ctx, const char* label, const ImVec2& size_arg = ImVec2(0, 0), ImGuiButtonFlags flags = 0);
     IMGUI_API bool          ArrowButtonEx(ImGuiContext* ctx, const char* str_id, ImGuiDir dir, ImVec2 size_arg, ImGuiButtonFlags flags = 0);
     IMGUI_API bool          ImageButtonEx(ImGuiContext* ctx, ImGuiID id, ImTextureID texture_id, const ImVec2& image_size, const ImVec2& uv0, const ImVec2& uv1, const ImVec4& bg_col, const ImVec4& tint_col, ImGuiButtonFlags flags = 0);
@@ -3390,7 +3645,7 @@ namespace ImGui
     IMGUI_API void          ColorPickerOptionsPopup(ImGuiContext* ctx, const float* ref_col, ImGuiColorEditFlags flags);
 
     // Plot
-    IMGUI_API int           PlotEx(ImGuiContext* ctx, ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg);
+    IMGUI_API int           PlotEx(ImGuiContext* ctx, ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg, ImGuiPlotIndex* index = NULL);
 
     // Shade functions (write over already created vertices)
     IMGUI_API void          ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1);
@@ -3407,6 +3662,13 @@ namespace ImGui
     IMGUI_API void          DebugLogV(ImGuiContext* ctx, const char* fmt, va_list args) IM_FMTLIST(2);
     IMGUI_API void          DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr, size_t size); // size >= 0 : alloc, size = -1 : free
 
+    // Profiler (recording only with IMGUI_ENABLE_PROFILER, otherwise these are no-ops)
+    IMGUI_API void          ProfilerNewFrame(ImGuiContext* ctx);
+    IMGUI_API bool          ProfilerZoneBegin(ImGuiContext* ctx, const char* name, const char* arg = NULL);  // Return false when not recording (recording state only changes in NewFrame(), ProfilerZoneEnd() is then a no-op).
+    IMGUI_API void          ProfilerZoneEnd(ImGuiContext* ctx);
+    IMGUI_API void          ProfilerExportChromeTraceToBuffer(ImGuiContext* ctx, ImGuiTextBuffer* out_buf);  // Chrome trace_event JSON format (open with chrome://tracing or ui.perfetto.dev)
+    IMGUI_API bool          ProfilerExportChromeTrace(ImGuiContext* ctx, const char* filename);
+
     // Debug Tools
     IMGUI_API void          ErrorCheckEndFrameRecover(ImGuiContext* ctx, ImGuiErrorLogCallback log_callback, void* user_data = NULL);
     IMGUI_API void          ErrorCheckEndWindowRecover(ImGuiContext* ctx, ImGuiErrorLogCallback log_callback, void* user_data = NULL);
@@ -3432,6 +3694,7 @@ namespace ImGui
     IMGUI_API void          DebugNodeTable(ImGuiContext* ctx, ImGuiTable* table);
     IMGUI_API void          DebugNodeTableSettings(ImGuiContext* ctx, ImGuiTableSettings* settings);
     IMGUI_API void          DebugNodeInputTextState(ImGuiContext* ctx, ImGuiInputTextState* state);
+    IMGUI_API void          DebugNodeProfiler(ImGuiContext* ctx, ImGuiProfiler* profiler);
     IMGUI_API void          DebugNodeTypingSelectState(ImGuiContext* ctx, ImGuiTypingSelectState* state);
     IMGUI_API void          DebugNodeWindow(ImGuiContext* ctx, ImGuiWindow* window, const char* label);
     IMGUI_API void          DebugNodeWindowSettings(ImGuiContext* ctx, ImGuiWindowSettings* settings);
@@ -3479,12 +3742,17 @@ IMGUI_API void      ImFontAtlasUpdateConfigDataPointers(ImFontAtlas* atlas);
 IMGUI_API void      ImFontAtlasBuildInit(ImFontAtlas* atlas);
 IMGUI_API void      ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent);
 IMGUI_API void      ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opaque);
+IMGUI_API void      ImFontAtlasBuildRetainPackContext(ImFontAtlas* atlas, void* stbrp_context_opaque, void* stbrp_nodes);
+IMGUI_API void      ImFontAtlasBuildGrowTexture(ImFontAtlas* atlas, int new_height);
 IMGUI_API void      ImFontAtlasBuildFinish(ImFontAtlas* atlas);
 IMGUI_API void      ImFontAtlasBuildRender8bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned char in_marker_pixel_value);
 IMGUI_API void      ImFontAtlasBuildRender32bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned int in_marker_pixel_value);
 IMGUI_API void      ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void      ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
 
+// Helper for word-wrapping layout (see ImGuiTextWrapLayout)
+IMGUI_API void      ImFontCalcWrapLines(const ImFont* font, float size, float wrap_width, const char* text, const char* paragraph_begin, const char* paragraph_end, ImVector<ImGuiTextWrapLine>* out_lines);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Test Engine specific hooks (imgui_test_engine)
 //-----------------------------------------------------------------------------
@@ -14,6 +14,7 @@ Index of this file:
 // [SECTION] Tables: Columns width management
 // [SECTION] Tables: Drawing
 // [SECTION] Tables: Sorting
+// [SECTION] Tables: Sort permutation helper
 // [SECTION] Tables: Headers
 // [SECTION] Tables: Context Menu
 // [SECTION] Tables: Settings (.ini data)
@@ -619,12 +620,13 @@ void ImGui::TableBeginInitMemory(ImGuiTable* table, int columns_count)
 {
     // Allocate single buffer for our arrays
     const int columns_bit_array_size = (int)ImBitArrayGetStorageSizeInBytes(columns_count);
-    ImSpanAllocator<6> span_allocator;
+    ImSpanAllocator<7> span_allocator;
     span_allocator.Reserve(0, columns_count * sizeof(ImGuiTableColumn));
     span_allocator.Reserve(1, columns_count * sizeof(ImGuiTableColumnIdx));
     span_allocator.Reserve(2, columns_count * sizeof(ImGuiTableCellData), 4);
     for (int n = 3; n < 6; n++)
         span_allocator.Reserve(n, columns_bit_array_size);
+    span_allocator.Reserve(6, columns_count * sizeof(ImGuiTableColumnIdx));
     table->RawData = IM_ALLOC(span_allocator.GetArenaSizeInBytes());
     memset(table->RawData, 0, span_allocator.GetArenaSizeInBytes());
     span_allocator.SetArenaBasePtr(table->RawData);
@@ -634,6 +636,7 @@ void ImGui::TableBeginInitMemory(ImGuiTable* table, int columns_count)
     table->EnabledMaskByDisplayOrder = (ImU32*)span_allocator.GetSpanPtrBegin(3);
     table->EnabledMaskByIndex = (ImU32*)span_allocator.GetSpanPtrBegin(4);
     table->VisibleMaskByIndex = (ImU32*)span_allocator.GetSpanPtrBegin(5);
+    span_allocator.GetSpan(6, &table->OutputColumns);
 }
 
 // Apply queued resizing/reordering/hiding requests
@@ -765,6 +768,7 @@ static void TableSetupColumnFlags(ImGuiTable* table, ImGuiTableColumn* column, I
 // Increase feedback side-effect with widgets relying on WorkRect.Max.x... Maybe provide a default distribution for _WidthAuto columns?
 void ImGui::TableUpdateLayout(ImGuiContext* ctx, ImGuiTable* table)
 {
+    IMGUI_PROFILER_ZONE(ctx, "TableUpdateLayout");
     ImGuiContext& g = *ctx;
     IM_ASSERT(table->IsLayoutLocked == false);
 
@@ -1017,6 +1021,7 @@ void ImGui::TableUpdateLayout(ImGuiContext* ctx, ImGuiTable* table)
     ImRect host_clip_rect = table->InnerClipRect;
     //host_clip_rect.Max.x += table->CellPaddingX + table->CellSpacingX2;
     ImBitArrayClearAllBits(table->VisibleMaskByIndex, table->ColumnsCount);
+    table->ColumnsVisibleCount = table->OutputColumnsCount = 0;
     for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
     {
         const int column_n = table->DisplayOrderToIndex[order_n];
@@ -1086,10 +1091,16 @@ void ImGui::TableUpdateLayout(ImGuiContext* ctx, ImGuiTable* table)
         column->IsVisibleY = true; // (column->ClipRect.Max.y > column->ClipRect.Min.y);
         const bool is_visible = column->IsVisibleX; //&& column->IsVisibleY;
         if (is_visible)
+        {
             ImBitArraySetBit(table->VisibleMaskByIndex, column_n);
+            table->ColumnsVisibleCount++;
+        }
 
         // Mark column as requesting output from user. Note that fixed + non-resizable sets are auto-fitting at all times and therefore always request output.
+        // Those are also recorded in OutputColumns[] so very wide tables can submit contents without iterating all their columns.
         column->IsRequestOutput = is_visible || column->AutoFitQueue != 0 || column->CannotSkipItemsQueue != 0;
+        if (column->IsRequestOutput)
+            table->OutputColumns[table->OutputColumnsCount++] = (ImGuiTableColumnIdx)column_n;
 
         // Mark column as SkipItems (ignoring all items/layout)
         // (table->HostSkipItems is a copy of inner_window->SkipItems before we cleared it above in Part 2)
@@ -1126,6 +1137,8 @@ void ImGui::TableUpdateLayout(ImGuiContext* ctx, ImGuiTable* table)
         {
             column->AutoFitQueue >>= 1;
             column->CannotSkipItemsQueue >>= 1;
+            if (column->AutoFitQueue != 0x00 || column->CannotSkipItemsQueue != 0x00)
+                ImGui::RequestWakeup(ctx);
         }
 
         if (visible_n < table->FreezeColumnsCount)
@@ -1141,6 +1154,13 @@ void ImGui::TableUpdateLayout(ImGuiContext* ctx, ImGuiTable* table)
     {
         table->Columns[table->LeftMostEnabledColumn].IsRequestOutput = true;
         table->Columns[table->LeftMostEnabledColumn].IsSkipItems = false;
+        if (table->OutputColumnsCount == 0 || table->OutputColumns[0] != table->LeftMostEnabledColumn)
+        {
+            // Left-most enabled column comes first in display order
+            memmove(&table->OutputColumns[1], &table->OutputColumns[0], table->OutputColumnsCount * sizeof(ImGuiTableColumnIdx));
+            table->OutputColumns[0] = table->LeftMostEnabledColumn;
+            table->OutputColumnsCount++;
+        }
     }
 
     // [Part 7] Detect/store when we are hovering the unused space after the right-most column (so e.g. context menus can react on it)
@@ -1608,6 +1628,8 @@ void ImGui::TableSetupScrollFreeze(ImGuiContext* ctx, int columns, int rows)
 // [SECTION] Tables: Simple accessors
 //-----------------------------------------------------------------------------
 // - TableGetColumnCount()
+// - TableGetVisibleColumnCount()
+// - TableGetVisibleColumnIndex()
 // - TableGetColumnName()
 // - TableGetColumnName() [Internal]
 // - TableSetColumnEnabled()
@@ -1626,6 +1648,28 @@ int ImGui::TableGetColumnCount(ImGuiContext* ctx)
     return table ? table->ColumnsCount : 0;
 }
 
+// Columns for which TableSetColumnIndex() would return true this frame, in display order.
+// Iterating those instead of every column keeps submission cost proportional to what is in view when using thousands of columns.
+int ImGui::TableGetVisibleColumnCount(ImGuiContext* ctx)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiTable* table = g.CurrentTable;
+    if (!table)
+        return 0;
+    if (!table->IsLayoutLocked)
+        TableUpdateLayout(ctx, table);
+    return table->OutputColumnsCount;
+}
+
+int ImGui::TableGetVisibleColumnIndex(ImGuiContext* ctx, int visible_n)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiTable* table = g.CurrentTable;
+    IM_ASSERT(table != NULL && table->IsLayoutLocked);
+    IM_ASSERT(visible_n >= 0 && visible_n < table->OutputColumnsCount);
+    return table->OutputColumns[visible_n];
+}
+
 const char* ImGui::TableGetColumnName(ImGuiContext* ctx, int column_n)
 {
     ImGuiContext& g = *ctx;
@@ -2391,14 +2435,16 @@ void ImGui::TablePopBackgroundChannel(ImGuiContext* ctx)
 // - Clip                         --> 2+D+N channels
 // - FreezeRows                   --> 2+D+N*2 (unless scrolling value is zero)
 // - FreezeRows || FreezeColunns  --> 3+D+N*2 (unless scrolling value is zero)
-// Where D is 1 if any column is clipped or hidden (dummy channel) otherwise 0.
+// Where N is the number of visible columns and D is 1 if any column is clipped or hidden (dummy channel) otherwise 0.
+// Clipped columns all share the dummy channel, so a table with thousands of columns (ScrollX) only allocates channels for the ones in view.
 void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 {
     const int freeze_row_multiplier = (table->FreezeRowsCount > 0) ? 2 : 1;
-    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : table->ColumnsEnabledCount;
+    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : table->ColumnsVisibleCount;
     const int channels_for_bg = 1 + 1 * freeze_row_multiplier;
-    const int channels_for_dummy = (table->ColumnsEnabledCount < table->ColumnsCount || (memcmp(table->VisibleMaskByIndex, table->EnabledMaskByIndex, ImBitArrayGetStorageSizeInBytes(table->ColumnsCount)) != 0)) ? +1 : 0;
+    const int channels_for_dummy = (table->ColumnsVisibleCount < table->ColumnsCount) ? +1 : 0;
     const int channels_total = channels_for_bg + (channels_for_row * freeze_row_multiplier) + channels_for_dummy;
+    IM_ASSERT(channels_total <= 0xFFFF); // ImGuiTableDrawChannelIdx
     table->DrawSplitter->Split(table->InnerWindow->DrawList, channels_total);
     table->DummyDrawChannel = (ImGuiTableDrawChannelIdx)((channels_for_dummy > 0) ? channels_total - 1 : -1);
     table->Bg2DrawChannelCurrent = TABLE_DRAW_CHANNEL_BG2_FROZEN;
@@ -2831,8 +2877,12 @@ void ImGui::TableSortSpecsSanitize(ImGuiTable* table)
     IM_ASSERT(table->Flags & ImGuiTableFlags_Sortable);
 
     // Clear SortOrder from hidden column and verify that there's no gap or duplicate.
+    // (values are linear when they are distinct and all lower than their count)
     int sort_order_count = 0;
-    ImU64 sort_order_mask = 0x00;
+    int sort_order_max = -1;
+    bool need_fix_linearize = false;
+    ImBitVector sort_order_mask;
+    sort_order_mask.Create(table->ColumnsCount);
     for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
     {
         ImGuiTableColumn* column = &table->Columns[column_n];
@@ -2841,26 +2891,31 @@ void ImGui::TableSortSpecsSanitize(ImGuiTable* table)
         if (column->SortOrder == -1)
             continue;
         sort_order_count++;
-        sort_order_mask |= ((ImU64)1 << column->SortOrder);
-        IM_ASSERT(sort_order_count < (int)sizeof(sort_order_mask) * 8);
+        sort_order_max = ImMax(sort_order_max, (int)column->SortOrder);
+        if (column->SortOrder < 0 || column->SortOrder >= table->ColumnsCount || sort_order_mask.TestBit(column->SortOrder))
+            need_fix_linearize = true; // Out of range value (e.g. from .ini data) or duplicate
+        else
+            sort_order_mask.SetBit(column->SortOrder);
     }
+    if (sort_order_max >= sort_order_count)
+        need_fix_linearize = true; // Gap
 
-    const bool need_fix_linearize = ((ImU64)1 << sort_order_count) != (sort_order_mask + 1);
     const bool need_fix_single_sort_order = (sort_order_count > 1) && !(table->Flags & ImGuiTableFlags_SortMulti);
     if (need_fix_linearize || need_fix_single_sort_order)
     {
-        ImU64 fixed_mask = 0x00;
+        ImBitVector fixed_mask;
+        fixed_mask.Create(table->ColumnsCount);
         for (int sort_n = 0; sort_n < sort_order_count; sort_n++)
         {
             // Fix: Rewrite sort order fields if needed so they have no gap or duplicate.
             // (e.g. SortOrder 0 disappeared, SortOrder 1..2 exists --> rewrite then as SortOrder 0..1)
             int column_with_smallest_sort_order = -1;
             for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
-                if ((fixed_mask & ((ImU64)1 << (ImU64)column_n)) == 0 && table->Columns[column_n].SortOrder != -1)
+                if (!fixed_mask.TestBit(column_n) && table->Columns[column_n].SortOrder != -1)
                     if (column_with_smallest_sort_order == -1 || table->Columns[column_n].SortOrder < table->Columns[column_with_smallest_sort_order].SortOrder)
                         column_with_smallest_sort_order = column_n;
             IM_ASSERT(column_with_smallest_sort_order != -1);
-            fixed_mask |= ((ImU64)1 << column_with_smallest_sort_order);
+            fixed_mask.SetBit(column_with_smallest_sort_order);
             table->Columns[column_with_smallest_sort_order].SortOrder = (ImGuiTableColumnIdx)sort_n;
 
             // Fix: Make sure only one column has a SortOrder if ImGuiTableFlags_MultiSortable is not set.
@@ -2923,6 +2978,342 @@ void ImGui::TableSortSpecsBuild(ImGuiTable* table)
     table->SortSpecs.SpecsCount = table->SortSpecsCount;
 }
 
+//-------------------------------------------------------------------------
+// [SECTION] Tables: Sort permutation helper
+//-------------------------------------------------------------------------
+// - ImGuiTableSortPermutation::SetRowsCount()
+// - ImGuiTableSortPermutation::SetSortSpecs()
+// - ImGuiTableSortPermutation::Sort()
+//-------------------------------------------------------------------------
+// The permutation is always sorted with a total order: sort specs, then row index. This is equivalent to a stable
+// sort from the identity and means that for rows which are equal on the first N keys, the order is the same as if
+// sorted on the remaining keys alone. We use this to reuse a previous order:
+// - Only the direction of key K changed: within each run of rows equal on keys [0,K), reverse the order of sub-runs
+//   of rows equal on keys [0,K]. Sub-runs keep their internal order. O(N) comparisons.
+// - Keys after an unchanged prefix of P keys changed (e.g. a secondary key was added with Shift+Click): merge sort
+//   each run of rows equal on keys [0,P) on the remaining keys. Merges of already ordered halves are skipped.
+// - Otherwise: bottom-up merge sort of the whole range.
+// All phases can be interrupted after a number of comparisons and resumed on the next call to Sort().
+//-------------------------------------------------------------------------
+
+struct ImGuiTableSortPermutationCompare
+{
+    const ImGuiTableColumnSortSpecs*    Specs;
+    ImGuiTableSortCompareFunc           Func;
+    void*                               UserData;
+    int                                 Count;
+
+    // Compare rows on keys [key_begin, key_end) then on row index (never return 0 for different rows)
+    int Compare(int row_a, int row_b, int key_begin, int key_end)
+    {
+        Count++;
+        for (int key_n = key_begin; key_n < key_end; key_n++)
+            if (int delta = Func(row_a, row_b, &Specs[key_n], UserData))
+                return ((delta > 0) == (Specs[key_n].SortDirection != ImGuiSortDirection_Descending)) ? +1 : -1;
+        return row_a - row_b;
+    }
+
+    // Return the first key in [0, key_end) on which rows differ, or key_end if they are equal
+    int FindFirstDifferentKey(int row_a, int row_b, int key_end)
+    {
+        Count++;
+        for (int key_n = 0; key_n < key_end; key_n++)
+            if (Func(row_a, row_b, &Specs[key_n], UserData) != 0)
+                return key_n;
+        return key_end;
+    }
+};
+
+static bool TableSortSpecsIsSameColumn(const ImGuiTableColumnSortSpecs& a, const ImGuiTableColumnSortSpecs& b)
+{
+    return a.ColumnIndex == b.ColumnIndex && a.ColumnUserID == b.ColumnUserID;
+}
+
+static bool TableSortSpecsIsSame(const ImGuiTableColumnSortSpecs& a, const ImGuiTableColumnSortSpecs& b)
+{
+    return TableSortSpecsIsSameColumn(a, b) && a.SortDirection == b.SortDirection;
+}
+
+static void TableSortSpecsCopy(ImVector<ImGuiTableColumnSortSpecs>* dst, const ImGuiTableColumnSortSpecs* src, int count)
+{
+    dst->resize(count);
+    if (count > 0)
+        memcpy(dst->Data, src, (size_t)count * sizeof(ImGuiTableColumnSortSpecs));
+}
+
+ImGuiTableSortPermutation::ImGuiTableSortPermutation()
+{
+    IsDataDirty = false;
+    LastSortCompares = 0;
+    JobPhase = JobKey = JobPos = JobRunStart = JobSegment = JobWidth = JobMergeI = JobMergeJ = JobMergeK = JobCompares = 0;
+}
+
+void ImGuiTableSortPermutation::Clear()
+{
+    Indices.clear();
+    Specs.clear();
+    SortedSpecs.clear();
+    JobWork.clear();
+    JobTemp.clear();
+    JobSegments.clear();
+    IsDataDirty = false;
+    JobPhase = 0;
+}
+
+void ImGuiTableSortPermutation::SetRowsCount(int rows_count)
+{
+    IM_ASSERT(rows_count >= 0);
+    if (Indices.Size == rows_count)
+        return;
+    Indices.resize(rows_count);
+    for (int n = 0; n < rows_count; n++)
+        Indices[n] = n;
+    SortedSpecs.resize(0); // Identity == sorted with no specs
+    JobPhase = 0;
+}
+
+void ImGuiTableSortPermutation::SetSortSpecs(const ImGuiTableSortSpecs* sort_specs)
+{
+    const int specs_count = sort_specs ? sort_specs->SpecsCount : 0;
+    bool same = (Specs.Size == specs_count);
+    for (int n = 0; same && n < specs_count; n++)
+        same = TableSortSpecsIsSame(Specs[n], sort_specs->Specs[n]);
+    if (same)
+        return;
+    TableSortSpecsCopy(&Specs, specs_count > 0 ? sort_specs->Specs : NULL, specs_count);
+    JobPhase = 0; // Restart from last completed order
+}
+
+static void TableSortPermutationBeginMergePhase(ImGuiTableSortPermutation* self, int key_begin)
+{
+    self->JobPhase = 3;
+    self->JobKey = key_begin;
+    self->JobSegment = 0;
+    self->JobWidth = 0;
+    self->JobMergeK = -1;
+    self->JobPos = (self->JobSegments.Size > 0) ? self->JobSegments[0] : 0;
+}
+
+// Return false if there is nothing to sort (Indices[] updated immediately)
+static bool TableSortPermutationBeginJob(ImGuiTableSortPermutation* self)
+{
+    const int rows_count = self->Indices.Size;
+    self->JobCompares = 0;
+    if (self->Specs.Size == 0 || rows_count <= 1)
+    {
+        for (int n = 0; n < rows_count; n++)
+            self->Indices[n] = (self->Specs.Size == 0) ? n : self->Indices[n];
+        TableSortSpecsCopy(&self->SortedSpecs, self->Specs.Data, self->Specs.Size);
+        self->IsDataDirty = false;
+        self->LastSortCompares = 0;
+        return false;
+    }
+
+    // Find how much of the previous order can be reused
+    int prefix = 0;
+    int reverse_key = -1;
+    if (!self->IsDataDirty)
+    {
+        while (prefix < self->Specs.Size && prefix < self->SortedSpecs.Size && TableSortSpecsIsSame(self->Specs[prefix], self->SortedSpecs[prefix]))
+            prefix++;
+        if (prefix < self->Specs.Size && self->Specs.Size == self->SortedSpecs.Size && TableSortSpecsIsSameColumn(self->Specs[prefix], self->SortedSpecs[prefix]))
+        {
+            reverse_key = prefix;
+            for (int key_n = prefix + 1; key_n < self->Specs.Size && reverse_key != -1; key_n++)
+                if (!TableSortSpecsIsSame(self->Specs[key_n], self->SortedSpecs[key_n]))
+                    reverse_key = -1;
+        }
+    }
+
+    self->JobTemp.resize(rows_count);
+    self->JobSegments.resize(0);
+    if (reverse_key != -1)
+    {
+        self->JobWork = self->Indices;
+        self->JobPhase = 2;
+        self->JobKey = reverse_key;
+        self->JobSegments.push_back(0);
+        self->JobRunStart = 0;
+        self->JobPos = 1;
+    }
+    else if (prefix > 0)
+    {
+        self->JobWork = self->Indices;
+        self->JobPhase = 1;
+        self->JobKey = prefix;
+        self->JobRunStart = 0;
+        self->JobPos = 1;
+    }
+    else
+    {
+        self->JobWork.resize(rows_count);
+        for (int n = 0; n < rows_count; n++)
+            self->JobWork[n] = n;
+        self->JobSegments.push_back(0);
+        self->JobSegments.push_back(rows_count);
+        TableSortPermutationBeginMergePhase(self, 0);
+    }
+    return true;
+}
+
+// Return true when completed, false when running out of budget
+static bool TableSortPermutationStepJob(ImGuiTableSortPermutation* self, ImGuiTableSortPermutationCompare* cmp, int max_compares)
+{
+    const int rows_count = self->JobWork.Size;
+    const int keys_count = self->Specs.Size;
+    int* work = self->JobWork.Data;
+    int* temp = self->JobTemp.Data;
+    #define OUT_OF_BUDGET() (max_compares > 0 && cmp->Count >= max_compares)
+
+    // Phase 1: split into runs of rows equal on the unchanged prefix keys
+    if (self->JobPhase == 1)
+    {
+        for (; self->JobPos < rows_count; self->JobPos++)
+        {
+            if (OUT_OF_BUDGET())
+                return false;
+            if (cmp->FindFirstDifferentKey(work[self->JobPos - 1], work[self->JobPos], self->JobKey) < self->JobKey)
+            {
+                if (self->JobPos - self->JobRunStart > 1)
+                {
+                    self->JobSegments.push_back(self->JobRunStart);
+                    self->JobSegments.push_back(self->JobPos);
+                }
+                self->JobRunStart = self->JobPos;
+            }
+        }
+        if (rows_count - self->JobRunStart > 1)
+        {
+            self->JobSegments.push_back(self->JobRunStart);
+            self->JobSegments.push_back(rows_count);
+        }
+        TableSortPermutationBeginMergePhase(self, self->JobKey);
+    }
+
+    // Phase 2: reverse sub-runs within runs (JobSegments[] holds sub-runs starts of current run)
+    if (self->JobPhase == 2)
+    {
+        const int key = self->JobKey;
+        for (; self->JobPos <= rows_count; self->JobPos++)
+        {
+            if (OUT_OF_BUDGET())
+                return false;
+            const int diff_key = (self->JobPos == rows_count) ? -1 : cmp->FindFirstDifferentKey(work[self->JobPos - 1], work[self->JobPos], key + 1);
+            if (diff_key > key)
+                continue;
+            if (diff_key < key)
+            {
+                int dst = self->JobRunStart;
+                int src_end = self->JobPos;
+                for (int sub_n = self->JobSegments.Size - 1; sub_n >= 0; sub_n--)
+                {
+                    const int src = self->JobSegments[sub_n];
+                    memcpy(temp + dst, work + src, (size_t)(src_end - src) * sizeof(int));
+                    dst += src_end - src;
+                    src_end = src;
+                }
+                self->JobSegments.resize(0);
+                self->JobRunStart = self->JobPos;
+            }
+            self->JobSegments.push_back(self->JobPos);
+        }
+        self->JobWork.swap(self->JobTemp);
+        return true;
+    }
+
+    // Phase 3: bottom-up merge sort of each segment on keys [JobKey, keys_count)
+    IM_ASSERT(self->JobPhase == 3);
+    const int key_begin = self->JobKey;
+    const int INSERTION_SORT_WIDTH = 8;
+    while (self->JobSegment < self->JobSegments.Size)
+    {
+        const int seg_begin = self->JobSegments[self->JobSegment];
+        const int seg_end = self->JobSegments[self->JobSegment + 1];
+        if (self->JobWidth == 0)
+        {
+            for (; self->JobPos < seg_end; self->JobPos += INSERTION_SORT_WIDTH)
+            {
+                if (OUT_OF_BUDGET())
+                    return false;
+                const int block_end = ImMin(self->JobPos + INSERTION_SORT_WIDTH, seg_end);
+                for (int i = self->JobPos + 1; i < block_end; i++)
+                {
+                    const int row = work[i];
+                    int j = i;
+                    for (; j > self->JobPos && cmp->Compare(work[j - 1], row, key_begin, keys_count) > 0; j--)
+                        work[j] = work[j - 1];
+                    work[j] = row;
+                }
+            }
+            self->JobWidth = INSERTION_SORT_WIDTH;
+            self->JobPos = seg_begin;
+        }
+        for (; self->JobWidth < seg_end - seg_begin; self->JobWidth *= 2, self->JobPos = seg_begin)
+            for (; self->JobPos + self->JobWidth < seg_end; self->JobPos += self->JobWidth * 2)
+            {
+                const int mid = self->JobPos + self->JobWidth;
+                const int end = ImMin(self->JobPos + self->JobWidth * 2, seg_end);
+                if (self->JobMergeK == -1)
+                {
+                    if (OUT_OF_BUDGET())
+                        return false;
+                    if (cmp->Compare(work[mid - 1], work[mid], key_begin, keys_count) < 0)
+                        continue; // Already ordered
+                    self->JobMergeI = self->JobPos;
+                    self->JobMergeJ = mid;
+                    self->JobMergeK = self->JobPos;
+                }
+                int i = self->JobMergeI, j = self->JobMergeJ, k = self->JobMergeK;
+                while (i < mid && j < end)
+                {
+                    if (OUT_OF_BUDGET())
+                    {
+                        self->JobMergeI = i; self->JobMergeJ = j; self->JobMergeK = k;
+                        return false;
+                    }
+                    temp[k++] = (cmp->Compare(work[i], work[j], key_begin, keys_count) < 0) ? work[i++] : work[j++];
+                }
+                if (i < mid)
+                    memcpy(temp + k, work + i, (size_t)(mid - i) * sizeof(int));
+                memcpy(work + self->JobPos, temp + self->JobPos, (size_t)(k + (mid - i) - self->JobPos) * sizeof(int)); // Remaining [j, end) is already in place
+                self->JobMergeK = -1;
+            }
+        self->JobSegment += 2;
+        self->JobWidth = 0;
+        if (self->JobSegment < self->JobSegments.Size)
+            self->JobPos = self->JobSegments[self->JobSegment];
+    }
+    #undef OUT_OF_BUDGET
+    return true;
+}
+
+bool ImGuiTableSortPermutation::Sort(ImGuiTableSortCompareFunc compare_func, void* user_data, int max_compares)
+{
+    IM_ASSERT(compare_func != NULL);
+    if (JobPhase == 0)
+    {
+        bool same = (Specs.Size == SortedSpecs.Size);
+        for (int n = 0; same && n < Specs.Size; n++)
+            same = TableSortSpecsIsSame(Specs[n], SortedSpecs[n]);
+        if (same && !IsDataDirty)
+            return false;
+        if (!TableSortPermutationBeginJob(this))
+            return true;
+    }
+
+    ImGuiTableSortPermutationCompare cmp = { Specs.Data, compare_func, user_data, 0 };
+    const bool done = TableSortPermutationStepJob(this, &cmp, max_compares);
+    JobCompares += cmp.Count;
+    if (!done)
+        return false;
+    Indices.swap(JobWork);
+    TableSortSpecsCopy(&SortedSpecs, Specs.Data, Specs.Size);
+    IsDataDirty = false;
+    LastSortCompares = JobCompares;
+    JobPhase = 0;
+    return true;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Tables: Headers
 //-------------------------------------------------------------------------
@@ -2984,9 +3375,12 @@ void ImGui::TableHeadersRow(ImGuiContext* ctx)
     if (table->HostSkipItems) // Merely an optimization, you may skip in your own code.
         return;
 
+    // Only visit columns requesting output (the rest would early out in TableSetColumnIndex() anyway)
     const int columns_count = TableGetColumnCount(ctx);
-    for (int column_n = 0; column_n < columns_count; column_n++)
+    const int visible_columns_count = TableGetVisibleColumnCount(ctx);
+    for (int visible_n = 0; visible_n < visible_columns_count; visible_n++)
     {
+        const int column_n = TableGetVisibleColumnIndex(ctx, visible_n);
         if (!TableSetColumnIndex(ctx, column_n))
             continue;
 
@@ -3416,6 +3810,8 @@ void ImGui::TableDrawDefaultContextMenu(ImGuiContext* ctx, ImGuiTable* table, Im
 // - TableSettingsHandler_ReadOpen() [Internal]
 // - TableSettingsHandler_ReadLine() [Internal]
 // - TableSettingsHandler_WriteAll() [Internal]
+// - TableSettingsHandler_ReadBinary() [Internal]
+// - TableSettingsHandler_WriteBinary() [Internal]
 // - TableSettingsInstallHandler() [Internal]
 //-------------------------------------------------------------------------
 // [Init] 1: TableSettingsHandler_ReadXXXX()   Load and parse .ini file into TableSettings.
@@ -3435,6 +3831,7 @@ static void TableSettingsInit(ImGuiTableSettings* settings, ImGuiID id, int colu
     settings->ColumnsCount = (ImGuiTableColumnIdx)columns_count;
     settings->ColumnsCountMax = (ImGuiTableColumnIdx)columns_count_max;
     settings->WantApply = true;
+    settings->IsDirty = true;
 }
 
 static size_t TableSettingsCalcChunkSize(int columns_count)
@@ -3447,18 +3844,19 @@ ImGuiTableSettings* ImGui::TableSettingsCreate(ImGuiContext* ctx, ImGuiID id, in
     ImGuiContext& g = *ctx;
     ImGuiTableSettings* settings = g.SettingsTables.alloc_chunk(TableSettingsCalcChunkSize(columns_count));
     TableSettingsInit(settings, id, columns_count, columns_count);
+    g.SettingsTablesById.SetInt(id, g.SettingsTables.offset_from_ptr(settings));
     return settings;
 }
 
 // Find existing settings
 ImGuiTableSettings* ImGui::TableSettingsFindByID(ImGuiContext* ctx, ImGuiID id)
 {
-    // FIXME-OPT: Might want to store a lookup map for this?
     ImGuiContext& g = *ctx;
-    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
-        if (settings->ID == id)
-            return settings;
-    return NULL;
+    const int offset = g.SettingsTablesById.GetInt(id, -1);
+    if (offset == -1)
+        return NULL;
+    ImGuiTableSettings* settings = g.SettingsTables.ptr_from_offset(offset);
+    return (settings->ID == id) ? settings : NULL; // ID is cleared when invalidating storage
 }
 
 // Get settings for a given table, NULL if none
@@ -3536,6 +3934,7 @@ void ImGui::TableSaveSettings(ImGuiContext* ctx, ImGuiTable* table)
     }
     settings->SaveFlags &= table->Flags;
     settings->RefScale = save_ref_scale ? table->RefScale : 0.0f;
+    settings->IsDirty = true;
 
     MarkIniSettingsDirty(ctx);
 }
@@ -3568,7 +3967,9 @@ void ImGui::TableLoadSettings(ImGuiContext* ctx, ImGuiTable* table)
 
     // Serialize ImGuiTableSettings/ImGuiTableColumnSettings into ImGuiTable/ImGuiTableColumn
     ImGuiTableColumnSettings* column_settings = settings->GetColumnSettings();
-    ImU64 display_order_mask = 0;
+    ImBitVector display_order_mask;
+    display_order_mask.Create(settings->ColumnsCount);
+    int display_order_count = 0;
     for (int data_n = 0; data_n < settings->ColumnsCount; data_n++, column_settings++)
     {
         int column_n = column_settings->Index;
@@ -3588,15 +3989,18 @@ void ImGui::TableLoadSettings(ImGuiContext* ctx, ImGuiTable* table)
             column->DisplayOrder = column_settings->DisplayOrder;
         else
             column->DisplayOrder = (ImGuiTableColumnIdx)column_n;
-        display_order_mask |= (ImU64)1 << column->DisplayOrder;
+        if (column->DisplayOrder >= 0 && column->DisplayOrder < settings->ColumnsCount && !display_order_mask.TestBit(column->DisplayOrder))
+        {
+            display_order_mask.SetBit(column->DisplayOrder);
+            display_order_count++;
+        }
         column->IsUserEnabled = column->IsUserEnabledNextFrame = column_settings->IsEnabled;
         column->SortOrder = column_settings->SortOrder;
         column->SortDirection = column_settings->SortDirection;
     }
 
     // Validate and fix invalid display order data
-    const ImU64 expected_display_order_mask = (settings->ColumnsCount == 64) ? ~0 : ((ImU64)1 << settings->ColumnsCount) - 1;
-    if (display_order_mask != expected_display_order_mask)
+    if (display_order_count != settings->ColumnsCount)
         for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
             table->Columns[column_n].DisplayOrder = (ImGuiTableColumnIdx)column_n;
 
@@ -3608,31 +4012,27 @@ void ImGui::TableLoadSettings(ImGuiContext* ctx, ImGuiTable* table)
 static void TableSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandler*)
 {
     ImGuiContext& g = *ctx;
-    for (int i = 0; i != g.Tables.GetMapSize(); i++)
-        if (ImGuiTable* table = g.Tables.TryGetMapData(i))
-            table->SettingsOffset = -1;
+    for (int n = 0; n < g.Tables.GetAliveCount(); n++)
+        g.Tables.GetAliveByPos(n)->SettingsOffset = -1;
     g.SettingsTables.clear();
+    g.SettingsTablesById.Clear();
 }
 
 // Apply to existing windows (if any)
 static void TableSettingsHandler_ApplyAll(ImGuiContext* ctx, ImGuiSettingsHandler*)
 {
     ImGuiContext& g = *ctx;
-    for (int i = 0; i != g.Tables.GetMapSize(); i++)
-        if (ImGuiTable* table = g.Tables.TryGetMapData(i))
-        {
-            table->IsSettingsRequestLoad = true;
-            table->SettingsOffset = -1;
-        }
+    for (int n = 0; n < g.Tables.GetAliveCount(); n++)
+    {
+        ImGuiTable* table = g.Tables.GetAliveByPos(n);
+        table->IsSettingsRequestLoad = true;
+        table->SettingsOffset = -1;
+    }
 }
 
-static void* TableSettingsHandler_ReadOpen(ImGuiContext* ctx, ImGuiSettingsHandler*, const char* name)
+// Recycle or create settings for data being loaded
+static ImGuiTableSettings* TableSettingsFindOrCreateForLoad(ImGuiContext* ctx, ImGuiID id, int columns_count)
 {
-    ImGuiID id = 0;
-    int columns_count = 0;
-    if (sscanf(name, "0x%08X,%d", &id, &columns_count) < 2)
-        return NULL;
-
     if (ImGuiTableSettings* settings = ImGui::TableSettingsFindByID(ctx, id))
     {
         if (settings->ColumnsCountMax >= columns_count)
@@ -3645,6 +4045,15 @@ static void* TableSettingsHandler_ReadOpen(ImGuiContext* ctx, ImGuiSettingsHandl
     return ImGui::TableSettingsCreate(ctx, id, columns_count);
 }
 
+static void* TableSettingsHandler_ReadOpen(ImGuiContext* ctx, ImGuiSettingsHandler*, const char* name)
+{
+    ImGuiID id = 0;
+    int columns_count = 0;
+    if (sscanf(name, "0x%08X,%d", &id, &columns_count) < 2)
+        return NULL;
+    return TableSettingsFindOrCreateForLoad(ctx, id, columns_count);
+}
+
 static void TableSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line)
 {
     // "Column 0  UserID=0x42AD2D21 Width=100 Visible=1 Order=0 Sort=0v"
@@ -3673,11 +4082,22 @@ static void TableSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*,
 
 static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
 {
+    // Entries which haven't changed since last write are copied from the cache instead of being formatted again.
     ImGuiContext& g = *ctx;
+    ImGuiTextBuffer* cache = &g.SettingsTablesIniCache;
+    const int buf_start = buf->size();
+    buf->reserve(buf->size() + cache->size());
     for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
     {
         if (settings->ID == 0) // Skip ditched settings
             continue;
+        const int entry_start = buf->size();
+        if (!settings->IsDirty && settings->IniSize > 0)
+        {
+            buf->append(cache->begin() + settings->IniOffset, cache->begin() + settings->IniOffset + settings->IniSize);
+            settings->IniOffset = entry_start - buf_start;
+            continue;
+        }
 
         // TableSaveSettings() may clear some of those flags when we establish that the data can be stripped
         // (e.g. Order was unchanged)
@@ -3686,7 +4106,10 @@ static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandle
         const bool save_order   = (settings->SaveFlags & ImGuiTableFlags_Reorderable) != 0;
         const bool save_sort    = (settings->SaveFlags & ImGuiTableFlags_Sortable) != 0;
         if (!save_size && !save_visible && !save_order && !save_sort)
+        {
+            settings->IsDirty = true; // Cached text won't survive this write
             continue;
+        }
 
         buf->reserve(buf->size() + 30 + settings->ColumnsCount * 50); // ballpark reserve
         buf->appendf("[%s][0x%08X,%d]\n", handler->TypeName, settings->ID, settings->ColumnsCount);
@@ -3709,6 +4132,98 @@ static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandle
             buf->append("\n");
         }
         buf->append("\n");
+        settings->IniOffset = entry_start - buf_start;
+        settings->IniSize = buf->size() - entry_start;
+        settings->IsDirty = false;
+    }
+    cache->Buf.resize(0);
+    cache->append(buf->begin() + buf_start, buf->end());
+}
+
+// Binary entry: ImGuiTableSettingsBinary followed by ColumnsCount x ImGuiTableColumnSettingsBinary
+struct ImGuiTableSettingsBinary
+{
+    ImGuiID     ID;
+    float       RefScale;
+    ImU32       SaveFlags;
+    ImS16       ColumnsCount;
+    ImS16       Padding;
+};
+
+struct ImGuiTableColumnSettingsBinary
+{
+    float       WidthOrWeight;
+    ImGuiID     UserID;
+    ImS16       Index;
+    ImS16       DisplayOrder;
+    ImS16       SortOrder;
+    ImU8        SortDirection;
+    ImU8        Flags;          // 1: IsEnabled, 2: IsStretch
+};
+
+static void TableSettingsHandler_ReadBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, int version, const void* data, size_t data_size)
+{
+    if (version != 1)
+        return;
+    const char* p = (const char*)data;
+    const char* p_end = p + data_size;
+    ImGuiTableSettingsBinary entry;
+    while (ImSettingsBinaryRead(&p, p_end, &entry, sizeof(entry)))
+    {
+        if (entry.ColumnsCount < 0 || (size_t)(p_end - p) < entry.ColumnsCount * sizeof(ImGuiTableColumnSettingsBinary))
+            return;
+        ImGuiTableSettings* settings = TableSettingsFindOrCreateForLoad(ctx, entry.ID, entry.ColumnsCount);
+        settings->RefScale = entry.RefScale;
+        settings->SaveFlags = (ImGuiTableFlags)entry.SaveFlags;
+        ImGuiTableColumnSettings* column = settings->GetColumnSettings();
+        for (int column_n = 0; column_n < entry.ColumnsCount; column_n++, column++)
+        {
+            ImGuiTableColumnSettingsBinary column_entry;
+            ImSettingsBinaryRead(&p, p_end, &column_entry, sizeof(column_entry));
+            column->WidthOrWeight = column_entry.WidthOrWeight;
+            column->UserID = column_entry.UserID;
+            column->Index = (ImGuiTableColumnIdx)column_entry.Index;
+            column->DisplayOrder = (ImGuiTableColumnIdx)column_entry.DisplayOrder;
+            column->SortOrder = (ImGuiTableColumnIdx)column_entry.SortOrder;
+            column->SortDirection = column_entry.SortDirection & 0x03;
+            column->IsEnabled = (column_entry.Flags & 1) ? 1 : 0;
+            column->IsStretch = (column_entry.Flags & 2) ? 1 : 0;
+        }
+    }
+}
+
+static void TableSettingsHandler_WriteBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, ImVector<char>* buf)
+{
+    ImGuiContext& g = *ctx;
+    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
+    {
+        // Skip the same entries as TableSettingsHandler_WriteAll()
+        if (settings->ID == 0)
+            continue;
+        if ((settings->SaveFlags & (ImGuiTableFlags_Resizable | ImGuiTableFlags_Hideable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Sortable)) == 0)
+            continue;
+
+        ImGuiTableSettingsBinary entry;
+        memset(&entry, 0, sizeof(entry));
+        entry.ID = settings->ID;
+        entry.RefScale = settings->RefScale;
+        entry.SaveFlags = (ImU32)settings->SaveFlags;
+        entry.ColumnsCount = settings->ColumnsCount;
+        ImSettingsBinaryWrite(buf, &entry, sizeof(entry));
+
+        ImGuiTableColumnSettings* column = settings->GetColumnSettings();
+        for (int column_n = 0; column_n < settings->ColumnsCount; column_n++, column++)
+        {
+            ImGuiTableColumnSettingsBinary column_entry;
+            column_entry.WidthOrWeight = column->WidthOrWeight;
+            column_entry.UserID = column->UserID;
+            column_entry.Index = column->Index;
+            column_entry.DisplayOrder = column->DisplayOrder;
+            column_entry.SortOrder = column->SortOrder;
+            column_entry.SortDirection = (ImU8)column->SortDirection;
+            column_entry.Flags = (column->IsEnabled ? 1 : 0) | (column->IsStretch ? 2 : 0);
+            ImSettingsBinaryWrite(buf, &column_entry, sizeof(column_entry));
+        }
     }
 }
 
@@ -3722,6 +4237,9 @@ void ImGui::TableSettingsAddSettingsHandler(ImGuiContext* ctx)
     ini_handler.ReadLineFn = TableSettingsHandler_ReadLine;
     ini_handler.ApplyAllFn = TableSettingsHandler_ApplyAll;
     ini_handler.WriteAllFn = TableSettingsHandler_WriteAll;
+    ini_handler.ReadBinaryFn = TableSettingsHandler_ReadBinary;
+    ini_handler.WriteBinaryFn = TableSettingsHandler_WriteBinary;
+    ini_handler.BinaryVersion = 1;
     AddSettingsHandler(ctx, &ini_handler);
 }
 
@@ -3783,6 +4301,11 @@ void ImGui::TableGcCompactSettings(ImGuiContext* ctx)
         if (settings->ID != 0)
             memcpy(new_chunk_stream.alloc_chunk(TableSettingsCalcChunkSize(settings->ColumnsCount)), settings, TableSettingsCalcChunkSize(settings->ColumnsCount));
     g.SettingsTables.swap(new_chunk_stream);
+
+    // Rebuild lookup map
+    g.SettingsTablesById.Clear();
+    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
+        g.SettingsTablesById.SetInt(settings->ID, g.SettingsTables.offset_from_ptr(settings));
 }
 
 
@@ -125,12 +125,14 @@ static const ImU64          IM_U64_MAX = (2ULL * 9223372036854775807LL + 1);
 static bool             InputTextFilterCharacter(ImGuiContext* ctx, unsigned int* p_char, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* user_data, ImGuiInputSource input_source);
 static int              InputTextCalcTextLenAndLineCount(const char* text_begin, const char** out_text_end);
 static ImVec2           InputTextCalcTextSizeW(ImGuiContext* ctx, const ImWchar* text_begin, const ImWchar* text_end, const ImWchar** remaining = NULL, ImVec2* out_offset = NULL, bool stop_on_new_line = false);
+static void             InputTextRequestCursorBlinkWakeup(ImGuiContext* ctx, float cursor_anim);
 
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Text, etc.
 //-------------------------------------------------------------------------
 // - TextEx() [Internal]
 // - TextUnformatted()
+// - TextUnformattedIndexed()
 // - Text()
 // - TextV()
 // - TextColored()
@@ -139,13 +141,44 @@ static ImVec2           InputTextCalcTextSizeW(ImGuiContext* ctx, const ImWchar*
 // - TextDisabledV()
 // - TextWrapped()
 // - TextWrappedV()
+// - TextWrappedUnformatted()
 // - LabelText()
 // - LabelTextV()
 // - BulletText()
 // - BulletTextV()
 //-------------------------------------------------------------------------
 
-void ImGui::TextEx(ImGuiContext* ctx, const char* text, const char* text_end, ImGuiTextFlags flags)
+// Render a single line of unformatted text (no '\n' in range) and return its width.
+// Very long lines are horizontally clipped to the window clipping rectangle, so we don't emit vertices for off-screen characters.
+static float TextRenderLineClipped(ImGuiContext* ctx, const ImVec2& pos, const char* line, const char* line_end)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiWindow* window = g.CurrentWindow;
+    if (line_end - line < 1000 || g.LogEnabled)
+    {
+        ImGui::RenderText(ctx, pos, line, line_end, false);
+        return ImGui::CalcTextSize(ctx, line, line_end).x;
+    }
+
+    // Skip characters on the left of clipping rectangle, render until right of clipping rectangle, then measure the rest.
+    ImFont* font = g.Font;
+    const float font_size = g.FontSize;
+    const char* visible_begin = line;
+    float visible_x = pos.x;
+    if (window->ClipRect.Min.x > pos.x)
+        visible_x += font->CalcTextSizeA(font_size, window->ClipRect.Min.x - pos.x, 0.0f, line, line_end, &visible_begin).x;
+    const char* visible_end = visible_begin;
+    float visible_w = 0.0f;
+    if (visible_begin < line_end)
+        visible_w = font->CalcTextSizeA(font_size, window->ClipRect.Max.x - visible_x + font_size, 0.0f, visible_begin, line_end, &visible_end).x;
+    ImGui::RenderText(ctx, ImVec2(visible_x, pos.y), visible_begin, visible_end, false);
+    float line_width = visible_x + visible_w - pos.x;
+    if (visible_end < line_end)
+        line_width += font->CalcTextSizeA(font_size, FLT_MAX, 0.0f, visible_end, line_end).x;
+    return IM_TRUNC(line_width + 0.99999f);
+}
+
+void ImGui::TextEx(ImGuiContext* ctx, const char* text, const char* text_end, ImGuiTextFlags flags, ImGuiID wrap_text_id)
 {
     ImGuiWindow* window = GetCurrentWindow(ctx);
     if (window->SkipItems)
@@ -168,6 +201,17 @@ void ImGui::TextEx(ImGuiContext* ctx, const char* text, const char* text_end, Im
     {
         // Common case
         const float wrap_width = wrap_enabled ? CalcWrapWidthForPos(ctx, window->DC.CursorPos, wrap_pos_x) : 0.0f;
+        if (wrap_enabled && !g.LogEnabled)
+        {
+            // Word-wrapped text: use cached layout to measure and render (only visible lines)
+            const ImGuiTextWrapLayout* layout = CalcTextWrapLayout(ctx, text_begin, text_end, wrap_width, wrap_text_id);
+            ImRect bb(text_pos, text_pos + layout->Size);
+            ItemSize(ctx, layout->Size, 0.0f);
+            if (!ItemAdd(ctx, bb, 0))
+                return;
+            RenderTextWrapLayout(ctx, bb.Min, text_begin, layout);
+            return;
+        }
         const ImVec2 text_size = CalcTextSize(ctx, text_begin, text_end, false, wrap_width);
 
         ImRect bb(text_pos, text_pos + text_size);
@@ -223,8 +267,7 @@ void ImGui::TextEx(ImGuiContext* ctx, const char* text, const char* text_end, Im
                 const char* line_end = (const char*)memchr(line, '\n', text_end - line);
                 if (!line_end)
                     line_end = text_end;
-                text_size.x = ImMax(text_size.x, CalcTextSize(ctx, line, line_end).x);
-                RenderText(ctx, pos, line, line_end, false);
+                text_size.x = ImMax(text_size.x, TextRenderLineClipped(ctx, pos, line, line_end));
                 line = line_end + 1;
                 line_rect.Min.y += line_height;
                 line_rect.Max.y += line_height;
@@ -258,6 +301,53 @@ void ImGui::TextUnformatted(ImGuiContext* ctx, const char* text, const char* tex
     TextEx(ctx, text, text_end, ImGuiTextFlags_NoWidthForLargeClippedText);
 }
 
+// Same as TextUnformatted() for large text, but using a line index maintained across frames, so we can jump to visible lines
+// directly instead of scanning the buffer. Frame cost only depends on the number/length of visible lines.
+// - We only update the index for bytes appended since last call. If the text shrinks we rebuild it.
+// - Like TextUnformatted(), item width is the width of visible lines only.
+void ImGui::TextUnformattedIndexed(ImGuiContext* ctx, const char* text, const char* text_end, ImGuiTextIndex* line_index)
+{
+    ImGuiWindow* window = GetCurrentWindow(ctx);
+    if (window->SkipItems)
+        return;
+    ImGuiContext& g = *ctx;
+    IM_ASSERT(line_index != NULL);
+
+    if (text_end == NULL)
+        text_end = text + strlen(text); // FIXME-OPT: Pass text_end to avoid this
+    const int text_len = (int)(text_end - text);
+    if (text_len < line_index->EndOffset)
+        line_index->clear();
+    line_index->append(text, line_index->EndOffset, text_len);
+
+    // Logging needs to output all lines
+    const int lines_count = line_index->size();
+    if (lines_count == 0 || g.LogEnabled)
+    {
+        TextEx(ctx, text, text_end, ImGuiTextFlags_NoWidthForLargeClippedText);
+        return;
+    }
+
+    const ImVec2 text_pos(window->DC.CursorPos.x, window->DC.CursorPos.y + window->DC.CurrLineTextBaseOffset);
+    const float line_height = GetTextLineHeight(ctx);
+    const int line_min = ImClamp((int)((window->ClipRect.Min.y - text_pos.y) / line_height), 0, lines_count);
+    const int line_max = ImClamp((int)((window->ClipRect.Max.y - text_pos.y) / line_height) + 1, line_min, lines_count);
+    float text_width = 0.0f;
+    for (int line_n = line_min; line_n < line_max; line_n++)
+    {
+        const char* line = line_index->get_line_begin(text, line_n);
+        const char* line_end = line_index->get_line_end(text, line_n);
+        if (line_end > line && line_end[-1] == '\n') // Last line of a buffer ending with '\n'
+            line_end--;
+        text_width = ImMax(text_width, TextRenderLineClipped(ctx, ImVec2(text_pos.x, text_pos.y + line_n * line_height), line, line_end));
+    }
+
+    const ImVec2 text_size(text_width, lines_count * line_height);
+    ImRect bb(text_pos, text_pos + text_size);
+    ItemSize(ctx, text_size, 0.0f);
+    ItemAdd(ctx, bb, 0);
+}
+
 void ImGui::Text(ImGuiContext* ctx, const char* fmt, ...)
 {
     va_list args;
@@ -327,6 +417,17 @@ void ImGui::TextWrappedV(ImGuiContext* ctx, const char* fmt, va_list args)
         PopTextWrapPos(ctx);
 }
 
+void ImGui::TextWrappedUnformatted(ImGuiContext* ctx, const char* text, const char* text_end, ImGuiID text_id)
+{
+    ImGuiContext& g = *ctx;
+    const bool need_backup = (g.CurrentWindow->DC.TextWrapPos < 0.0f);  // Keep existing wrap position if one is already set
+    if (need_backup)
+        PushTextWrapPos(ctx, 0.0f);
+    TextEx(ctx, text, text_end, ImGuiTextFlags_NoWidthForLargeClippedText, text_id);
+    if (need_backup)
+        PopTextWrapPos(ctx);
+}
+
 void ImGui::LabelText(ImGuiContext* ctx, const char* label, const char* fmt, ...)
 {
     va_list args;
@@ -725,6 +826,16 @@ bool ImGui::Button(ImGuiContext* ctx, const char* label, const ImVec2& size_arg)
     return ButtonEx(ctx, label, size_arg, ImGuiButtonFlags_None);
 }
 
+// Label hashed at compile time: the ID is obtained in O(1) when ButtonEx() calls window->GetID(label.Str)
+bool ImGui::Button(ImGuiContext* ctx, const ImGuiLiteralID& label, const ImVec2& size_arg)
+{
+    ImGuiContext& g = *ctx;
+    g.NextItemLiteralID = &label;
+    bool pressed = ButtonEx(ctx, label.Str, size_arg, ImGuiButtonFlags_None);
+    g.NextItemLiteralID = NULL;
+    return pressed;
+}
+
 // Small buttons fits within text without additional vertical spacing.
 bool ImGui::SmallButton(ImGuiContext* ctx, const char* label)
 {
@@ -1094,6 +1205,15 @@ bool ImGui::ImageButton(ImGuiContext* ctx, ImTextureID user_texture_id, const Im
 }
 #endif // #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
 
+bool ImGui::Checkbox(ImGuiContext* ctx, const ImGuiLiteralID& label, bool* v)
+{
+    ImGuiContext& g = *ctx;
+    g.NextItemLiteralID = &label;
+    bool pressed = Checkbox(ctx, label.Str, v);
+    g.NextItemLiteralID = NULL;
+    return pressed;
+}
+
 bool ImGui::Checkbox(ImGuiContext* ctx, const char* label, bool* v)
 {
     ImGuiWindow* window = GetCurrentWindow(ctx);
@@ -3606,6 +3726,8 @@ bool ImGui::InputDouble(ImGuiContext* ctx, const char* label, double* v, double
 // - InputTextReindexLines() [Internal]
 // - InputTextReindexLinesRange() [Internal]
 // - InputTextEx() [Internal]
+// - ImGuiTextDocument
+// - InputTextMultiline() with ImGuiTextDocument
 // - DebugNodeInputTextState() [Internal]
 //-------------------------------------------------------------------------
 
@@ -3685,6 +3807,105 @@ static ImVec2 InputTextCalcTextSizeW(ImGuiContext* ctx, const ImWchar* text_begi
     return text_size;
 }
 
+// Request a frame for the next cursor blink toggle (visible 0.80f, hidden 0.40f, see InputTextEx())
+static void InputTextRequestCursorBlinkWakeup(ImGuiContext* ctx, float cursor_anim)
+{
+    ImGuiContext& g = *ctx;
+    if (!g.IO.ConfigInputTextCursorBlink)
+        return;
+    const float phase = (cursor_anim <= 0.0f) ? cursor_anim : ImFmod(cursor_anim, 1.20f);
+    ImGui::RequestWakeup(ctx, (phase <= 0.80f) ? (0.80f - phase + 0.001f) : (1.20f - phase));
+}
+
+// Return index of the line containing character 'pos' (binary search in the line index)
+static int InputTextFindLine(const ImGuiInputTextState* state, int pos)
+{
+    const ImGuiInputTextLine* lines = state->Lines.Data;
+    int line_min = 0;
+    int line_max = state->Lines.Size - 1;
+    while (line_min < line_max)
+    {
+        const int line_mid = (line_min + line_max + 1) / 2;
+        if (lines[line_mid].StartW <= pos)
+            line_min = line_mid;
+        else
+            line_max = line_mid - 1;
+    }
+    return line_min;
+}
+
+// Build line index of a multi-line text from scratch. After that, stb_textedit callbacks keep it updated with InputTextReindexLinesRange().
+static void InputTextReindexLines(ImGuiInputTextState* state)
+{
+    ImVector<ImGuiInputTextLine>& lines = state->Lines;
+    lines.resize(0);
+    const ImWchar* text_begin = state->TextW.Data;
+    const ImWchar* text_end = text_begin + state->CurLenW;
+    ImGuiInputTextLine line = { 0, 0 };
+    lines.push_back(line);
+    for (const ImWchar* s = text_begin; s < text_end; s++)
+        if (*s == '\n')
+        {
+            line.StartA += ImTextCountUtf8BytesFromStr(text_begin + line.StartW, s + 1);
+            line.StartW = (int)(s + 1 - text_begin);
+            lines.push_back(line);
+        }
+    state->LinesValid = true;
+}
+
+// Update line index after 'delete_len' characters (UTF-8: 'delete_len_a' bytes) at 'pos' have been replaced by 'insert_len' characters (UTF-8: 'insert_len_a' bytes).
+// Must be called after TextW[] has been modified. Lines before 'pos' are untouched, lines after the edit are only offset, so only the inserted text is scanned.
+static void InputTextReindexLinesRange(ImGuiInputTextState* state, int pos, int delete_len, int delete_len_a, int insert_len, int insert_len_a)
+{
+    if (!state->LinesValid)
+        return;
+    ImVector<ImGuiInputTextLine>& lines = state->Lines;
+    const ImWchar* text_begin = state->TextW.Data;
+    const ImWchar* insert_begin = text_begin + pos;
+    const ImWchar* insert_end = insert_begin + insert_len;
+
+    // Lines starting inside the deleted range are removed, lines starting inside the inserted text are added.
+    const int line_no = InputTextFindLine(state, pos);
+    const int delete_lines = (delete_len > 0) ? InputTextFindLine(state, pos + delete_len) - line_no : 0;
+    int insert_lines = 0;
+    for (const ImWchar* s = insert_begin; s < insert_end; s++)
+        if (*s == '\n')
+            insert_lines++;
+
+    // Offset following lines
+    const int move_src = line_no + 1 + delete_lines;
+    const int move_dst = line_no + 1 + insert_lines;
+    const int move_count = lines.Size - move_src;
+    if (move_dst > move_src)
+        lines.resize(lines.Size + move_dst - move_src);
+    if (move_dst != move_src && move_count > 0)
+        memmove(lines.Data + move_dst, lines.Data + move_src, (size_t)move_count * sizeof(ImGuiInputTextLine));
+    if (move_dst < move_src)
+        lines.resize(lines.Size - (move_src - move_dst));
+    const int delta_w = insert_len - delete_len;
+    const int delta_a = insert_len_a - delete_len_a;
+    for (int line_n = move_dst; line_n < lines.Size; line_n++)
+    {
+        lines[line_n].StartW += delta_w;
+        lines[line_n].StartA += delta_a;
+    }
+
+    // Add lines from inserted text
+    if (insert_lines == 0)
+        return;
+    ImGuiInputTextLine line = lines[line_no];
+    line.StartA += ImTextCountUtf8BytesFromStr(text_begin + line.StartW, insert_begin);
+    line.StartW = pos;
+    ImGuiInputTextLine* out_line = lines.Data + line_no + 1;
+    for (const ImWchar* s = insert_begin; s < insert_end; s++)
+        if (*s == '\n')
+        {
+            line.StartA += ImTextCountUtf8BytesFromStr(text_begin + line.StartW, s + 1);
+            line.StartW = (int)(s + 1 - text_begin);
+            *out_line++ = line;
+        }
+}
+
 // Wrapper for stb_textedit.h to edit text (our wrapper is for: statically sized buffer, single-line, wchar characters. InputText converts between UTF-8 and wchar)
 namespace ImStb
 {
@@ -3747,8 +3968,9 @@ static void STB_TEXTEDIT_DELETECHARS(ImGuiInputTextState* obj, int pos, int n)
     ImWchar* dst = obj->TextW.Data + pos;
 
     // We maintain our buffer length in both UTF-8 and wchar formats
+    const int n_utf8 = ImTextCountUtf8BytesFromStr(dst, dst + n);
     obj->Edited = true;
-    obj->CurLenA -= ImTextCountUtf8BytesFromStr(dst, dst + n);
+    obj->CurLenA -= n_utf8;
     obj->CurLenW -= n;
 
     // Offset remaining text (FIXME-OPT: Use memmove)
@@ -3756,6 +3978,7 @@ static void STB_TEXTEDIT_DELETECHARS(ImGuiInputTextState* obj, int pos, int n)
     while (ImWchar c = *src++)
         *dst++ = c;
     *dst = '\0';
+    InputTextReindexLinesRange(obj, pos, n, n_utf8, 0, 0);
 }
 
 static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const ImWchar* new_text, int new_text_len)
@@ -3786,6 +4009,7 @@ static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const Im
     obj->CurLenW += new_text_len;
     obj->CurLenA += new_text_len_utf8;
     obj->TextW[obj->CurLenW] = '\0';
+    InputTextReindexLinesRange(obj, pos, 0, 0, new_text_len, new_text_len_utf8);
 
     return true;
 }
@@ -4207,6 +4431,7 @@ bool ImGui::InputTextEx(ImGuiContext* ctx, const char* label, const char* hint,
         state->TextAIsValid = false;                // TextA is not valid yet (we will display buf until then)
         state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, buf_size, buf, NULL, &buf_end);
         state->CurLenA = (int)(buf_end - buf);      // We can't get the result from ImStrncpy() above because it is not UTF-8 aware. Here we'll cut off malformed UTF-8.
+        state->LinesValid = false;                  // Line index will be rebuilt on demand
 
         if (recycle_state)
         {
@@ -4285,6 +4510,7 @@ bool ImGui::InputTextEx(ImGuiContext* ctx, const char* label, const char* hint,
         state->TextW.resize(buf_size + 1);
         state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, state->TextW.Size, buf, NULL, &buf_end);
         state->CurLenA = (int)(buf_end - buf);
+        state->LinesValid = false;
         state->CursorClamp();
         render_selection &= state->HasSelection();
     }
@@ -4305,7 +4531,7 @@ bool ImGui::InputTextEx(ImGuiContext* ctx, const char* label, const char* hint,
         password_font->ContainerAtlas = g.Font->ContainerAtlas;
         password_font->FallbackGlyph = glyph;
         password_font->FallbackAdvanceX = glyph->AdvanceX;
-        IM_ASSERT(password_font->Glyphs.empty() && password_font->IndexAdvanceX.empty() && password_font->IndexLookup.empty());
+        IM_ASSERT(password_font->Glyphs.empty() && password_font->IndexPages.empty() && password_font->IndexAdvanceX.empty() && password_font->IndexLookup.empty());
         PushFont(ctx, password_font);
     }
 
@@ -4612,7 +4838,8 @@ bool ImGui::InputTextEx(ImGuiContext* ctx, const char* label, const char* hint,
         }
 
         // Apply ASCII value
-        if (!is_readonly)
+        // Only convert when TextW[] was modified: TextA[] stays valid across frames so an idle active widget doesn't touch the whole text.
+        if (!is_readonly && (state->Edited || !state->TextAIsValid))
         {
             state->TextAIsValid = true;
             state->TextA.resize(state->TextW.Size * 4 + 1);
@@ -4631,7 +4858,8 @@ bool ImGui::InputTextEx(ImGuiContext* ctx, const char* label, const char* hint,
             // Apply new value immediately - copy modified buffer back
             // Note that as soon as the input box is active, the in-widget value gets priority over any underlying modification of the input buffer
             // FIXME: We actually always render 'buf' when calling DrawList->AddText, making the comment above incorrect.
-            // FIXME-OPT: CPU waste to do this every time the widget is active, should mark dirty state from the stb_textedit callbacks.
+            // TextA[] is only rebuilt from TextW[] on frames where it was modified, but we still compare it to 'buf' every frame so that
+            // an underlying modification of the input buffer while active gets overwritten (strcmp() bails on the first differing byte).
 
             // User callback
             if ((flags & (ImGuiInputTextFlags_CallbackCompletion | ImGuiInputTextFlags_CallbackHistory | ImGuiInputTextFlags_CallbackEdit | ImGuiInputTextFlags_CallbackAlways)) != 0)
@@ -4707,6 +4935,7 @@ bool ImGui::InputTextEx(ImGuiContext* ctx, const char* label, const char* hint,
                             state->TextW.resize(state->TextW.Size + (callback_data.BufTextLen - backup_current_text_length)); // Worse case scenario resize
                         state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, state->TextW.Size, callback_data.Buf, NULL);
                         state->CurLenA = callback_data.BufTextLen;  // Assume correct length and valid UTF-8 from user, saves us an extra strlen()
+                        state->LinesValid = false;
                         state->CursorAnimReset();
                     }
                 }
@@ -4811,7 +5040,33 @@ bool ImGui::InputTextEx(ImGuiContext* ctx, const char* label, const char* hint,
         // FIXME: This should occur on buf_display but we'd need to maintain cursor/select_start/select_end for UTF-8.
         const ImWchar* text_begin = state->TextW.Data;
         ImVec2 cursor_offset, select_start_offset;
+        int select_start_line_no = 0;
+
+        if (is_multiline)
+        {
+            // Multi-line: find line numbers from the line index (built on first use, then kept updated by stb_textedit callbacks)
+            // so the cost doesn't depend on the size of the text, and only measure the lines the cursor and selection start are on.
+            if (!state->LinesValid)
+                InputTextReindexLines(state);
+            const ImGuiInputTextLine* lines = state->Lines.Data;
+            if (render_cursor)
+            {
+                const int line_no = InputTextFindLine(state, state->Stb.cursor);
+                cursor_offset.x = InputTextCalcTextSizeW(&g, text_begin + lines[line_no].StartW, text_begin + state->Stb.cursor).x;
+                cursor_offset.y = (line_no + 1) * g.FontSize;
+            }
+            if (render_selection)
+            {
+                const int select_start = ImMin(state->Stb.select_start, state->Stb.select_end);
+                select_start_line_no = InputTextFindLine(state, select_start);
+                select_start_offset.x = InputTextCalcTextSizeW(&g, text_begin + lines[select_start_line_no].StartW, text_begin + select_start).x;
+                select_start_offset.y = (select_start_line_no + 1) * g.FontSize;
+            }
 
+            // Store text height (note that we haven't calculated text width at all, see GitHub issues #383, #1224)
+            text_size = ImVec2(inner_size.x, state->Lines.Size * g.FontSize);
+        }
+        else
         {
             // Find lines numbers straddling 'cursor' (slot 0) and 'select_start' (slot 1) positions.
             const ImWchar* searches_input_ptr[2] = { NULL, NULL };
@@ -4831,8 +5086,6 @@ bool ImGui::InputTextEx(ImGuiContext* ctx, const char* label, const char* hint,
             }
 
             // Iterate all lines to find our line numbers
-            // In multi-line mode, we never exit the loop until all lines are counted, so add one extra to the searches_remaining counter.
-            searches_remaining += is_multiline ? 1 : 0;
             int line_count = 0;
             //for (const ImWchar* s = text_begin; (s = (const ImWchar*)wcschr((const wchar_t*)s, (wchar_t)'\n')) != NULL; s++)  // FIXME-OPT: Could use this when wchar_t are 16-bit
             for (const ImWchar* s = text_begin; *s != 0; s++)
@@ -4856,10 +5109,6 @@ bool ImGui::InputTextEx(ImGuiContext* ctx, const char* label, const char* hint,
                 select_start_offset.x = InputTextCalcTextSizeW(&g, ImStrbolW(searches_input_ptr[1], text_begin), searches_input_ptr[1]).x;
                 select_start_offset.y = searches_result_line_no[1] * g.FontSize;
             }
-
-            // Store text height (note that we haven't calculated text width at all, see GitHub issues #383, #1224)
-            if (is_multiline)
-                text_size = ImVec2(inner_size.x, line_count * g.FontSize);
         }
 
         // Scroll
@@ -4897,6 +5146,14 @@ bool ImGui::InputTextEx(ImGuiContext* ctx, const char* label, const char* hint,
             state->CursorFollow = false;
         }
 
+        // Multi-line: range of lines overlapping the clipping rectangle
+        int visible_line_min = 0, visible_line_max = 0;
+        if (is_multiline)
+        {
+            visible_line_min = ImClamp((int)ImFloor((clip_rect.y - draw_pos.y) / g.FontSize), 0, state->Lines.Size);
+            visible_line_max = ImClamp((int)ImCeil((clip_rect.w - draw_pos.y) / g.FontSize) + 1, visible_line_min, state->Lines.Size);
+        }
+
         // Draw selection
         const ImVec2 draw_scroll = ImVec2(state->ScrollX, 0.0f);
         if (render_selection)
@@ -4908,7 +5165,14 @@ bool ImGui::InputTextEx(ImGuiContext* ctx, const char* label, const char* hint,
             float bg_offy_up = is_multiline ? 0.0f : -1.0f;    // FIXME: those offsets should be part of the style? they don't play so well with multi-line selection.
             float bg_offy_dn = is_multiline ? 0.0f : 2.0f;
             ImVec2 rect_pos = draw_pos + select_start_offset - draw_scroll;
-            for (const ImWchar* p = text_selected_begin; p < text_selected_end; )
+            const ImWchar* p = text_selected_begin;
+            if (is_multiline && select_start_line_no < visible_line_min)
+            {
+                // Skip lines above the visible area
+                p = (visible_line_min < state->Lines.Size) ? ImMax(p, text_begin + state->Lines[visible_line_min].StartW) : text_selected_end;
+                rect_pos = ImVec2(draw_pos.x - draw_scroll.x, draw_pos.y + (visible_line_min + 1) * g.FontSize);
+            }
+            while (p < text_selected_end)
             {
                 if (rect_pos.y > clip_rect.w + g.FontSize)
                     break;
@@ -4935,7 +5199,18 @@ bool ImGui::InputTextEx(ImGuiContext* ctx, const char* label, const char* hint,
         }
 
         // We test for 'buf_display_max_length' as a way to avoid some pathological cases (e.g. single-line 1 MB string) which would make ImDrawList crash.
-        if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
+        if (is_multiline && buf_display_from_state && !is_displaying_hint)
+        {
+            // Multi-line: only submit visible lines. Line offsets in the index are valid for TextA[], but not necessarily for 'buf' which may contain malformed UTF-8.
+            if (visible_line_min < visible_line_max)
+            {
+                const char* visible_begin = buf_display + state->Lines[visible_line_min].StartA;
+                const char* visible_end = (visible_line_max < state->Lines.Size) ? buf_display + state->Lines[visible_line_max].StartA : buf_display_end;
+                ImU32 col = GetColorU32(ctx, ImGuiCol_Text);
+                draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos - draw_scroll + ImVec2(0.0f, visible_line_min * g.FontSize), col, visible_begin, visible_end, 0.0f, NULL);
+            }
+        }
+        else if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
         {
             ImU32 col = GetColorU32(ctx, is_displaying_hint ? ImGuiCol_TextDisabled : ImGuiCol_Text);
             draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos - draw_scroll, col, buf_display, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
@@ -4946,6 +5221,7 @@ bool ImGui::InputTextEx(ImGuiContext* ctx, const char* label, const char* hint,
         {
             state->CursorAnim += io.DeltaTime;
             bool cursor_is_visible = (!g.IO.ConfigInputTextCursorBlink) || (state->CursorAnim <= 0.0f) || ImFmod(state->CursorAnim, 1.20f) <= 0.80f;
+            InputTextRequestCursorBlinkWakeup(ctx, state->CursorAnim);
             ImVec2 cursor_screen_pos = ImTrunc(draw_pos + cursor_offset - draw_scroll);
             ImRect cursor_screen_rect(cursor_screen_pos.x, cursor_screen_pos.y - g.FontSize + 0.5f, cursor_screen_pos.x + 1.0f, cursor_screen_pos.y - 1.5f);
             if (cursor_is_visible && cursor_screen_rect.Overlaps(clip_rect))
@@ -5019,143 +5295,1025 @@ bool ImGui::InputTextEx(ImGuiContext* ctx, const char* label, const char* hint,
         return value_changed;
 }
 
-void ImGui::DebugNodeInputTextState(ImGuiContext* ctx, ImGuiInputTextState* state)
+// ImGuiTextDocument: text storage for InputTextMultiline(ctx, label, ImGuiTextDocument*).
+// Unlike InputTextEx(), the document is edited in place and stays in UTF-8: there is no conversion to wide characters and no copy
+// on activation, and everything done every frame (locating cursor/selection, rendering) only looks at visible lines.
+
+ImGuiTextDocument::ImGuiTextDocument()
 {
-#ifndef IMGUI_DISABLE_DEBUG_TOOLS
-    ImGuiContext& g = *ctx;
-    ImStb::STB_TexteditState* stb_state = &state->Stb;
-    ImStb::StbUndoState* undo_state = &stb_state->undostate;
-    Text(ctx, "ID: 0x%08X, ActiveID: 0x%08X", state->ID, g.ActiveId);
-    DebugLocateItemOnHover(ctx, state->ID);
-    Text(ctx, "CurLenW: %d, CurLenA: %d, Cursor: %d, Selection: %d..%d", state->CurLenW, state->CurLenA, stb_state->cursor, stb_state->select_start, stb_state->select_end);
-    Text(ctx, "has_preferred_x: %d (%.2f)", stb_state->has_preferred_x, stb_state->preferred_x);
-    Text(ctx, "undo_point: %d, redo_point: %d, undo_char_point: %d, redo_char_point: %d", undo_state->undo_point, undo_state->redo_point, undo_state->undo_char_point, undo_state->redo_char_point);
-    if (BeginChild(ctx, "undopoints", ImVec2(0.0f, GetTextLineHeight(ctx) * 10), ImGuiChildFlags_Border | ImGuiChildFlags_ResizeY)) // Visualize undo state
+    GapBegin = GapEnd = 0;
+    LineStarts.push_back(0);
+    LineGapBegin = LineGapEnd = 1;
+    Cursor = SelectionAnchor = 0;
+    Version = 0;
+    UndoPos = 0;
+    UndoMergeable = false;
+    ID = 0;
+    ScrollX = 0.0f;
+    PreferredX = -1.0f;
+    CursorAnim = 0.0f;
+    CursorFollow = false;
+}
+
+void ImGuiTextDocument::Clear()
+{
+    SetText("");
+}
+
+void ImGuiTextDocument::SetText(const char* text, const char* text_end)
+{
+    if (text == NULL)
+        text = text_end = "";
+    const int text_len = text_end ? (int)(text_end - text) : (int)strlen(text);
+    Buf.clear();
+    Buf.reserve(text_len + 256);
+    Buf.resize(text_len + 256);
+    if (text_len > 0)
+        memcpy(Buf.Data, text, (size_t)text_len);
+    GapBegin = text_len;
+    GapEnd = Buf.Size;
+
+    LineStarts.resize(1);
+    LineStarts[0] = 0;
+    for (const char* p = text; (p = (const char*)memchr(p, '\n', (size_t)(text + text_len - p))) != NULL; )
+        LineStarts.push_back((int)(++p - text));
+    LineGapBegin = LineGapEnd = LineStarts.Size;
+
+    Cursor = SelectionAnchor = 0;
+    ScrollX = 0.0f;
+    PreferredX = -1.0f;
+    Version++;
+    ClearUndo();
+}
+
+// Return index of line containing 'pos'
+int ImGuiTextDocument::GetLineFromPos(int pos) const
+{
+    IM_ASSERT(pos >= 0 && pos <= GetLength());
+    int lo = 0, hi = GetLineCount() - 1;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi + 1) >> 1;
+        if (GetLineStart(mid) <= pos)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return lo;
+}
+
+void ImGuiTextDocument::MoveGap(int pos)
+{
+    IM_ASSERT(pos >= 0 && pos <= GetLength());
+    if (pos < GapBegin)
     {
-        PushStyleVar(ctx, ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
-        for (int n = 0; n < IMSTB_TEXTEDIT_UNDOSTATECOUNT; n++)
-        {
-            ImStb::StbUndoRecord* undo_rec = &undo_state->undo_rec[n];
-            const char undo_rec_type = (n < undo_state->undo_point) ? 'u' : (n >= undo_state->redo_point) ? 'r' : ' ';
-            if (undo_rec_type == ' ')
-                BeginDisabled(ctx);
-            char buf[64] = "";
-            if (undo_rec_type != ' ' && undo_rec->char_storage != -1)
-                ImTextStrToUtf8(buf, IM_ARRAYSIZE(buf), undo_state->undo_char + undo_rec->char_storage, undo_state->undo_char + undo_rec->char_storage + undo_rec->insert_length);
-            Text(ctx, "%c [%02d] where %03d, insert %03d, delete %03d, char_storage %03d \"%s\"",
-                undo_rec_type, n, undo_rec->where, undo_rec->insert_length, undo_rec->delete_length, undo_rec->char_storage, buf);
-            if (undo_rec_type == ' ')
-                EndDisabled(ctx);
-        }
-        PopStyleVar(ctx);
+        const int n = GapBegin - pos;
+        memmove(Buf.Data + GapEnd - n, Buf.Data + pos, (size_t)n);
+        GapBegin -= n;
+        GapEnd -= n;
+    }
+    else if (pos > GapBegin)
+    {
+        const int n = pos - GapBegin;
+        memmove(Buf.Data + GapBegin, Buf.Data + GapEnd, (size_t)n);
+        GapBegin += n;
+        GapEnd += n;
     }
-    EndChild(ctx);
-#else
-    IM_UNUSED(state);
-#endif
 }
 
-//-------------------------------------------------------------------------
-// [SECTION] Widgets: ColorEdit, ColorPicker, ColorButton, etc.
-//-------------------------------------------------------------------------
-// - ColorEdit3()
-// - ColorEdit4()
-// - ColorPicker3()
-// - RenderColorRectWithAlphaCheckerboard() [Internal]
-// - ColorPicker4()
-// - ColorButton()
-// - SetColorEditOptions()
-// - ColorTooltip() [Internal]
-// - ColorEditOptionsPopup() [Internal]
-// - ColorPickerOptionsPopup() [Internal]
-//-------------------------------------------------------------------------
+// Line starts before the gap are stored as offsets from start of text, line starts after the gap as offsets from end of text.
+// Moving an entry across the gap converts it, so this must be called while LineStarts[] and the text are in sync.
+void ImGuiTextDocument::MoveLineGap(int line)
+{
+    IM_ASSERT(line >= 0 && line <= GetLineCount());
+    const int text_len = GetLength();
+    int* data = LineStarts.Data;
+    while (LineGapBegin > line)
+    {
+        LineGapBegin--;
+        LineGapEnd--;
+        data[LineGapEnd] = text_len - data[LineGapBegin];
+    }
+    while (LineGapBegin < line)
+    {
+        data[LineGapBegin] = text_len - data[LineGapEnd];
+        LineGapBegin++;
+        LineGapEnd++;
+    }
+}
 
-bool ImGui::ColorEdit3(ImGuiContext* ctx, const char* label, float col[3], ImGuiColorEditFlags flags)
+// Grow a gap buffer so its gap can hold at least 'size' elements. Elements after the gap are moved to the end.
+template<typename T>
+static void TextDocumentReserveGap(ImVector<T>* buf, int* gap_end, int gap_begin, int size)
 {
-    return ColorEdit4(ctx, label, col, flags | ImGuiColorEditFlags_NoAlpha);
+    if (*gap_end - gap_begin >= size)
+        return;
+    const int tail = buf->Size - *gap_end;
+    const int new_size = buf->Size + (size - (*gap_end - gap_begin)) + ImMax(256, buf->Size / 8);
+    buf->reserve(new_size);
+    buf->resize(new_size);
+    if (tail > 0)
+        memmove(buf->Data + new_size - tail, buf->Data + *gap_end, (size_t)tail * sizeof(T));
+    *gap_end = new_size - tail;
+}
+
+// Move the gap out of [begin..end) and return a pointer to it: O(min(distance from gap to either end of the range)).
+const char* ImGuiTextDocument::GetTextRange(int begin, int end)
+{
+    IM_ASSERT(begin >= 0 && begin <= end && end <= GetLength());
+    if (begin < GapBegin && end > GapBegin)
+        MoveGap((GapBegin - begin < end - GapBegin) ? begin : end);
+    if (Buf.Data == NULL)
+        return ImGuiTextBuffer::EmptyString;
+    return Buf.Data + ((begin < GapBegin) ? begin : begin + (GapEnd - GapBegin));
+}
+
+const char* ImGuiTextDocument::GetText()
+{
+    MoveGap(GetLength());
+    TextDocumentReserveGap(&Buf, &GapEnd, GapBegin, 1);
+    Buf.Data[GapBegin] = 0;
+    return Buf.Data;
+}
+
+static int TextDocumentAdjustPos(int p, int pos, int delete_len, int text_len)
+{
+    if (p <= pos)
+        return p;
+    if (p >= pos + delete_len)
+        return p + text_len - delete_len;
+    return pos + text_len;
+}
+
+void ImGuiTextDocument::ApplyReplace(int pos, int delete_len, const char* text, int text_len)
+{
+    IM_ASSERT(pos >= 0 && delete_len >= 0 && pos + delete_len <= GetLength() && text_len >= 0);
+
+    // Remove lines starting inside deleted text. Lines after the edit are stored relative to end of text so they are not touched.
+    const int line = GetLineFromPos(pos);
+    const int deleted_lines_count = (delete_len > 0) ? GetLineFromPos(pos + delete_len) - line : 0;
+    MoveLineGap(line + 1);
+    LineGapEnd += deleted_lines_count;
+    int new_lines_count = 0;
+    for (int n = 0; n < text_len; n++)
+        if (text[n] == '\n')
+            new_lines_count++;
+    TextDocumentReserveGap(&LineStarts, &LineGapEnd, LineGapBegin, new_lines_count);
+
+    // Edit text
+    MoveGap(pos);
+    GapEnd += delete_len;
+    TextDocumentReserveGap(&Buf, &GapEnd, GapBegin, text_len);
+    if (text_len > 0)
+        memcpy(Buf.Data + GapBegin, text, (size_t)text_len);
+    GapBegin += text_len;
+    for (int n = 0; n < text_len && new_lines_count > 0; n++)
+        if (text[n] == '\n')
+        {
+            LineStarts.Data[LineGapBegin++] = pos + n + 1;
+            new_lines_count--;
+        }
+
+    Cursor = TextDocumentAdjustPos(Cursor, pos, delete_len, text_len);
+    SelectionAnchor = TextDocumentAdjustPos(SelectionAnchor, pos, delete_len, text_len);
+    Version++;
 }
 
-static void ColorEditRestoreH(ImGuiContext* ctx, const float* col, float* H)
+static void TextDocumentAppendUndoText(ImVector<char>* undo_text, const char* text, int text_len)
 {
-    ImGuiContext& g = *ctx;
-    IM_ASSERT(g.ColorEditCurrentID != 0);
-    if (g.ColorEditSavedID != g.ColorEditCurrentID || g.ColorEditSavedColor != ImGui::ColorConvertFloat4ToU32(ImVec4(col[0], col[1], col[2], 0)))
+    if (text_len <= 0)
         return;
-    *H = g.ColorEditSavedHue;
+    const int offset = undo_text->Size;
+    undo_text->resize(offset + text_len);
+    memcpy(undo_text->Data + offset, text, (size_t)text_len);
 }
 
-// ColorEdit supports RGB and HSV inputs. In case of RGB input resulting color may have undefined hue and/or saturation.
-// Since widget displays both RGB and HSV values we must preserve hue and saturation to prevent these values resetting.
-static void ColorEditRestoreHS(ImGuiContext* ctx, const float* col, float* H, float* S, float* V)
+void ImGuiTextDocument::Replace(int pos, int delete_len, const char* text, const char* text_end)
 {
-    ImGuiContext& g = *ctx;
-    IM_ASSERT(g.ColorEditCurrentID != 0);
-    if (g.ColorEditSavedID != g.ColorEditCurrentID || g.ColorEditSavedColor != ImGui::ColorConvertFloat4ToU32(ImVec4(col[0], col[1], col[2], 0)))
+    const int text_len = (text == NULL) ? 0 : text_end ? (int)(text_end - text) : (int)strlen(text);
+    if (delete_len == 0 && text_len == 0)
         return;
 
-    // When S == 0, H is undefined.
-    // When H == 1 it wraps around to 0.
-    if (*S == 0.0f || (*H == 0.0f && g.ColorEditSavedHue == 1))
-        *H = g.ColorEditSavedHue;
+    // Discard redo records
+    if (UndoPos < UndoRecords.Size)
+    {
+        UndoText.resize(UndoRecords[UndoPos].TextOffset);
+        UndoRecords.resize(UndoPos);
+        UndoMergeable = false;
+    }
 
-    // When V == 0, S is undefined.
-    if (*V == 0.0f)
-        *S = g.ColorEditSavedSat;
+    // Record deleted then inserted text. Consecutive insertions while typing extend the last record.
+    ImGuiTextDocumentUndoRecord* last_rec = (UndoMergeable && UndoRecords.Size > 0) ? &UndoRecords.back() : NULL;
+    if (last_rec != NULL && delete_len == 0 && last_rec->Pos + last_rec->InsertedLen == pos)
+    {
+        last_rec->InsertedLen += text_len;
+    }
+    else
+    {
+        ImGuiTextDocumentUndoRecord rec;
+        rec.Pos = pos;
+        rec.DeletedLen = delete_len;
+        rec.InsertedLen = text_len;
+        rec.TextOffset = UndoText.Size;
+        UndoRecords.push_back(rec);
+        if (delete_len > 0)
+            TextDocumentAppendUndoText(&UndoText, GetTextRange(pos, pos + delete_len), delete_len);
+    }
+    TextDocumentAppendUndoText(&UndoText, text, text_len);
+    UndoPos = UndoRecords.Size;
+    UndoMergeable = false;
+
+    ApplyReplace(pos, delete_len, text, text_len);
 }
 
-// Edit colors components (each component in 0.0f..1.0f range).
-// See enum ImGuiColorEditFlags_ for available options. e.g. Only access 3 floats if ImGuiColorEditFlags_NoAlpha flag is set.
-// With typical options: Left-click on color square to open color picker. Right-click to open option menu. CTRL-Click over input fields to edit them and TAB to go to next item.
-bool ImGui::ColorEdit4(ImGuiContext* ctx, const char* label, float col[4], ImGuiColorEditFlags flags)
+bool ImGuiTextDocument::Undo()
 {
-    ImGuiWindow* window = GetCurrentWindow(ctx);
-    if (window->SkipItems)
+    if (UndoPos == 0)
         return false;
+    const ImGuiTextDocumentUndoRecord rec = UndoRecords[--UndoPos];
+    ApplyReplace(rec.Pos, rec.InsertedLen, UndoText.Data + rec.TextOffset, rec.DeletedLen);
+    Cursor = SelectionAnchor = rec.Pos + rec.DeletedLen;
+    UndoMergeable = false;
+    return true;
+}
 
-    ImGuiContext& g = *ctx;
-    const ImGuiStyle& style = g.Style;
-    const float square_sz = GetFrameHeight(ctx);
-    const char* label_display_end = FindRenderedTextEnd(label);
-    float w_full = CalcItemWidth(ctx);
-    g.NextItemData.ClearFlags();
-
-    BeginGroup(ctx);
-    PushID(ctx, label);
-    const bool set_current_color_edit_id = (g.ColorEditCurrentID == 0);
-    if (set_current_color_edit_id)
-        g.ColorEditCurrentID = window->IDStack.back();
+bool ImGuiTextDocument::Redo()
+{
+    if (UndoPos == UndoRecords.Size)
+        return false;
+    const ImGuiTextDocumentUndoRecord rec = UndoRecords[UndoPos++];
+    ApplyReplace(rec.Pos, rec.DeletedLen, UndoText.Data + rec.TextOffset + rec.DeletedLen, rec.InsertedLen);
+    Cursor = SelectionAnchor = rec.Pos + rec.InsertedLen;
+    UndoMergeable = false;
+    return true;
+}
 
-    // If we're not showing any slider there's no point in doing any HSV conversions
-    const ImGuiColorEditFlags flags_untouched = flags;
-    if (flags & ImGuiColorEditFlags_NoInputs)
-        flags = (flags & (~ImGuiColorEditFlags_DisplayMask_)) | ImGuiColorEditFlags_DisplayRGB | ImGuiColorEditFlags_NoOptions;
+// Cursor movement helpers, working on UTF-8 bytes. Word boundaries use the same rules as InputTextEx().
+// Separators and blanks are all ASCII, so a boundary is never found inside a multi-byte sequence.
+static int InputTextDocumentNextChar(const ImGuiTextDocument* doc, int pos)
+{
+    const int text_len = doc->GetLength();
+    if (pos < text_len)
+        pos++;
+    while (pos < text_len && (doc->GetChar(pos) & 0xC0) == 0x80)
+        pos++;
+    return pos;
+}
 
-    // Context menu: display and modify options (before defaults are applied)
-    if (!(flags & ImGuiColorEditFlags_NoOptions))
-        ColorEditOptionsPopup(ctx, col, flags);
+static int InputTextDocumentPrevChar(const ImGuiTextDocument* doc, int pos)
+{
+    if (pos > 0)
+        pos--;
+    while (pos > 0 && (doc->GetChar(pos) & 0xC0) == 0x80)
+        pos--;
+    return pos;
+}
 
-    // Read stored options
-    if (!(flags & ImGuiColorEditFlags_DisplayMask_))
-        flags |= (g.ColorEditOptions & ImGuiColorEditFlags_DisplayMask_);
-    if (!(flags & ImGuiColorEditFlags_DataTypeMask_))
-        flags |= (g.ColorEditOptions & ImGuiColorEditFlags_DataTypeMask_);
-    if (!(flags & ImGuiColorEditFlags_PickerMask_))
-        flags |= (g.ColorEditOptions & ImGuiColorEditFlags_PickerMask_);
-    if (!(flags & ImGuiColorEditFlags_InputMask_))
-        flags |= (g.ColorEditOptions & ImGuiColorEditFlags_InputMask_);
-    flags |= (g.ColorEditOptions & ~(ImGuiColorEditFlags_DisplayMask_ | ImGuiColorEditFlags_DataTypeMask_ | ImGuiColorEditFlags_PickerMask_ | ImGuiColorEditFlags_InputMask_));
-    IM_ASSERT(ImIsPowerOfTwo(flags & ImGuiColorEditFlags_DisplayMask_)); // Check that only 1 is selected
-    IM_ASSERT(ImIsPowerOfTwo(flags & ImGuiColorEditFlags_InputMask_));   // Check that only 1 is selected
+static unsigned int InputTextDocumentGetCharOrZero(const ImGuiTextDocument* doc, int pos)
+{
+    return (pos >= 0 && pos < doc->GetLength()) ? (unsigned char)doc->GetChar(pos) : 0;
+}
 
-    const bool alpha = (flags & ImGuiColorEditFlags_NoAlpha) == 0;
-    const bool hdr = (flags & ImGuiColorEditFlags_HDR) != 0;
-    const int components = alpha ? 4 : 3;
-    const float w_button = (flags & ImGuiColorEditFlags_NoSmallPreview) ? 0.0f : (square_sz + style.ItemInnerSpacing.x);
-    const float w_inputs = ImMax(w_full - w_button, 1.0f);
-    w_full = w_inputs + w_button;
+static bool InputTextDocumentIsWordBoundaryFromRight(const ImGuiTextDocument* doc, int pos)
+{
+    if (pos <= 0)
+        return false;
+    const unsigned int c_prev = InputTextDocumentGetCharOrZero(doc, pos - 1);
+    const unsigned int c_curr = InputTextDocumentGetCharOrZero(doc, pos);
+    bool prev_white = ImCharIsBlankW(c_prev);
+    bool prev_separ = ImStb::is_separator(c_prev);
+    bool curr_white = ImCharIsBlankW(c_curr);
+    bool curr_separ = ImStb::is_separator(c_curr);
+    return ((prev_white || prev_separ) && !(curr_separ || curr_white)) || (curr_separ && !prev_separ);
+}
 
-    // Convert to the formats we need
-    float f[4] = { col[0], col[1], col[2], alpha ? col[3] : 1.0f };
+static bool InputTextDocumentIsWordBoundaryFromLeft(const ImGuiTextDocument* doc, int pos)
+{
+    if (pos <= 0)
+        return false;
+    const unsigned int c_prev = InputTextDocumentGetCharOrZero(doc, pos);
+    const unsigned int c_curr = InputTextDocumentGetCharOrZero(doc, pos - 1);
+    bool prev_white = ImCharIsBlankW(c_prev);
+    bool prev_separ = ImStb::is_separator(c_prev);
+    bool curr_white = ImCharIsBlankW(c_curr);
+    bool curr_separ = ImStb::is_separator(c_curr);
+    return ((prev_white) && !(curr_separ || curr_white)) || (curr_separ && !prev_separ);
+}
+
+static int InputTextDocumentMoveWordLeft(const ImGuiTextDocument* doc, int pos)
+{
+    pos--;
+    while (pos >= 0 && !InputTextDocumentIsWordBoundaryFromRight(doc, pos))
+        pos--;
+    return pos < 0 ? 0 : pos;
+}
+
+static int InputTextDocumentMoveWordRight(const ImGuiTextDocument* doc, int pos, bool is_osx)
+{
+    const int text_len = doc->GetLength();
+    pos++;
+    while (pos < text_len && !(is_osx ? InputTextDocumentIsWordBoundaryFromLeft(doc, pos) : InputTextDocumentIsWordBoundaryFromRight(doc, pos)))
+        pos++;
+    return pos > text_len ? text_len : pos;
+}
+
+// Width of text between start of line and 'pos'. Only measures this line.
+static float InputTextDocumentCalcWidth(ImGuiContext* ctx, ImGuiTextDocument* doc, int line_start, int pos)
+{
+    ImGuiContext& g = *ctx;
+    if (pos <= line_start)
+        return 0.0f;
+    const char* text = doc->GetTextRange(line_start, pos);
+    return g.Font->CalcTextSizeA(g.FontSize, FLT_MAX, 0.0f, text, text + (pos - line_start)).x;
+}
+
+static int InputTextDocumentLocateX(ImGuiContext* ctx, ImGuiTextDocument* doc, int line, float x)
+{
+    ImGuiContext& g = *ctx;
+    const int line_start = doc->GetLineStart(line);
+    const int line_end = doc->GetLineEnd(line);
+    const char* text = doc->GetTextRange(line_start, line_end);
+    const char* text_end = text + (line_end - line_start);
+    const float scale = g.FontSize / g.Font->FontSize;
+    float line_x = 0.0f;
+    for (const char* s = text; s < text_end; )
+    {
+        unsigned int c;
+        const int c_len = ImTextCharFromUtf8(&c, s, text_end);
+        const float advance_x = (c == '\r') ? 0.0f : g.Font->GetCharAdvance((ImWchar)c) * scale;
+        if (x < line_x + advance_x * 0.5f)
+            return line_start + (int)(s - text);
+        line_x += advance_x;
+        s += c_len;
+    }
+    return line_end;
+}
+
+static int InputTextDocumentLocateCoord(ImGuiContext* ctx, ImGuiTextDocument* doc, float x, float y)
+{
+    ImGuiContext& g = *ctx;
+    const float line_n = ImFloor(y / g.FontSize);
+    if (line_n >= (float)doc->GetLineCount())
+        return doc->GetLength();
+    return InputTextDocumentLocateX(ctx, doc, ImMax((int)line_n, 0), x);
+}
+
+static void InputTextDocumentSetCursor(ImGuiTextDocument* doc, int pos, bool select, bool keep_preferred_x = false)
+{
+    doc->Cursor = pos;
+    if (!select)
+        doc->SelectionAnchor = pos;
+    if (!keep_preferred_x)
+        doc->PreferredX = -1.0f;
+    doc->UndoMergeable = false;
+    doc->CursorFollow = true;
+    doc->CursorAnim = -0.30f;
+}
+
+// Move cursor to another line, preserving its horizontal position
+static void InputTextDocumentMoveLines(ImGuiContext* ctx, ImGuiTextDocument* doc, int lines_delta, bool select)
+{
+    const int line = doc->GetLineFromPos(doc->Cursor);
+    if (doc->PreferredX < 0.0f)
+        doc->PreferredX = InputTextDocumentCalcWidth(ctx, doc, doc->GetLineStart(line), doc->Cursor);
+    const int target_line = ImClamp(line + lines_delta, 0, doc->GetLineCount() - 1);
+    if (target_line != line)
+        InputTextDocumentSetCursor(doc, InputTextDocumentLocateX(ctx, doc, target_line, doc->PreferredX), select, true);
+    else if (select)
+        InputTextDocumentSetCursor(doc, doc->Cursor, true, true); // Keep selection start, don't move.
+    else
+        InputTextDocumentSetCursor(doc, doc->Cursor, false, true);
+}
+
+// Return true if the document was modified (false when deleting an empty selection)
+static bool InputTextDocumentReplaceSelection(ImGuiTextDocument* doc, const char* text, int text_len, bool is_undoable)
+{
+    const int sel_start = doc->GetSelectionStart();
+    const int sel_end = doc->GetSelectionEnd();
+    if (sel_start == sel_end && text_len == 0)
+        return false;
+    if (is_undoable)
+    {
+        const bool merge = doc->UndoMergeable;
+        doc->UndoMergeable = merge && sel_start == sel_end;
+        doc->Replace(sel_start, sel_end - sel_start, text, text + text_len);
+    }
+    else
+    {
+        doc->ClearUndo(); // Existing records would not match the text anymore
+        doc->ApplyReplace(sel_start, sel_end - sel_start, text, text_len);
+    }
+    InputTextDocumentSetCursor(doc, sel_start + text_len, false);
+    return true;
+}
+
+// Edit an ImGuiTextDocument in place.
+// - Mostly follows the same logic as the multi-line path of InputTextEx(), but never touches the full text:
+//   cursor/selection are UTF-8 positions in the document, the line index gives the lines to measure and render.
+// - Escape deactivates the widget but doesn't revert edits (that would require a copy of the document on activation): use Undo instead.
+bool ImGui::InputTextMultiline(ImGuiContext* ctx, const char* label, ImGuiTextDocument* doc, const ImVec2& size_arg, ImGuiInputTextFlags flags)
+{
+    ImGuiWindow* window = GetCurrentWindow(ctx);
+    if (window->SkipItems)
+        return false;
+
+    IM_ASSERT(doc != NULL);
+    IM_ASSERT((flags & (ImGuiInputTextFlags_Password | ImGuiInputTextFlags_CallbackCompletion | ImGuiInputTextFlags_CallbackHistory | ImGuiInputTextFlags_CallbackAlways | ImGuiInputTextFlags_CallbackCharFilter | ImGuiInputTextFlags_CallbackResize | ImGuiInputTextFlags_CallbackEdit)) == 0); // Not supported
+    flags |= ImGuiInputTextFlags_Multiline;
+
+    ImGuiContext& g = *ctx;
+    ImGuiIO& io = g.IO;
+    const ImGuiStyle& style = g.Style;
+
+    BeginGroup(ctx);
+    const ImGuiID id = window->GetID(label);
+    const ImVec2 label_size = CalcTextSize(ctx, label, NULL, true);
+    const ImVec2 frame_size = CalcItemSize(ctx, size_arg, CalcItemWidth(ctx), g.FontSize * 8.0f + style.FramePadding.y * 2.0f);
+    const ImVec2 total_size = ImVec2(frame_size.x + (label_size.x > 0.0f ? style.ItemInnerSpacing.x + label_size.x : 0.0f), frame_size.y);
+    const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + frame_size);
+    const ImRect total_bb(frame_bb.Min, frame_bb.Min + total_size);
+
+    ImVec2 backup_pos = window->DC.CursorPos;
+    ItemSize(ctx, total_bb, style.FramePadding.y);
+    if (!ItemAdd(ctx, total_bb, id, &frame_bb, ImGuiItemFlags_Inputable))
+    {
+        EndGroup(ctx);
+        return false;
+    }
+    ImGuiLastItemData item_data_backup = g.LastItemData;
+    window->DC.CursorPos = backup_pos;
+
+    // Prevent NavActivation from Tabbing when our widget accepts Tab inputs, and NavActivate reactivating in BeginChild() (see InputTextEx())
+    if (g.NavActivateId == id && (g.NavActivateFlags & ImGuiActivateFlags_FromTabbing) && (flags & ImGuiInputTextFlags_AllowTabInput))
+        g.NavActivateId = 0;
+    const ImGuiID backup_activate_id = g.NavActivateId;
+    if (g.ActiveId == id)
+        g.NavActivateId = 0;
+
+    PushStyleColor(ctx, ImGuiCol_ChildBg, style.Colors[ImGuiCol_FrameBg]);
+    PushStyleVar(ctx, ImGuiStyleVar_ChildRounding, style.FrameRounding);
+    PushStyleVar(ctx, ImGuiStyleVar_ChildBorderSize, style.FrameBorderSize);
+    PushStyleVar(ctx, ImGuiStyleVar_WindowPadding, ImVec2(0, 0));
+    bool child_visible = BeginChildEx(ctx, label, id, frame_bb.GetSize(), true, ImGuiWindowFlags_NoMove);
+    g.NavActivateId = backup_activate_id;
+    PopStyleVar(ctx, 3);
+    PopStyleColor(ctx);
+    if (!child_visible)
+    {
+        EndChild(ctx);
+        EndGroup(ctx);
+        return false;
+    }
+    ImGuiWindow* draw_window = g.CurrentWindow;
+    draw_window->DC.NavLayersActiveMaskNext |= (1 << draw_window->DC.NavLayerCurrent);
+    draw_window->DC.CursorPos += style.FramePadding;
+    ImVec2 inner_size = frame_size;
+    inner_size.x -= draw_window->ScrollbarSizes.x;
+
+    const bool hovered = ItemHoverable(ctx, frame_bb, id, g.LastItemData.InFlags);
+    if (hovered)
+        g.MouseCursor = ImGuiMouseCursor_TextInput;
+
+    if (g.LastItemData.InFlags & ImGuiItemFlags_ReadOnly)
+        flags |= ImGuiInputTextFlags_ReadOnly;
+    const bool is_readonly = (flags & ImGuiInputTextFlags_ReadOnly) != 0;
+    const bool is_undoable = (flags & ImGuiInputTextFlags_NoUndoRedo) == 0;
+    const bool is_osx = io.ConfigMacOSXBehaviors;
+
+    // The document may have been modified by user code since last frame
+    const int text_len = doc->GetLength();
+    doc->Cursor = ImClamp(doc->Cursor, 0, text_len);
+    doc->SelectionAnchor = ImClamp(doc->SelectionAnchor, 0, text_len);
+
+    const bool input_requested_by_nav = (g.ActiveId != id) && ((g.NavActivateId == id) && ((g.NavActivateFlags & ImGuiActivateFlags_PreferInput) || (g.NavInputSource == ImGuiInputSource_Keyboard)));
+    const bool user_clicked = hovered && io.MouseClicked[0];
+    const bool user_scroll_finish = doc->ID == id && g.ActiveId == 0 && g.ActiveIdPreviousFrame == GetWindowScrollbarID(draw_window, ImGuiAxis_Y);
+    const bool user_scroll_active = doc->ID == id && g.ActiveId == GetWindowScrollbarID(draw_window, ImGuiAxis_Y);
+    const bool init_make_active = (user_clicked || user_scroll_finish || input_requested_by_nav);
+    bool clear_active_id = false;
+    bool value_changed = false;
+    bool validated = false;
+    float scroll_y = draw_window->Scroll.y;
+
+    if (g.ActiveId != id && init_make_active)
+    {
+        if (doc->ID != id)
+            doc->ScrollX = 0.0f;
+        doc->ID = id;
+        doc->UndoMergeable = false;
+        doc->CursorAnim = -0.30f;
+        SetActiveID(ctx, id, window);
+        SetFocusID(ctx, id, window);
+        FocusWindow(ctx, window);
+    }
+    if (g.ActiveId == id)
+    {
+        if (user_clicked)
+            SetKeyOwner(ctx, ImGuiKey_MouseLeft, id);
+        g.ActiveIdUsingNavDirMask |= (1 << ImGuiDir_Left) | (1 << ImGuiDir_Right) | (1 << ImGuiDir_Up) | (1 << ImGuiDir_Down);
+        SetKeyOwner(ctx, ImGuiKey_Home, id);
+        SetKeyOwner(ctx, ImGuiKey_End, id);
+        SetKeyOwner(ctx, ImGuiKey_PageUp, id);
+        SetKeyOwner(ctx, ImGuiKey_PageDown, id);
+        if (is_osx)
+            SetKeyOwner(ctx, ImGuiMod_Alt, id);
+        if (flags & ImGuiInputTextFlags_AllowTabInput)
+            SetShortcutRouting(ctx, ImGuiKey_Tab, id);
+    }
+
+    // Release focus when we click outside
+    if (g.ActiveId == id && io.MouseClicked[0] && !init_make_active && !user_scroll_active)
+        clear_active_id = true;
+
+    bool render_cursor = (g.ActiveId == id) || user_scroll_active;
+
+    // Process mouse inputs and character inputs
+    if (g.ActiveId == id)
+    {
+        g.ActiveIdAllowOverlap = !io.MouseDown[0];
+        const float mouse_x = (io.MousePos.x - draw_window->DC.CursorPos.x) + doc->ScrollX;
+        const float mouse_y = (io.MousePos.y - draw_window->DC.CursorPos.y);
+
+        if (hovered && io.MouseClickedCount[0] >= 2 && !io.KeyShift)
+        {
+            const int pos = InputTextDocumentLocateCoord(ctx, doc, mouse_x, mouse_y);
+            if (((io.MouseClickedCount[0] - 2) % 2) == 0)
+            {
+                // Double-click: Select word
+                // We always use the "Mac" word advance for double-click select vs CTRL+Right which use the platform dependent variant (same as InputTextEx())
+                const int word_start = InputTextDocumentMoveWordLeft(doc, InputTextDocumentNextChar(doc, pos));
+                InputTextDocumentSetCursor(doc, word_start, false);
+                InputTextDocumentSetCursor(doc, InputTextDocumentMoveWordRight(doc, word_start, true), true);
+            }
+            else
+            {
+                // Triple-click: Select line (including trailing new line)
+                const int line = doc->GetLineFromPos(pos);
+                InputTextDocumentSetCursor(doc, doc->GetLineStart(line), false);
+                InputTextDocumentSetCursor(doc, (line + 1 < doc->GetLineCount()) ? doc->GetLineStart(line + 1) : doc->GetLength(), true);
+            }
+            doc->CursorFollow = false;
+        }
+        else if (io.MouseClicked[0])
+        {
+            if (hovered)
+                InputTextDocumentSetCursor(doc, InputTextDocumentLocateCoord(ctx, doc, mouse_x, mouse_y), io.KeyShift);
+        }
+        else if (io.MouseDown[0] && (io.MouseDelta.x != 0.0f || io.MouseDelta.y != 0.0f))
+        {
+            InputTextDocumentSetCursor(doc, InputTextDocumentLocateCoord(ctx, doc, mouse_x, mouse_y), true);
+        }
+
+        // Insert characters. We expect backends to emit a Tab key but some also emit a Tab character which we ignore (see InputTextEx())
+        char utf8_buf[5];
+        if ((flags & ImGuiInputTextFlags_AllowTabInput) && Shortcut(ctx, ImGuiKey_Tab, id, ImGuiInputFlags_Repeat) && !is_readonly)
+        {
+            unsigned int c = '\t';
+            if (InputTextFilterCharacter(&g, &c, flags, NULL, NULL, ImGuiInputSource_Keyboard))
+            {
+                ImTextCharToUtf8(utf8_buf, c);
+                InputTextDocumentReplaceSelection(doc, utf8_buf, (int)strlen(utf8_buf), is_undoable);
+                doc->UndoMergeable = true;
+                value_changed = true;
+            }
+        }
+        const bool ignore_char_inputs = (io.KeyCtrl && !io.KeyAlt) || (is_osx && io.KeySuper);
+        if (io.InputQueueCharacters.Size > 0)
+        {
+            if (!ignore_char_inputs && !is_readonly && !input_requested_by_nav)
+                for (int n = 0; n < io.InputQueueCharacters.Size; n++)
+                {
+                    unsigned int c = (unsigned int)io.InputQueueCharacters[n];
+                    if (c == '\t') // Skip Tab, see above.
+                        continue;
+                    if (!InputTextFilterCharacter(&g, &c, flags, NULL, NULL, ImGuiInputSource_Keyboard))
+                        continue;
+                    ImTextCharToUtf8(utf8_buf, c);
+                    InputTextDocumentReplaceSelection(doc, utf8_buf, (int)strlen(utf8_buf), is_undoable);
+                    doc->UndoMergeable = (c != '\n');
+                    value_changed = true;
+                }
+            io.InputQueueCharacters.resize(0);
+        }
+    }
+
+    // Process other shortcuts/key-presses
+    if (g.ActiveId == id && !g.ActiveIdIsJustActivated && !clear_active_id)
+    {
+        const int row_count_per_page = ImMax((int)((inner_size.y - style.FramePadding.y) / g.FontSize), 1);
+        const bool is_shift = io.KeyShift;
+        const bool is_wordmove_key_down = is_osx ? io.KeyAlt : io.KeyCtrl;
+        const bool is_startend_key_down = is_osx && io.KeySuper && !io.KeyCtrl && !io.KeyAlt;
+
+        const ImGuiInputFlags f_repeat = ImGuiInputFlags_Repeat;
+        const bool has_selection = doc->HasSelection();
+        const bool is_cut   = (Shortcut(ctx, ImGuiMod_Shortcut | ImGuiKey_X, id, f_repeat) || Shortcut(ctx, ImGuiMod_Shift | ImGuiKey_Delete, id, f_repeat)) && !is_readonly && has_selection;
+        const bool is_copy  = (Shortcut(ctx, ImGuiMod_Shortcut | ImGuiKey_C, id) || Shortcut(ctx, ImGuiMod_Ctrl | ImGuiKey_Insert, id)) && has_selection;
+        const bool is_paste = (Shortcut(ctx, ImGuiMod_Shortcut | ImGuiKey_V, id, f_repeat) || Shortcut(ctx, ImGuiMod_Shift | ImGuiKey_Insert, id, f_repeat)) && !is_readonly;
+        const bool is_undo  = (Shortcut(ctx, ImGuiMod_Shortcut | ImGuiKey_Z, id, f_repeat)) && !is_readonly && is_undoable;
+        const bool is_redo  = (Shortcut(ctx, ImGuiMod_Shortcut | ImGuiKey_Y, id, f_repeat) || (is_osx && Shortcut(ctx, ImGuiMod_Shortcut | ImGuiMod_Shift | ImGuiKey_Z, id, f_repeat))) && !is_readonly && is_undoable;
+        const bool is_select_all = Shortcut(ctx, ImGuiMod_Shortcut | ImGuiKey_A, id);
+
+        const bool nav_gamepad_active = (io.ConfigFlags & ImGuiConfigFlags_NavEnableGamepad) != 0 && (io.BackendFlags & ImGuiBackendFlags_HasGamepad) != 0;
+        const bool is_enter_pressed = IsKeyPressed(ctx, ImGuiKey_Enter, true) || IsKeyPressed(ctx, ImGuiKey_KeypadEnter, true);
+        const bool is_gamepad_validate = nav_gamepad_active && (IsKeyPressed(ctx, ImGuiKey_NavGamepadActivate, false) || IsKeyPressed(ctx, ImGuiKey_NavGamepadInput, false));
+        const bool is_cancel = Shortcut(ctx, ImGuiKey_Escape, id, f_repeat) || (nav_gamepad_active && Shortcut(ctx, ImGuiKey_NavGamepadCancel, id, f_repeat));
+
+        const int cursor = doc->Cursor;
+        const int cursor_line = doc->GetLineFromPos(cursor);
+        if (IsKeyPressed(ctx, ImGuiKey_LeftArrow))
+        {
+            if (is_startend_key_down)       InputTextDocumentSetCursor(doc, doc->GetLineStart(cursor_line), is_shift);
+            else if (is_wordmove_key_down)  InputTextDocumentSetCursor(doc, InputTextDocumentMoveWordLeft(doc, cursor), is_shift);
+            else if (has_selection && !is_shift) InputTextDocumentSetCursor(doc, doc->GetSelectionStart(), false);
+            else                            InputTextDocumentSetCursor(doc, InputTextDocumentPrevChar(doc, cursor), is_shift);
+        }
+        else if (IsKeyPressed(ctx, ImGuiKey_RightArrow))
+        {
+            if (is_startend_key_down)       InputTextDocumentSetCursor(doc, doc->GetLineEnd(cursor_line), is_shift);
+            else if (is_wordmove_key_down)  InputTextDocumentSetCursor(doc, InputTextDocumentMoveWordRight(doc, cursor, is_osx), is_shift);
+            else if (has_selection && !is_shift) InputTextDocumentSetCursor(doc, doc->GetSelectionEnd(), false);
+            else                            InputTextDocumentSetCursor(doc, InputTextDocumentNextChar(doc, cursor), is_shift);
+        }
+        else if (IsKeyPressed(ctx, ImGuiKey_UpArrow))    { if (io.KeyCtrl) SetScrollY(draw_window, ImMax(draw_window->Scroll.y - g.FontSize, 0.0f)); else if (is_startend_key_down) InputTextDocumentSetCursor(doc, 0, is_shift); else InputTextDocumentMoveLines(ctx, doc, -1, is_shift); }
+        else if (IsKeyPressed(ctx, ImGuiKey_DownArrow))  { if (io.KeyCtrl) SetScrollY(draw_window, ImMin(draw_window->Scroll.y + g.FontSize, GetScrollMaxY(ctx))); else if (is_startend_key_down) InputTextDocumentSetCursor(doc, doc->GetLength(), is_shift); else InputTextDocumentMoveLines(ctx, doc, +1, is_shift); }
+        else if (IsKeyPressed(ctx, ImGuiKey_PageUp))     { InputTextDocumentMoveLines(ctx, doc, -row_count_per_page, is_shift); scroll_y -= row_count_per_page * g.FontSize; }
+        else if (IsKeyPressed(ctx, ImGuiKey_PageDown))   { InputTextDocumentMoveLines(ctx, doc, +row_count_per_page, is_shift); scroll_y += row_count_per_page * g.FontSize; }
+        else if (IsKeyPressed(ctx, ImGuiKey_Home))       { InputTextDocumentSetCursor(doc, io.KeyCtrl ? 0 : doc->GetLineStart(cursor_line), is_shift); }
+        else if (IsKeyPressed(ctx, ImGuiKey_End))        { InputTextDocumentSetCursor(doc, io.KeyCtrl ? doc->GetLength() : doc->GetLineEnd(cursor_line), is_shift); }
+        else if (IsKeyPressed(ctx, ImGuiKey_Delete) && !is_readonly && !is_cut)
+        {
+            if (!has_selection)
+                InputTextDocumentSetCursor(doc, is_wordmove_key_down ? InputTextDocumentMoveWordRight(doc, cursor, is_osx) : InputTextDocumentNextChar(doc, cursor), true);
+            if (InputTextDocumentReplaceSelection(doc, NULL, 0, is_undoable))
+                value_changed = true;
+        }
+        else if (IsKeyPressed(ctx, ImGuiKey_Backspace) && !is_readonly)
+        {
+            if (!has_selection)
+            {
+                if (is_wordmove_key_down)
+                    InputTextDocumentSetCursor(doc, InputTextDocumentMoveWordLeft(doc, cursor), true);
+                else if (is_osx && io.KeySuper && !io.KeyAlt && !io.KeyCtrl)
+                    InputTextDocumentSetCursor(doc, doc->GetLineStart(cursor_line), true);
+                else
+                    InputTextDocumentSetCursor(doc, InputTextDocumentPrevChar(doc, cursor), true);
+            }
+            if (InputTextDocumentReplaceSelection(doc, NULL, 0, is_undoable))
+                value_changed = true;
+        }
+        else if (is_enter_pressed || is_gamepad_validate)
+        {
+            // Determine if we turn Enter into a \n character
+            bool ctrl_enter_for_new_line = (flags & ImGuiInputTextFlags_CtrlEnterForNewLine) != 0;
+            if (is_gamepad_validate || (ctrl_enter_for_new_line && !io.KeyCtrl) || (!ctrl_enter_for_new_line && io.KeyCtrl))
+            {
+                validated = clear_active_id = true;
+            }
+            else if (!is_readonly)
+            {
+                InputTextDocumentReplaceSelection(doc, "\n", 1, is_undoable);
+                value_changed = true;
+            }
+        }
+        else if (is_cancel)
+        {
+            clear_active_id = true;
+            render_cursor = false;
+        }
+        else if (is_undo || is_redo)
+        {
+            if (is_undo ? doc->Undo() : doc->Redo())
+            {
+                InputTextDocumentSetCursor(doc, doc->Cursor, false);
+                value_changed = true;
+            }
+        }
+        else if (is_select_all)
+        {
+            InputTextDocumentSetCursor(doc, 0, false);
+            InputTextDocumentSetCursor(doc, doc->GetLength(), true);
+        }
+        else if (is_cut || is_copy)
+        {
+            if (io.SetClipboardTextFn)
+            {
+                const int sel_start = doc->GetSelectionStart();
+                const int sel_len = doc->GetSelectionEnd() - sel_start;
+                char* clipboard_data = (char*)IM_ALLOC((size_t)sel_len + 1);
+                memcpy(clipboard_data, doc->GetTextRange(sel_start, sel_start + sel_len), (size_t)sel_len);
+                clipboard_data[sel_len] = 0;
+                SetClipboardText(ctx, clipboard_data);
+                MemFree(clipboard_data);
+            }
+            if (is_cut)
+            {
+                if (InputTextDocumentReplaceSelection(doc, NULL, 0, is_undoable))
+                    value_changed = true;
+            }
+        }
+        else if (is_paste)
+        {
+            if (const char* clipboard = GetClipboardText(ctx))
+            {
+                // Filter pasted buffer
+                ImVector<char> clipboard_filtered;
+                clipboard_filtered.reserve((int)strlen(clipboard));
+                char utf8_buf[5];
+                for (const char* s = clipboard; *s != 0; )
+                {
+                    unsigned int c;
+                    s += ImTextCharFromUtf8(&c, s, NULL);
+                    if (!InputTextFilterCharacter(&g, &c, flags, NULL, NULL, ImGuiInputSource_Clipboard))
+                        continue;
+                    for (const char* p = ImTextCharToUtf8(utf8_buf, c); *p; p++)
+                        clipboard_filtered.push_back(*p);
+                }
+                if (clipboard_filtered.Size > 0) // If everything was filtered, ignore the pasting operation
+                {
+                    InputTextDocumentReplaceSelection(doc, clipboard_filtered.Data, clipboard_filtered.Size, is_undoable);
+                    value_changed = true;
+                }
+            }
+        }
+    }
+
+    // Release active ID at the end of the function (so e.g. pressing Return still does a final application of the value)
+    if (g.ActiveId == id && clear_active_id)
+        ClearActiveID(ctx);
+    else if (g.ActiveId == id)
+        g.WantTextInputNextFrame = 1;
+
+    // Render. Only the lines overlapping the clipping rectangle and the line holding the cursor are accessed.
+    const float line_height = g.FontSize;
+    const int line_count = doc->GetLineCount();
+    const ImVec4 clip_rect(frame_bb.Min.x, frame_bb.Min.y, frame_bb.Min.x + inner_size.x, frame_bb.Min.y + inner_size.y); // Not using frame_bb.Max because we have adjusted size
+    ImVec2 draw_pos = draw_window->DC.CursorPos;
+    const ImVec2 text_size(inner_size.x, line_count * line_height);
+    const bool render_selection = render_cursor && doc->HasSelection();
+
+    ImVec2 cursor_offset;
+    if (render_cursor)
+    {
+        const int cursor_line = doc->GetLineFromPos(doc->Cursor);
+        cursor_offset.x = InputTextDocumentCalcWidth(ctx, doc, doc->GetLineStart(cursor_line), doc->Cursor);
+        cursor_offset.y = (cursor_line + 1) * line_height;
+
+        // Scroll
+        if (doc->CursorFollow)
+        {
+            // Horizontal scroll in chunks of quarter width
+            if (!(flags & ImGuiInputTextFlags_NoHorizontalScroll))
+            {
+                const float scroll_increment_x = inner_size.x * 0.25f;
+                const float visible_width = inner_size.x - style.FramePadding.x;
+                if (cursor_offset.x < doc->ScrollX)
+                    doc->ScrollX = IM_TRUNC(ImMax(0.0f, cursor_offset.x - scroll_increment_x));
+                else if (cursor_offset.x - visible_width >= doc->ScrollX)
+                    doc->ScrollX = IM_TRUNC(cursor_offset.x - visible_width + scroll_increment_x);
+            }
+            else
+            {
+                doc->ScrollX = 0.0f;
+            }
+
+            // Vertical scroll
+            if (cursor_offset.y - g.FontSize < scroll_y)
+                scroll_y = ImMax(0.0f, cursor_offset.y - g.FontSize);
+            else if (cursor_offset.y - (inner_size.y - style.FramePadding.y * 2.0f) >= scroll_y)
+                scroll_y = cursor_offset.y - inner_size.y + style.FramePadding.y * 2.0f;
+            const float scroll_max_y = ImMax((text_size.y + style.FramePadding.y * 2.0f) - inner_size.y, 0.0f);
+            scroll_y = ImClamp(scroll_y, 0.0f, scroll_max_y);
+            draw_pos.y += (draw_window->Scroll.y - scroll_y);   // Manipulate cursor pos immediately avoid a frame of lag
+            draw_window->Scroll.y = scroll_y;
+            doc->CursorFollow = false;
+        }
+    }
+
+    // Visible lines
+    const int line_first = ImClamp((int)((clip_rect.y - draw_pos.y) / line_height), 0, line_count - 1);
+    const int line_last = ImClamp((int)((clip_rect.w - draw_pos.y) / line_height), line_first, line_count - 1);
+    const ImVec2 draw_scroll = ImVec2(doc->ScrollX, 0.0f);
+
+    // Draw selection
+    if (render_selection)
+    {
+        const ImU32 bg_color = GetColorU32(ctx, ImGuiCol_TextSelectedBg);
+        const int sel_start = doc->GetSelectionStart();
+        const int sel_end = doc->GetSelectionEnd();
+        const int sel_line_last = ImMin(doc->GetLineFromPos(sel_end), line_last);
+        for (int line = ImMax(doc->GetLineFromPos(sel_start), line_first); line <= sel_line_last; line++)
+        {
+            const int line_start = doc->GetLineStart(line);
+            const float x0 = InputTextDocumentCalcWidth(ctx, doc, line_start, ImMax(sel_start, line_start));
+            float x1 = InputTextDocumentCalcWidth(ctx, doc, line_start, ImMin(sel_end, doc->GetLineEnd(line)));
+            if (x1 <= x0)
+                x1 = x0 + IM_TRUNC(g.Font->GetCharAdvance((ImWchar)' ') * 0.50f); // So we can see selected empty lines
+            ImRect rect(draw_pos + ImVec2(x0, line * line_height) - draw_scroll, draw_pos + ImVec2(x1, (line + 1) * line_height) - draw_scroll);
+            rect.ClipWith(clip_rect);
+            if (rect.Overlaps(clip_rect))
+                draw_window->DrawList->AddRectFilled(rect.Min, rect.Max, bg_color);
+        }
+    }
+
+    // Draw text (one contiguous range, the gap is moved out of it if needed)
+    const int visible_start = doc->GetLineStart(line_first);
+    const int visible_end = doc->GetLineEnd(line_last);
+    const char* visible_text = doc->GetTextRange(visible_start, visible_end);
+    const char* visible_text_end = visible_text + (visible_end - visible_start);
+    const ImVec2 visible_text_pos = draw_pos + ImVec2(0.0f, line_first * line_height);
+    draw_window->DrawList->AddText(g.Font, g.FontSize, visible_text_pos - draw_scroll, GetColorU32(ctx, ImGuiCol_Text), visible_text, visible_text_end, 0.0f, NULL);
+
+    // Draw blinking cursor
+    if (render_cursor)
+    {
+        doc->CursorAnim += io.DeltaTime;
+        bool cursor_is_visible = (!g.IO.ConfigInputTextCursorBlink) || (doc->CursorAnim <= 0.0f) || ImFmod(doc->CursorAnim, 1.20f) <= 0.80f;
+        InputTextRequestCursorBlinkWakeup(ctx, doc->CursorAnim);
+        ImVec2 cursor_screen_pos = ImTrunc(draw_pos + cursor_offset - draw_scroll);
+        ImRect cursor_screen_rect(cursor_screen_pos.x, cursor_screen_pos.y - g.FontSize + 0.5f, cursor_screen_pos.x + 1.0f, cursor_screen_pos.y - 1.5f);
+        if (cursor_is_visible && cursor_screen_rect.Overlaps(clip_rect))
+            draw_window->DrawList->AddLine(cursor_screen_rect.Min, cursor_screen_rect.GetBL(), GetColorU32(ctx, ImGuiCol_Text));
+
+        // Notify OS of text input position for advanced IME (-1 x offset so that Windows IME can cover our cursor. Bit of an extra nicety.)
+        if (!is_readonly)
+        {
+            g.PlatformImeData.WantVisible = true;
+            g.PlatformImeData.InputPos = ImVec2(cursor_screen_pos.x - 1.0f, cursor_screen_pos.y - g.FontSize);
+            g.PlatformImeData.InputLineHeight = g.FontSize;
+        }
+    }
+
+    // For focus requests to work on our multiline we need to ensure our child ItemAdd() call specifies the ImGuiItemFlags_Inputable (see InputTextEx())
+    Dummy(ctx, ImVec2(text_size.x, text_size.y + style.FramePadding.y));
+    g.NextItemData.ItemFlags |= ImGuiItemFlags_Inputable | ImGuiItemFlags_NoTabStop;
+    EndChild(ctx);
+    item_data_backup.StatusFlags |= (g.LastItemData.StatusFlags & ImGuiItemStatusFlags_HoveredWindow);
+    EndGroup(ctx);
+    if (g.LastItemData.ID == 0)
+    {
+        g.LastItemData.ID = id;
+        g.LastItemData.InFlags = item_data_backup.InFlags;
+        g.LastItemData.StatusFlags = item_data_backup.StatusFlags;
+    }
+
+    // Log as text (visible lines only)
+    if (g.LogEnabled)
+    {
+        LogSetNextTextDecoration(ctx, "{", "}");
+        LogRenderedText(ctx, &visible_text_pos, visible_text, visible_text_end);
+    }
+
+    if (label_size.x > 0)
+        RenderText(ctx, ImVec2(frame_bb.Max.x + style.ItemInnerSpacing.x, frame_bb.Min.y + style.FramePadding.y), label);
+
+    if (value_changed && !(flags & ImGuiInputTextFlags_NoMarkEdited))
+        MarkItemEdited(ctx, id);
+
+    IMGUI_TEST_ENGINE_ITEM_INFO(id, label, g.LastItemData.StatusFlags | ImGuiItemStatusFlags_Inputable);
+    if ((flags & ImGuiInputTextFlags_EnterReturnsTrue) != 0)
+        return validated;
+    else
+        return value_changed;
+}
+
+void ImGui::DebugNodeInputTextState(ImGuiContext* ctx, ImGuiInputTextState* state)
+{
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    ImGuiContext& g = *ctx;
+    ImStb::STB_TexteditState* stb_state = &state->Stb;
+    ImStb::StbUndoState* undo_state = &stb_state->undostate;
+    Text(ctx, "ID: 0x%08X, ActiveID: 0x%08X", state->ID, g.ActiveId);
+    DebugLocateItemOnHover(ctx, state->ID);
+    Text(ctx, "CurLenW: %d, CurLenA: %d, Cursor: %d, Selection: %d..%d", state->CurLenW, state->CurLenA, stb_state->cursor, stb_state->select_start, stb_state->select_end);
+    Text(ctx, "has_preferred_x: %d (%.2f)", stb_state->has_preferred_x, stb_state->preferred_x);
+    Text(ctx, "undo_point: %d, redo_point: %d, undo_char_point: %d, redo_char_point: %d", undo_state->undo_point, undo_state->redo_point, undo_state->undo_char_point, undo_state->redo_char_point);
+    if (BeginChild(ctx, "undopoints", ImVec2(0.0f, GetTextLineHeight(ctx) * 10), ImGuiChildFlags_Border | ImGuiChildFlags_ResizeY)) // Visualize undo state
+    {
+        PushStyleVar(ctx, ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
+        for (int n = 0; n < IMSTB_TEXTEDIT_UNDOSTATECOUNT; n++)
+        {
+            ImStb::StbUndoRecord* undo_rec = &undo_state->undo_rec[n];
+            const char undo_rec_type = (n < undo_state->undo_point) ? 'u' : (n >= undo_state->redo_point) ? 'r' : ' ';
+            if (undo_rec_type == ' ')
+                BeginDisabled(ctx);
+            char buf[64] = "";
+            if (undo_rec_type != ' ' && undo_rec->char_storage != -1)
+                ImTextStrToUtf8(buf, IM_ARRAYSIZE(buf), undo_state->undo_char + undo_rec->char_storage, undo_state->undo_char + undo_rec->char_storage + undo_rec->insert_length);
+            Text(ctx, "%c [%02d] where %03d, insert %03d, delete %03d, char_storage %03d \"%s\"",
+                undo_rec_type, n, undo_rec->where, undo_rec->insert_length, undo_rec->delete_length, undo_rec->char_storage, buf);
+            if (undo_rec_type == ' ')
+                EndDisabled(ctx);
+        }
+        PopStyleVar(ctx);
+    }
+    EndChild(ctx);
+#else
+    IM_UNUSED(state);
+#endif
+}
+
+//-------------------------------------------------------------------------
+// [SECTION] Widgets: ColorEdit, ColorPicker, ColorButton, etc.
+//-------------------------------------------------------------------------
+// - ColorEdit3()
+// - ColorEdit4()
+// - ColorPicker3()
+// - RenderColorRectWithAlphaCheckerboard() [Internal]
+// - ColorPicker4()
+// - ColorButton()
+// - SetColorEditOptions()
+// - ColorTooltip() [Internal]
+// - ColorEditOptionsPopup() [Internal]
+// - ColorPickerOptionsPopup() [Internal]
+//-------------------------------------------------------------------------
+
+bool ImGui::ColorEdit3(ImGuiContext* ctx, const char* label, float col[3], ImGuiColorEditFlags flags)
+{
+    return ColorEdit4(ctx, label, col, flags | ImGuiColorEditFlags_NoAlpha);
+}
+
+static void ColorEditRestoreH(ImGuiContext* ctx, const float* col, float* H)
+{
+    ImGuiContext& g = *ctx;
+    IM_ASSERT(g.ColorEditCurrentID != 0);
+    if (g.ColorEditSavedID != g.ColorEditCurrentID || g.ColorEditSavedColor != ImGui::ColorConvertFloat4ToU32(ImVec4(col[0], col[1], col[2], 0)))
+        return;
+    *H = g.ColorEditSavedHue;
+}
+
+// ColorEdit supports RGB and HSV inputs. In case of RGB input resulting color may have undefined hue and/or saturation.
+// Since widget displays both RGB and HSV values we must preserve hue and saturation to prevent these values resetting.
+static void ColorEditRestoreHS(ImGuiContext* ctx, const float* col, float* H, float* S, float* V)
+{
+    ImGuiContext& g = *ctx;
+    IM_ASSERT(g.ColorEditCurrentID != 0);
+    if (g.ColorEditSavedID != g.ColorEditCurrentID || g.ColorEditSavedColor != ImGui::ColorConvertFloat4ToU32(ImVec4(col[0], col[1], col[2], 0)))
+        return;
+
+    // When S == 0, H is undefined.
+    // When H == 1 it wraps around to 0.
+    if (*S == 0.0f || (*H == 0.0f && g.ColorEditSavedHue == 1))
+        *H = g.ColorEditSavedHue;
+
+    // When V == 0, S is undefined.
+    if (*V == 0.0f)
+        *S = g.ColorEditSavedSat;
+}
+
+// Edit colors components (each component in 0.0f..1.0f range).
+// See enum ImGuiColorEditFlags_ for available options. e.g. Only access 3 floats if ImGuiColorEditFlags_NoAlpha flag is set.
+// With typical options: Left-click on color square to open color picker. Right-click to open option menu. CTRL-Click over input fields to edit them and TAB to go to next item.
+bool ImGui::ColorEdit4(ImGuiContext* ctx, const char* label, float col[4], ImGuiColorEditFlags flags)
+{
+    ImGuiWindow* window = GetCurrentWindow(ctx);
+    if (window->SkipItems)
+        return false;
+
+    ImGuiContext& g = *ctx;
+    const ImGuiStyle& style = g.Style;
+    const float square_sz = GetFrameHeight(ctx);
+    const char* label_display_end = FindRenderedTextEnd(label);
+    float w_full = CalcItemWidth(ctx);
+    g.NextItemData.ClearFlags();
+
+    BeginGroup(ctx);
+    PushID(ctx, label);
+    const bool set_current_color_edit_id = (g.ColorEditCurrentID == 0);
+    if (set_current_color_edit_id)
+        g.ColorEditCurrentID = window->IDStack.back();
+
+    // If we're not showing any slider there's no point in doing any HSV conversions
+    const ImGuiColorEditFlags flags_untouched = flags;
+    if (flags & ImGuiColorEditFlags_NoInputs)
+        flags = (flags & (~ImGuiColorEditFlags_DisplayMask_)) | ImGuiColorEditFlags_DisplayRGB | ImGuiColorEditFlags_NoOptions;
+
+    // Context menu: display and modify options (before defaults are applied)
+    if (!(flags & ImGuiColorEditFlags_NoOptions))
+        ColorEditOptionsPopup(ctx, col, flags);
+
+    // Read stored options
+    if (!(flags & ImGuiColorEditFlags_DisplayMask_))
+        flags |= (g.ColorEditOptions & ImGuiColorEditFlags_DisplayMask_);
+    if (!(flags & ImGuiColorEditFlags_DataTypeMask_))
+        flags |= (g.ColorEditOptions & ImGuiColorEditFlags_DataTypeMask_);
+    if (!(flags & ImGuiColorEditFlags_PickerMask_))
+        flags |= (g.ColorEditOptions & ImGuiColorEditFlags_PickerMask_);
+    if (!(flags & ImGuiColorEditFlags_InputMask_))
+        flags |= (g.ColorEditOptions & ImGuiColorEditFlags_InputMask_);
+    flags |= (g.ColorEditOptions & ~(ImGuiColorEditFlags_DisplayMask_ | ImGuiColorEditFlags_DataTypeMask_ | ImGuiColorEditFlags_PickerMask_ | ImGuiColorEditFlags_InputMask_));
+    IM_ASSERT(ImIsPowerOfTwo(flags & ImGuiColorEditFlags_DisplayMask_)); // Check that only 1 is selected
+    IM_ASSERT(ImIsPowerOfTwo(flags & ImGuiColorEditFlags_InputMask_));   // Check that only 1 is selected
+
+    const bool alpha = (flags & ImGuiColorEditFlags_NoAlpha) == 0;
+    const bool hdr = (flags & ImGuiColorEditFlags_HDR) != 0;
+    const int components = alpha ? 4 : 3;
+    const float w_button = (flags & ImGuiColorEditFlags_NoSmallPreview) ? 0.0f : (square_sz + style.ItemInnerSpacing.x);
+    const float w_inputs = ImMax(w_full - w_button, 1.0f);
+    w_full = w_inputs + w_button;
+
+    // Convert to the formats we need
+    float f[4] = { col[0], col[1], col[2], alpha ? col[3] : 1.0f };
     if ((flags & ImGuiColorEditFlags_InputHSV) && (flags & ImGuiColorEditFlags_DisplayRGB))
         ColorConvertHSVtoRGB(f[0], f[1], f[2], f[0], f[1], f[2]);
     else if ((flags & ImGuiColorEditFlags_InputRGB) && (flags & ImGuiColorEditFlags_DisplayHSV))
@@ -6019,6 +7177,14 @@ bool ImGui::TreeNode(ImGuiContext* ctx, const char* label)
     return TreeNodeBehavior(ctx, window->GetID(label), 0, label, NULL);
 }
 
+bool ImGui::TreeNode(ImGuiContext* ctx, const ImGuiLiteralID& label)
+{
+    ImGuiWindow* window = GetCurrentWindow(ctx);
+    if (window->SkipItems)
+        return false;
+    return TreeNodeBehavior(ctx, GetIDWithSeed(ctx, label, window->IDStack.back()), 0, label.Str, NULL);
+}
+
 bool ImGui::TreeNodeV(ImGuiContext* ctx, const char* str_id, const char* fmt, va_list args)
 {
     return TreeNodeExV(ctx, str_id, 0, fmt, args);
@@ -6484,6 +7650,15 @@ bool ImGui::CollapsingHeader(ImGuiContext* ctx, const char* label, bool* p_visib
 // But you need to make sure the ID is unique, e.g. enclose calls in PushID/PopID or use ##unique_id.
 // With this scheme, ImGuiSelectableFlags_SpanAllColumns and ImGuiSelectableFlags_AllowOverlap are also frequently used flags.
 // FIXME: Selectable() with (size.x == 0.0f) and (SelectableTextAlign.x > 0.0f) followed by SameLine() is currently not supported.
+bool ImGui::Selectable(ImGuiContext* ctx, const ImGuiLiteralID& label, bool selected, ImGuiSelectableFlags flags, const ImVec2& size_arg)
+{
+    ImGuiContext& g = *ctx;
+    g.NextItemLiteralID = &label;
+    bool pressed = Selectable(ctx, label.Str, selected, flags, size_arg);
+    g.NextItemLiteralID = NULL;
+    return pressed;
+}
+
 bool ImGui::Selectable(ImGuiContext* ctx, const char* label, bool selected, ImGuiSelectableFlags flags, const ImVec2& size_arg)
 {
     ImGuiWindow* window = GetCurrentWindow(ctx);
@@ -6967,6 +8142,7 @@ bool ImGui::ListBox(ImGuiContext* ctx, const char* label, int* current_item, con
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: PlotLines, PlotHistogram
 //-------------------------------------------------------------------------
+// - ImGuiPlotIndex
 // - PlotEx() [Internal]
 // - PlotLines()
 // - PlotHistogram()
@@ -6977,7 +8153,106 @@ bool ImGui::ListBox(ImGuiContext* ctx, const char* label, int* current_item, con
 // - others https://github.com/ocornut/imgui/wiki/Useful-Extensions
 //-------------------------------------------------------------------------
 
-int ImGui::PlotEx(ImGuiContext* ctx, ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg)
+// Each level stores the (min, max) of blocks of 16 entries of the level below
+static const int PLOT_INDEX_LEVEL_SHIFT = 4;
+static const int PLOT_INDEX_LEVEL_BLOCK = 1 << PLOT_INDEX_LEVEL_SHIFT;
+
+void ImGuiPlotIndex::Update(float (*values_getter)(void* data, int idx), void* data, int values_count)
+{
+    if (values_count < Count)
+        Clear();
+    for (int level_n = 0; level_n < IM_ARRAYSIZE(Levels); level_n++)
+    {
+        ImVector<ImVec2>& level = Levels[level_n];
+        const int src_count = (level_n == 0) ? values_count : Levels[level_n - 1].Size;
+        const int dst_count = src_count >> PLOT_INDEX_LEVEL_SHIFT;
+        if (level.Size == dst_count)
+            break;
+        int block_n = level.Size;
+        level.resize(dst_count);
+        for (; block_n < dst_count; block_n++)
+        {
+            ImVec2 min_max(FLT_MAX, -FLT_MAX);
+            const int src_begin = block_n << PLOT_INDEX_LEVEL_SHIFT;
+            if (level_n == 0)
+            {
+                for (int n = src_begin; n < src_begin + PLOT_INDEX_LEVEL_BLOCK; n++)
+                {
+                    const float v = values_getter(data, n);
+                    if (v != v) // Ignore NaN values
+                        continue;
+                    min_max.x = ImMin(min_max.x, v);
+                    min_max.y = ImMax(min_max.y, v);
+                }
+            }
+            else
+            {
+                const ImVec2* src = Levels[level_n - 1].Data + src_begin;
+                for (int n = 0; n < PLOT_INDEX_LEVEL_BLOCK; n++)
+                {
+                    min_max.x = ImMin(min_max.x, src[n].x);
+                    min_max.y = ImMax(min_max.y, src[n].y);
+                }
+            }
+            level.Data[block_n] = min_max;
+        }
+    }
+    Count = values_count;
+}
+
+ImVec2 ImGuiPlotIndex::GetRangeMinMax(float (*values_getter)(void* data, int idx), void* data, int idx_begin, int idx_end) const
+{
+    IM_ASSERT(idx_begin >= 0 && idx_begin <= idx_end && idx_end <= Count);
+    ImVec2 min_max(FLT_MAX, -FLT_MAX);
+
+    // Climb levels while the range contains at least one complete block of the level above:
+    // accumulate the partial blocks at both ends from the current level, continue with the complete blocks in between.
+    int level_n = -1; // -1: values
+    int begin = idx_begin;
+    int end = idx_end;
+    while (true)
+    {
+        int begin_up = (begin + PLOT_INDEX_LEVEL_BLOCK - 1) >> PLOT_INDEX_LEVEL_SHIFT;
+        int end_up = end >> PLOT_INDEX_LEVEL_SHIFT;
+        const bool climb = (level_n + 1 < IM_ARRAYSIZE(Levels)) && (begin_up < end_up);
+        for (int pass = 0; pass < 2; pass++)
+        {
+            // When climbing, pass 0 covers [begin, begin_up << SHIFT) and pass 1 covers [end_up << SHIFT, end). Otherwise pass 0 covers [begin, end).
+            const int n_begin = (pass == 0) ? begin : (end_up << PLOT_INDEX_LEVEL_SHIFT);
+            const int n_end = !climb ? end : (pass == 0) ? (begin_up << PLOT_INDEX_LEVEL_SHIFT) : end;
+            if (level_n < 0)
+            {
+                for (int n = n_begin; n < n_end; n++)
+                {
+                    const float v = values_getter(data, n);
+                    if (v != v) // Ignore NaN values
+                        continue;
+                    min_max.x = ImMin(min_max.x, v);
+                    min_max.y = ImMax(min_max.y, v);
+                }
+            }
+            else
+            {
+                const ImVec2* src = Levels[level_n].Data;
+                for (int n = n_begin; n < n_end; n++)
+                {
+                    min_max.x = ImMin(min_max.x, src[n].x);
+                    min_max.y = ImMax(min_max.y, src[n].y);
+                }
+            }
+            if (!climb)
+                break;
+        }
+        if (!climb)
+            break;
+        begin = begin_up;
+        end = end_up;
+        level_n++;
+    }
+    return min_max;
+}
+
+int ImGui::PlotEx(ImGuiContext* ctx, ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg, ImGuiPlotIndex* index)
 {
     ImGuiContext& g = *ctx;
     ImGuiWindow* window = GetCurrentWindow(ctx);
@@ -6998,12 +8273,25 @@ int ImGui::PlotEx(ImGuiContext* ctx, ImGuiPlotType plot_type, const char* label,
         return -1;
     const bool hovered = ItemHoverable(ctx, frame_bb, id, g.LastItemData.InFlags);
 
+    // Index values appended since last call
+    if (index != NULL)
+    {
+        IM_ASSERT(values_offset == 0); // Not supported with an index
+        index->Update(values_getter, data, values_count);
+    }
+
     // Determine scale from values if not specified
     if (scale_min == FLT_MAX || scale_max == FLT_MAX)
     {
         float v_min = FLT_MAX;
         float v_max = -FLT_MAX;
-        for (int i = 0; i < values_count; i++)
+        if (index != NULL)
+        {
+            const ImVec2 min_max = index->GetRangeMinMax(values_getter, data, 0, values_count);
+            v_min = min_max.x;
+            v_max = min_max.y;
+        }
+        else for (int i = 0; i < values_count; i++)
         {
             const float v = values_getter(data, i);
             if (v != v) // Ignore NaN values
@@ -7020,8 +8308,72 @@ int ImGui::PlotEx(ImGuiContext* ctx, ImGuiPlotType plot_type, const char* label,
     RenderFrame(ctx, frame_bb.Min, frame_bb.Max, GetColorU32(ctx, ImGuiCol_FrameBg), true, style.FrameRounding);
 
     const int values_count_min = (plot_type == ImGuiPlotType_Lines) ? 2 : 1;
+    const int columns_count = (int)inner_bb.GetWidth();
     int idx_hovered = -1;
-    if (values_count >= values_count_min)
+    if (index != NULL && columns_count >= values_count_min && values_count > columns_count)
+    {
+        // Decimated path: one column per pixel, drawn from the (min, max) of the values it covers. Lines are submitted as a single polyline.
+        const float inv_scale = (scale_min == scale_max) ? 0.0f : (1.0f / (scale_max - scale_min));
+        const float histogram_zero_line_t = (scale_min * scale_max < 0.0f) ? (1 + scale_min * inv_scale) : (scale_min < 0.0f ? 0.0f : 1.0f);
+        const float histogram_zero_line_y = ImLerp(inner_bb.Min.y, inner_bb.Max.y, histogram_zero_line_t);
+        const ImU32 col_base = GetColorU32(ctx, (plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram);
+        const ImU32 col_hovered = GetColorU32(ctx, (plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered);
+        const float column_width = inner_bb.GetWidth() / columns_count;
+
+        // Tooltip on hover
+        int column_hovered = -1;
+        if (hovered && inner_bb.Contains(g.IO.MousePos))
+            column_hovered = ImClamp((int)((g.IO.MousePos.x - inner_bb.Min.x) / column_width), 0, columns_count - 1);
+
+        ImDrawList* draw_list = window->DrawList;
+        float hovered_y0 = FLT_MAX, hovered_y1 = -FLT_MAX;
+        for (int column_n = 0; column_n < columns_count; column_n++)
+        {
+            const int idx_begin = (int)((ImS64)column_n * values_count / columns_count);
+            const int idx_end = (int)((ImS64)(column_n + 1) * values_count / columns_count);
+            const ImVec2 min_max = index->GetRangeMinMax(values_getter, data, idx_begin, idx_end);
+            if (column_n == column_hovered)
+            {
+                SetTooltip(ctx, "%d..%d: %8.4g..%8.4g", idx_begin, idx_end - 1, min_max.x, min_max.y);
+                idx_hovered = idx_begin;
+            }
+            if (min_max.x > min_max.y) // Only NaN values
+                continue;
+
+            float y0 = ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((min_max.y - scale_min) * inv_scale)); // Top (max value)
+            float y1 = ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((min_max.x - scale_min) * inv_scale)); // Bottom (min value)
+            if (plot_type == ImGuiPlotType_Lines)
+            {
+                // Start each column from the end nearest to the previous point
+                const float x = ImLerp(inner_bb.Min.x, inner_bb.Max.x, (float)column_n / (columns_count - 1));
+                if (draw_list->_Path.Size > 0 && draw_list->_Path.back().y > (y0 + y1) * 0.5f)
+                    ImSwap(y0, y1);
+                draw_list->PathLineTo(ImVec2(x, y0));
+                if (y1 != y0)
+                    draw_list->PathLineTo(ImVec2(x, y1));
+                if (column_n == column_hovered)
+                {
+                    hovered_y0 = ImMin(y0, y1);
+                    hovered_y1 = ImMax(y0, y1);
+                }
+            }
+            else if (plot_type == ImGuiPlotType_Histogram)
+            {
+                const float x0 = inner_bb.Min.x + column_n * column_width;
+                draw_list->AddRectFilled(ImVec2(x0, ImMin(y0, histogram_zero_line_y)), ImVec2(x0 + column_width, ImMax(y1, histogram_zero_line_y)), (column_n == column_hovered) ? col_hovered : col_base);
+            }
+        }
+        if (plot_type == ImGuiPlotType_Lines)
+        {
+            draw_list->PathStroke(col_base, ImDrawFlags_None, 1.0f);
+            if (hovered_y0 <= hovered_y1)
+            {
+                const float x = ImLerp(inner_bb.Min.x, inner_bb.Max.x, (float)column_hovered / (columns_count - 1));
+                draw_list->AddLine(ImVec2(x, hovered_y0), ImVec2(x, hovered_y1 + 1.0f), col_hovered);
+            }
+        }
+    }
+    else if (values_count >= values_count_min)
     {
         int res_w = ImMin((int)frame_size.x, values_count) + ((plot_type == ImGuiPlotType_Lines) ? -1 : 0);
         int item_count = values_count + ((plot_type == ImGuiPlotType_Lines) ? -1 : 0);
@@ -7129,6 +8481,18 @@ void ImGui::PlotHistogram(ImGuiContext* ctx, const char* label, float (*values_g
     PlotEx(ctx, ImGuiPlotType_Histogram, label, values_getter, data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
 }
 
+void ImGui::PlotLines(ImGuiContext* ctx, const char* label, const float* values, int values_count, ImGuiPlotIndex* index, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
+{
+    ImGuiPlotArrayGetterData data(values, stride);
+    PlotEx(ctx, ImGuiPlotType_Lines, label, &Plot_ArrayGetter, (void*)&data, values_count, 0, overlay_text, scale_min, scale_max, graph_size, index);
+}
+
+void ImGui::PlotHistogram(ImGuiContext* ctx, const char* label, const float* values, int values_count, ImGuiPlotIndex* index, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
+{
+    ImGuiPlotArrayGetterData data(values, stride);
+    PlotEx(ctx, ImGuiPlotType_Histogram, label, &Plot_ArrayGetter, (void*)&data, values_count, 0, overlay_text, scale_min, scale_max, graph_size, index);
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Value helpers
 // Those is not very useful, legacy API.
@@ -7897,6 +9261,10 @@ void    ImGui::EndTabBar(ImGuiContext* ctx)
     if (tab_bar->WantLayout)
         TabBarLayout(ctx, tab_bar);
 
+    // Selection and reordering requests are applied by next frame layout
+    if (tab_bar->NextSelectedTabId != 0 || tab_bar->ReorderRequestTabId != 0)
+        RequestWakeup(ctx);
+
     // Restore the last visible height if no tab is visible, this reduce vertical flicker/movement when a tabs gets removed without calling SetTabItemClosed().
     const bool tab_bar_appearing = (tab_bar->PrevFrameVisible + 1 < g.FrameCount);
     if (tab_bar->VisibleTabWasSubmitted || tab_bar->VisibleTabId == 0 || tab_bar_appearing)
@@ -8154,6 +9522,8 @@ static void ImGui::TabBarLayout(ImGuiContext* ctx, ImGuiTabBar* tab_bar)
         tab_bar->ScrollingSpeed = ImMax(tab_bar->ScrollingSpeed, ImFabs(tab_bar->ScrollingTarget - tab_bar->ScrollingAnim) / 0.3f);
         const bool teleport = (tab_bar->PrevFrameVisible + 1 < g.FrameCount) || (tab_bar->ScrollingTargetDistToVisibility > 10.0f * g.FontSize);
         tab_bar->ScrollingAnim = teleport ? tab_bar->ScrollingTarget : ImLinearSweep(tab_bar->ScrollingAnim, tab_bar->ScrollingTarget, g.IO.DeltaTime * tab_bar->ScrollingSpeed);
+        if (tab_bar->ScrollingAnim != tab_bar->ScrollingTarget)
+            RequestWakeup(ctx);
     }
     else
     {
@@ -6,6 +6,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2024/01/22: added support for ImFontAtlasFlags_SignedDistanceField using FT_RENDER_MODE_SDF (require FreeType 2.11+).
 //  2023/11/13: added support for ImFontConfig::RasterizationDensity field for scaling render density without scaling metrics.
 //  2023/08/01: added support for SVG fonts, enable by using '#define IMGUI_ENABLE_FREETYPE_LUNASVG' (#6591)
 //  2023/01/04: fixed a packing issue which in some occurrences would prevent large amount of glyphs from being packed correctly.
@@ -437,7 +438,7 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
     ImFontAtlasBuildInit(atlas);
 
     // Clear atlas
-    atlas->TexID = 0;
+    atlas->TexID = atlas->TexSdfID = 0;
     atlas->TexWidth = atlas->TexHeight = 0;
     atlas->TexUvScale = ImVec2(0.0f, 0.0f);
     atlas->TexUvWhitePixel = ImVec2(0.0f, 0.0f);
@@ -472,6 +473,12 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
         // Load font
         if (!font_face.InitFont(ft_library, cfg, extra_flags))
             return false;
+#if (FREETYPE_MAJOR > 2) || (FREETYPE_MAJOR == 2 && FREETYPE_MINOR >= 11)
+        if (atlas->Flags & ImFontAtlasFlags_SignedDistanceField)
+            font_face.RenderMode = FT_RENDER_MODE_SDF;
+#else
+        IM_ASSERT(!(atlas->Flags & ImFontAtlasFlags_SignedDistanceField) && "ImFontAtlasFlags_SignedDistanceField requires FreeType version >= 2.11");
+#endif
 
         // Measure highest codepoints
         src_load_color |= (cfg.FontBuilderFlags & ImGuiFreeTypeBuilderFlags_LoadColor) != 0;
@@ -572,7 +579,7 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
         buf_rects_out_n += src_tmp.GlyphsCount;
 
         // Compute multiply table if requested
-        const bool multiply_enabled = (cfg.RasterizerMultiply != 1.0f);
+        const bool multiply_enabled = (cfg.RasterizerMultiply != 1.0f) && !(atlas->Flags & ImFontAtlasFlags_SignedDistanceField); // Alpha encodes a distance in SDF mode
         unsigned char multiply_table[256];
         if (multiply_enabled)
             ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
@@ -647,6 +654,7 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
             if (src_tmp.Rects[glyph_i].was_packed)
                 atlas->TexHeight = ImMax(atlas->TexHeight, src_tmp.Rects[glyph_i].y + src_tmp.Rects[glyph_i].h);
     }
+    ImFontAtlasBuildRetainPackContext(atlas, &pack_context, pack_nodes.Data);
 
     // 7. Allocate texture
     atlas->TexHeight = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (atlas->TexHeight + 1) : ImUpperPowerOfTwo(atlas->TexHeight);
@@ -810,6 +818,17 @@ static bool ImFontAtlasBuildWithFreeType(ImFontAtlas* atlas)
     FT_Property_Set(ft_library, "ot-svg", "svg-hooks", &hooks);
 #endif // IMGUI_ENABLE_FREETYPE_LUNASVG
 
+#if (FREETYPE_MAJOR > 2) || (FREETYPE_MAJOR == 2 && FREETYPE_MINOR >= 11)
+    // Match the distance range encoded by FT_RENDER_MODE_SDF with the one used by the stb_truetype builder (FreeType accepts 2..32)
+    // https://freetype.org/freetype2/docs/reference/ft2-properties.html#spread
+    if (atlas->Flags & ImFontAtlasFlags_SignedDistanceField)
+    {
+        FT_Int spread = (FT_Int)ImClamp(atlas->TexSdfSpread, 2, 32);
+        FT_Property_Set(ft_library, "sdf", "spread", &spread);
+        FT_Property_Set(ft_library, "bsdf", "spread", &spread);
+    }
+#endif
+
     bool ret = ImFontAtlasBuildWithFreeTypeEx(ft_library, atlas, atlas->FontBuilderFlags);
     FT_Done_Library(ft_library);
 